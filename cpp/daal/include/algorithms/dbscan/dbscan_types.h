@@ -67,6 +67,17 @@ enum DistanceType
     lastDistanceType = euclidean
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DBSCAN__NEIGHBORHOODENGINE"></a>
+ * Available engines for computing neighborhoods of observations in the batch mode on CPU
+ */
+enum NeighborhoodEngineId
+{
+    bruteForceEngine = 0, /*!< Default: computes distances between all pairs of observations */
+    gridEngine       = 1  /*!< Searches neighbors in the adjacent cells of the uniform grid with the cell size
+                               not less than epsilon. Neighborhoods are computed lazily during cluster expansion */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__DBSCAN__INPUTID"></a>
  * \brief Available identifiers of input objects for the DBSCAN algorithm
@@ -2299,7 +2310,43 @@ typedef services::SharedPtr<DistributedPartialResultStep13> DistributedPartialRe
 
 } // namespace interface1
 
-using interface1::Parameter;
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DBSCAN__PARAMETER"></a>
+ * \brief Parameters for the DBSCAN algorithm
+ * \par Enumerations
+ *      - \ref DistanceType         Methods for distance computation
+ *      - \ref NeighborhoodEngineId Engines for computing neighborhoods of observations
+ */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     *  Constructs parameters of the DBSCAN algorithm
+     */
+    Parameter();
+
+    /**
+     *  Constructs parameters of the DBSCAN algorithm
+     *  \param[in] _epsilon         Radius of neighborhood
+     *  \param[in] _minObservations Minimal total weight of observations in neighborhood of core observation
+     */
+    Parameter(double _epsilon, size_t _minObservations);
+
+    /**
+     *  Constructs parameters of the DBSCAN algorithm by copying another parameters of the DBSCAN algorithm
+     *  \param[in] other    Parameters of the DBSCAN algorithm
+     */
+    Parameter(const Parameter & other);
+
+    NeighborhoodEngineId neighborhoodEngine; /*!< Engine for computing neighborhoods of observations in the batch mode */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+} // namespace interface2
+
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -102,6 +102,26 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 /* [Parameter source code] */
 } // namespace interface2
 
+/**
+ * \brief Contains version 3.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__PARAMETER"></a>
+ * \brief Gradient Boosted Trees algorithm parameters
+ */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /** Default constructor */
+    Parameter(size_t nClasses) : interface2::Parameter(nClasses), maxLeaves(0) {}
+    services::Status check() const DAAL_C11_OVERRIDE;
+    size_t maxLeaves; /*!< Maximal number of leaf nodes in a tree, 0 for unlimited.
+                           If positive then the tree is grown best-first: the leaf with the largest
+                           loss reduction is split next. Default is 0 (depth-wise growth) */
+};
+} // namespace interface3
+
 namespace interface1
 {
 /**
@@ -177,7 +197,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface2::Parameter;
+using interface3::Parameter;
 using interface1::Result;
 using interface1::ResultPtr;
 
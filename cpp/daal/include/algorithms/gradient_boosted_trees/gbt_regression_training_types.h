@@ -238,7 +238,28 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PARAMETER"></a>
+ * \brief Parameters for the gradient boosted trees algorithm
+ */
+class DAAL_EXPORT Parameter : public interface1::Parameter
+{
+public:
+    Parameter();
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t maxLeaves; /*!< Maximal number of leaf nodes in a tree, 0 for unlimited.
+                           If positive then the tree is grown best-first: the leaf with the largest
+                           loss reduction is split next. Default is 0 (depth-wise growth) */
+};
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -50,7 +50,10 @@ enum Method
 {
     lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR     = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    hamerlyDense = 2  /*!< Lloyd algorithm accelerated with the triangle inequality (Hamerly's bounds),
+                           follows the same iterations as lloydDense, so the centroids match up to ties
+                           and rounding; batch processing only */
 };
 
 /**
@@ -241,6 +241,8 @@
 #include "algorithms/optimization_solver/saga/saga_types.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_batch.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
 #include "algorithms/normalization/zscore.h"
 #include "algorithms/normalization/zscore_types.h"
 #include "algorithms/normalization/minmax.h"
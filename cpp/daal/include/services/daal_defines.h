@@ -354,6 +354,7 @@ const int SERIALIZATION_LBFGS_RESULT_ID              = 103830;
 const int SERIALIZATION_SGD_RESULT_ID                = 103840;
 const int SERIALIZATION_SAGA_RESULT_ID               = 103850;
 const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID = 103860;
+const int SERIALIZATION_NEWTON_CG_RESULT_ID          = 103870;
 
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID = 103900;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID = 103910;
@@ -153,6 +153,14 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     *  Enables NUMA first-touch placement of large host buffers allocated by oneDAL tables and arrays.
+     *  Pages of such a buffer are zeroed by the threads of all NUMA nodes, so that every node owns
+     *  the rows processed by its threads. Disabled by default
+     *  \param[in] enableNumaFirstTouchFlag   Flag to NUMA first-touch placement enable
+     */
+    void enableNumaFirstTouch(bool enableNumaFirstTouchFlag = true);
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
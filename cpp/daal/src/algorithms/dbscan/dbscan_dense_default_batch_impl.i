@@ -286,17 +286,42 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
                                                                        NumericTable * ntAssignments, NumericTable * ntNClusters,
                                                                        NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
                                                                        const Parameter * par)
+{
+    const algorithmFPType epsilon        = par->epsilon;
+    const algorithmFPType minkowskiPower = (algorithmFPType)2.0;
+
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
+
+    return computeLazily(nEngine, ntData, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeGrid(const NumericTable * ntData, const NumericTable * ntWeights,
+                                                                    NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                                                    NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                                    const Parameter * par)
+{
+    const algorithmFPType epsilon = par->epsilon;
+
+    GridNeighborhoodEngine<algorithmFPType, cpu> nEngine(ntData, ntWeights, epsilon);
+    DAAL_CHECK_STATUS_VAR(nEngine.init());
+
+    return computeLazily(nEngine, ntData, ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+template <typename NeighborhoodEngineType>
+Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeLazily(NeighborhoodEngineType & nEngine, const NumericTable * ntData,
+                                                                      NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                                                      NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                                      const Parameter * par)
 {
     Status s;
 
-    const algorithmFPType epsilon         = par->epsilon;
     const algorithmFPType minObservations = par->minObservations;
-    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
 
     const size_t nRows = ntData->getNumberOfRows();
 
-    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
-
     WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
     DAAL_CHECK_BLOCK_STATUS(assignRows);
     int * const assignments = assignRows.get();
@@ -323,7 +348,7 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
         if (assignments[i] != undefined) continue;
 
         Neighborhood<algorithmFPType, cpu> curNeigh;
-        nEngine.query(&i, 1, &curNeigh);
+        DAAL_CHECK_STATUS_VAR(nEngine.query(&i, 1, &curNeigh));
 
         if (curNeigh.weight() < minObservations)
         {
@@ -51,7 +51,15 @@ public:
                                     NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
                                     const Parameter * par);
 
+    services::Status computeGrid(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                 NumericTable * ntCoreIndices, NumericTable * ntCoreObservations, const Parameter * par);
+
 private:
+    template <typename NeighborhoodEngineType>
+    services::Status computeLazily(NeighborhoodEngineType & nEngine, const NumericTable * ntData, NumericTable * ntAssignments,
+                                   NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                   const Parameter * par);
+
     services::Status processNeighborhood(size_t clusterId, int * assignments, const Neighborhood<algorithmFPType, cpu> & neigh,
                                          Queue<size_t, cpu> & qu);
 
@@ -40,7 +40,14 @@ namespace interface1
  *  Constructs parameters of the DBSCAN algorithm
  */
 Parameter::Parameter()
-    : epsilon(0.5), minObservations(5), memorySavingMode(false), resultsToCompute(0), blockIndex(0), nBlocks(1), leftBlocks(1), rightBlocks(1)
+    : epsilon(0.5),
+      minObservations(5),
+      memorySavingMode(false),
+      resultsToCompute(0),
+      blockIndex(0),
+      nBlocks(1),
+      leftBlocks(1),
+      rightBlocks(1)
 {}
 
 /**
@@ -82,6 +89,27 @@ services::Status Parameter::check() const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter() : interface1::Parameter(), neighborhoodEngine(bruteForceEngine) {}
+
+Parameter::Parameter(double _epsilon, size_t _minObservations)
+    : interface1::Parameter(_epsilon, _minObservations), neighborhoodEngine(bruteForceEngine)
+{}
+
+Parameter::Parameter(const Parameter & other) : interface1::Parameter(other), neighborhoodEngine(other.neighborhoodEngine) {}
+
+services::Status Parameter::check() const
+{
+    services::Status s = interface1::Parameter::check();
+    DAAL_CHECK_STATUS_VAR(s);
+    DAAL_CHECK_EX(neighborhoodEngine == bruteForceEngine || neighborhoodEngine == gridEngine, services::ErrorIncorrectParameter,
+                  services::ParameterName, neighborhoodEngineStr());
+    return s;
+}
+
+} // namespace interface2
 } // namespace dbscan
 } // namespace algorithms
 } // namespace daal
@@ -34,6 +34,7 @@
 #include "src/externals/service_math.h"
 #include "src/algorithms/service_kernel_math.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_sort.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -50,6 +51,7 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE        32
 #define __DBSCAN_DEFAULT_VECTOR_SIZE       32
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 64
+#define __DBSCAN_GRID_ENGINE_BLOCK_SIZE    1024
 
 template <typename T, CpuType cpu>
 class Queue
@@ -634,6 +636,369 @@ private:
     FPType _p;
 };
 
+/**
+ *  Returns true if neighborhoods of observations should be computed with GridNeighborhoodEngine
+ */
+inline bool isGridEngineUsed(const daal::algorithms::Parameter * par)
+{
+    const interface2::Parameter * par2 = dynamic_cast<const interface2::Parameter *>(par);
+    return par2 && par2->neighborhoodEngine == gridEngine;
+}
+
+/**
+ *  Computes neighborhoods of observations of the table using the uniform grid.
+ *  The cell size is not less than epsilon, so the neighbors of the observation
+ *  lie in the same or in the adjacent cells. Observations are sorted by cells,
+ *  so the grid takes O(n * dim) memory and the query of the single observation
+ *  costs O(min(3^dim * log(nCells), nCells * dim)) plus the number of observations
+ *  in the adjacent cells. The adjacent cells are enumerated only if there are fewer
+ *  of them than the non-empty cells, otherwise the non-empty cells are scanned.
+ */
+template <typename FPType, CpuType cpu>
+class GridNeighborhoodEngine
+{
+    DAAL_NEW_DELETE();
+
+    struct CellEntry
+    {
+        DAAL_UINT64 key;
+        size_t index;
+    };
+
+public:
+    GridNeighborhoodEngine(const NumericTable * table, const NumericTable * weights, FPType eps)
+        : _table(table),
+          _weights(weights),
+          _eps(eps),
+          _nRows(table->getNumberOfRows()),
+          _dim(table->getNumberOfColumns()),
+          _cellSize(0),
+          _nCells(0),
+          _tlsCoords(3 * table->getNumberOfColumns())
+    {}
+
+    GridNeighborhoodEngine(const GridNeighborhoodEngine &) = delete;
+    GridNeighborhoodEngine & operator=(const GridNeighborhoodEngine &) = delete;
+
+    services::Status init()
+    {
+        if (_nRows == 0 || _dim == 0)
+        {
+            return services::Status();
+        }
+
+        _dataRows.set(const_cast<NumericTable *>(_table), 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS(_dataRows);
+        const FPType * const data = _dataRows.get();
+
+        FPType * const minValues = _minValues.reset(_dim);
+        DAAL_CHECK_MALLOC(minValues);
+        TArray<FPType, cpu> maxValuesArray(_dim);
+        FPType * const maxValues = maxValuesArray.get();
+        DAAL_CHECK_MALLOC(maxValues);
+
+        for (size_t j = 0; j < _dim; j++)
+        {
+            minValues[j] = maxValues[j] = data[j];
+        }
+        for (size_t i = 1; i < _nRows; i++)
+        {
+            const FPType * const row = data + i * _dim;
+            for (size_t j = 0; j < _dim; j++)
+            {
+                minValues[j] = (row[j] < minValues[j]) ? row[j] : minValues[j];
+                maxValues[j] = (row[j] > maxValues[j]) ? row[j] : maxValues[j];
+            }
+        }
+
+        FPType maxRange = 0;
+        for (size_t j = 0; j < _dim; j++)
+        {
+            maxRange = (maxValues[j] - minValues[j] > maxRange) ? maxValues[j] - minValues[j] : maxRange;
+        }
+
+        /* Cells are enlarged if the grid with the cell size equal to epsilon cannot be indexed with 62-bit keys */
+        const size_t bitsPerDim         = 62 / _dim;
+        const DAAL_UINT64 maxCellsInDim = (DAAL_UINT64)1 << bitsPerDim;
+        const FPType minCellSize        = (maxCellsInDim > 1) ? maxRange / FPType(maxCellsInDim - 1) : FPType(2) * maxRange;
+        _cellSize                       = (_eps > minCellSize) ? _eps : minCellSize;
+        if (!(_cellSize > 0))
+        {
+            _cellSize = FPType(1);
+        }
+
+        DAAL_UINT64 * const nCellsInDim = _nCellsInDim.reset(_dim);
+        DAAL_CHECK_MALLOC(nCellsInDim);
+        DAAL_UINT64 * const strides = _strides.reset(_dim);
+        DAAL_CHECK_MALLOC(strides);
+
+        for (size_t j = 0; j < _dim; j++)
+        {
+            const DAAL_UINT64 nCells = (DAAL_UINT64)((maxValues[j] - minValues[j]) / _cellSize) + 1;
+            nCellsInDim[j]           = (nCells < maxCellsInDim) ? nCells : maxCellsInDim;
+            strides[j]               = (j == 0) ? 1 : strides[j - 1] * nCellsInDim[j - 1];
+        }
+
+        TArray<CellEntry, cpu> entriesArray(_nRows);
+        CellEntry * const entries = entriesArray.get();
+        DAAL_CHECK_MALLOC(entries);
+
+        const size_t blockSize = __DBSCAN_GRID_ENGINE_BLOCK_SIZE;
+        const size_t nBlocks   = _nRows / blockSize + !!(_nRows % blockSize);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * blockSize;
+            const size_t end   = (iBlock + 1 == nBlocks) ? _nRows : begin + blockSize;
+            for (size_t i = begin; i < end; i++)
+            {
+                DAAL_UINT64 key = 0;
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    key += getCoordinate(data[i * _dim + j], j) * strides[j];
+                }
+                entries[i].key   = key;
+                entries[i].index = i;
+            }
+        });
+
+        algorithms::internal::introSort<cpu>(entries, entries + _nRows, [](const CellEntry & a, const CellEntry & b) -> bool {
+            return (a.key < b.key) || (a.key == b.key && a.index < b.index);
+        });
+
+        size_t * const sortedIndices = _sortedIndices.reset(_nRows);
+        DAAL_CHECK_MALLOC(sortedIndices);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows, _dim);
+        FPType * const sortedData = _sortedData.reset(_nRows * _dim);
+        DAAL_CHECK_MALLOC(sortedData);
+
+        ReadRows<FPType, cpu> weightsRows;
+        if (_weights)
+        {
+            weightsRows.set(const_cast<NumericTable *>(_weights), 0, _nRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsRows);
+        }
+        const FPType * const weights = weightsRows.get();
+        FPType * const sortedWeights = _sortedWeights.reset(_nRows);
+        DAAL_CHECK_MALLOC(sortedWeights);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t begin = iBlock * blockSize;
+            const size_t end   = (iBlock + 1 == nBlocks) ? _nRows : begin + blockSize;
+            for (size_t i = begin; i < end; i++)
+            {
+                const size_t index = entries[i].index;
+                sortedIndices[i]   = index;
+                sortedWeights[i]   = weights ? weights[index] : FPType(1);
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    sortedData[i * _dim + j] = data[index * _dim + j];
+                }
+            }
+        });
+
+        _nCells = 1;
+        for (size_t i = 1; i < _nRows; i++)
+        {
+            _nCells += (entries[i].key != entries[i - 1].key);
+        }
+
+        DAAL_UINT64 * const cellKeys = _cellKeys.reset(_nCells);
+        DAAL_CHECK_MALLOC(cellKeys);
+        size_t * const cellStarts = _cellStarts.reset(_nCells + 1);
+        DAAL_CHECK_MALLOC(cellStarts);
+
+        size_t cell   = 0;
+        cellKeys[0]   = entries[0].key;
+        cellStarts[0] = 0;
+        for (size_t i = 1; i < _nRows; i++)
+        {
+            if (entries[i].key != entries[i - 1].key)
+            {
+                cell++;
+                cellKeys[cell]   = entries[i].key;
+                cellStarts[cell] = i;
+            }
+        }
+        cellStarts[_nCells] = _nRows;
+
+        return services::Status();
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        if (_nCells == 0)
+        {
+            return services::Status();
+        }
+
+        SafeStatus safeStat;
+
+        const FPType epsP = _eps * _eps;
+        /* Search range is extended by the relative margin, so the cells are not missed due to rounding errors */
+        const FPType range = _eps * (FPType(1) + FPType(1e-5));
+
+        daal::threader_for(n, n, [&](size_t i) {
+            DAAL_UINT64 * const lower = _tlsCoords.local();
+            DAAL_CHECK_MALLOC_THR(lower);
+            DAAL_UINT64 * const upper = lower + _dim;
+            DAAL_UINT64 * const cur   = upper + _dim;
+
+            if (doReset)
+            {
+                neighs[i].reset();
+            }
+
+            const FPType * const point = _dataRows.get() + indices[i] * _dim;
+            for (size_t j = 0; j < _dim; j++)
+            {
+                lower[j] = cur[j] = getCoordinate(point[j] - range, j);
+                upper[j]          = getCoordinate(point[j] + range, j);
+            }
+
+            if (!isEnumerationCheaper(lower, upper))
+            {
+                /* Scans the non-empty cells, as the number of the adjacent cells grows exponentially with the dimension */
+                for (size_t cell = 0; cell < _nCells; cell++)
+                {
+                    if (isCellInRange(_cellKeys[cell], lower, upper))
+                    {
+                        DAAL_CHECK_MALLOC_THR(addNeighborsInCell(point, cell, epsP, neighs[i]));
+                    }
+                }
+                return;
+            }
+
+            /* Enumerates the cells with coordinates in the range [lower, upper] in each dimension */
+            bool isLastCell = false;
+            while (!isLastCell)
+            {
+                DAAL_UINT64 key = 0;
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    key += cur[j] * _strides[j];
+                }
+
+                size_t cell = 0;
+                if (findCell(key, cell))
+                {
+                    DAAL_CHECK_MALLOC_THR(addNeighborsInCell(point, cell, epsP, neighs[i]));
+                }
+
+                isLastCell = true;
+                for (size_t j = 0; j < _dim && isLastCell; j++)
+                {
+                    if (cur[j] < upper[j])
+                    {
+                        cur[j]++;
+                        isLastCell = false;
+                    }
+                    else
+                    {
+                        cur[j] = lower[j];
+                    }
+                }
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+private:
+    /* Returns true if there are fewer cells in the range [lower, upper] than the non-empty cells */
+    bool isEnumerationCheaper(const DAAL_UINT64 * lower, const DAAL_UINT64 * upper) const
+    {
+        DAAL_UINT64 nCellsInRange = 1;
+        for (size_t j = 0; j < _dim; j++)
+        {
+            nCellsInRange *= upper[j] - lower[j] + 1;
+            if (nCellsInRange > _nCells)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isCellInRange(DAAL_UINT64 key, const DAAL_UINT64 * lower, const DAAL_UINT64 * upper) const
+    {
+        for (size_t j = 0; j < _dim; j++)
+        {
+            const DAAL_UINT64 coord = (key / _strides[j]) % _nCellsInDim[j];
+            if (coord < lower[j] || coord > upper[j])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Returns false if the neighborhood cannot be extended */
+    bool addNeighborsInCell(const FPType * point, size_t cell, FPType epsP, Neighborhood<FPType, cpu> & neigh) const
+    {
+        for (size_t k = _cellStarts[cell]; k < _cellStarts[cell + 1]; k++)
+        {
+            if (distancePow2<FPType, cpu>(point, _sortedData.get() + k * _dim, _dim) <= epsP)
+            {
+                if (neigh.add(_sortedIndices[k], _sortedWeights[k]))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    DAAL_UINT64 getCoordinate(FPType value, size_t j) const
+    {
+        if (!(value > _minValues[j]))
+        {
+            return 0;
+        }
+        const FPType coord = (value - _minValues[j]) / _cellSize;
+        return (coord < FPType(_nCellsInDim[j] - 1)) ? (DAAL_UINT64)coord : _nCellsInDim[j] - 1;
+    }
+
+    bool findCell(DAAL_UINT64 key, size_t & cell) const
+    {
+        size_t left  = 0;
+        size_t right = _nCells;
+        while (left < right)
+        {
+            const size_t mid = left + (right - left) / 2;
+            if (_cellKeys[mid] < key)
+            {
+                left = mid + 1;
+            }
+            else
+            {
+                right = mid;
+            }
+        }
+        cell = left;
+        return (left < _nCells) && (_cellKeys[left] == key);
+    }
+
+    const NumericTable * _table;
+    const NumericTable * _weights;
+    FPType _eps;
+
+    size_t _nRows;
+    size_t _dim;
+    FPType _cellSize;
+    size_t _nCells;
+
+    ReadRows<FPType, cpu> _dataRows;
+    TArray<FPType, cpu> _minValues;
+    TArray<DAAL_UINT64, cpu> _nCellsInDim;
+    TArray<DAAL_UINT64, cpu> _strides;
+    TArray<size_t, cpu> _sortedIndices;
+    TArray<FPType, cpu> _sortedData;
+    TArray<FPType, cpu> _sortedWeights;
+    TArray<DAAL_UINT64, cpu> _cellKeys;
+    TArray<size_t, cpu> _cellStarts;
+    TlsMem<DAAL_UINT64, cpu> _tlsCoords;
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
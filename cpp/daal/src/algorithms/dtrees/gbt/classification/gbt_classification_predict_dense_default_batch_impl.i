@@ -73,6 +73,7 @@ public:
         this->_aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(this->_aTree.get());
         for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+        DAAL_CHECK_STATUS_VAR(this->_compactTrees.init(this->_aTree.get(), nTreesTotal, this->_data->getNumberOfRows()));
         const auto nRows = this->_data->getNumberOfRows();
         services::Status s;
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(algorithmFPType));
@@ -193,6 +194,7 @@ protected:
     NumericTable * _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
+    gbt::prediction::internal::CompactTrees<cpu> _compactTrees;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +226,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    DAAL_CHECK_STATUS_VAR(this->_compactTrees.init(this->_aTree.get(), nTreesTotal, this->_data->getNumberOfRows()));
 
     DimType dim(*_data, nTreesTotal);
 
@@ -234,6 +237,12 @@ template <typename algorithmFPType, CpuType cpu>
 void PredictMulticlassTask<algorithmFPType, cpu>::predictByTrees(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses,
                                                                  const algorithmFPType * x)
 {
+    if (!this->_compactTrees.isEmpty())
+    {
+        for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+            val[iTree % nClasses] += this->_compactTrees.predict(iTree, this->_featHelper, x);
+        return;
+    }
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
     {
         val[iTree % nClasses] +=
@@ -248,7 +257,10 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesVector(algorithm
     algorithmFPType v[VECTOR_BLOCK_SIZE];
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
     {
-        gbt::prediction::internal::predictForTreeVector<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x, v);
+        if (this->_compactTrees.isEmpty())
+            gbt::prediction::internal::predictForTreeVector<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x, v);
+        else
+            this->_compactTrees.predictVector(iTree, this->_featHelper, x, v);
 
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
@@ -81,6 +81,17 @@ Status Parameter::check() const
     return gbt::training::checkImpl(*this);
 }
 } // namespace interface2
+
+namespace interface3
+{
+Status Parameter::check() const
+{
+    Status s = interface2::Parameter::check();
+    DAAL_CHECK_STATUS_VAR(s);
+    DAAL_CHECK_EX((maxLeaves != 1), ErrorIncorrectParameter, ParameterName, maxLeavesStr());
+    return s;
+}
+} // namespace interface3
 } // namespace training
 } // namespace classification
 } // namespace gbt
@@ -30,6 +30,8 @@
 #include "src/algorithms/dtrees/dtrees_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/dtrees_feature_type_helper.h"
 #include "src/algorithms/dtrees/gbt/gbt_internal.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_environment.h"
 
 namespace daal
 {
@@ -124,6 +126,228 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     return values[i];
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Inference-only compact layout of the model trees.
+// The trees of the model are stored as complete binary heaps of depth getMaxLvl() with the leaves
+// replicated down to the last level. Such a layout wastes memory and cache on sparse deep trees
+// and makes every tree cost getMaxLvl() steps regardless of the depth of its leaves.
+// CompactTrees packs only the split and leaf nodes of all trees into contiguous arrays in
+// breadth-first order. The children of a split node are stored next to each other, so only the
+// index of the left child is kept; leaves have zero left child index.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <CpuType cpu>
+class CompactTrees
+{
+public:
+    /* Minimal ratio between the number of heap nodes and the number of actual nodes of the trees
+       for which the compact layout pays off */
+    static const size_t sparsityRatio = 4;
+
+    CompactTrees() : _nNodes(0) {}
+
+    /* Builds the compact layout if the heaps of the trees do not fit into the last level cache and
+       the trees are sparse enough, leaves the object empty otherwise. Heaps that fit into the cache
+       are processed faster with the branch-free walk. The layout is built for every prediction call,
+       so it is skipped when nRows rows do not visit the trees often enough to amortize its construction. */
+    template <typename DecisionTreeType>
+    services::Status init(const DecisionTreeType * const * aTree, const size_t nTrees, const size_t nRows)
+    {
+        _nNodes = 0;
+
+        size_t nHeapNodes       = 0;
+        FeatureIndexType maxLvl = 0;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            nHeapNodes += aTree[iTree]->getNumberOfNodes();
+            maxLvl = services::internal::max<cpu, FeatureIndexType>(maxLvl, aTree[iTree]->getMaxLvl());
+        }
+        if (nHeapNodes * (sizeof(ModelFPType) + sizeof(FeatureIndexType)) <= services::internal::getLLCacheSize()) return services::Status();
+        /* The construction visits up to nHeapNodes / sparsityRatio nodes, the prediction visits nTrees trees per row */
+        if (nRows * nTrees * sparsityRatio < nHeapNodes) return services::Status();
+
+        services::internal::TArray<size_t, cpu> stackArr(maxLvl + 2);
+        services::internal::TArray<size_t, cpu> treeSizeArr(nTrees);
+        size_t * const stack    = stackArr.get();
+        size_t * const treeSize = treeSizeArr.get();
+        DAAL_CHECK_MALLOC(stack && treeSize);
+
+        size_t nNodes         = 0;
+        size_t maxNodesInTree = 0;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            const DecisionTreeType & t = *aTree[iTree];
+            size_t nStack              = 1;
+            stack[0]                   = 0;
+            treeSize[iTree]            = 0;
+            while (nStack)
+            {
+                const size_t idx = stack[--nStack];
+                ++treeSize[iTree];
+                if (!isLeaf(t, idx))
+                {
+                    stack[nStack++] = 2 * idx + 1;
+                    stack[nStack++] = 2 * idx + 2;
+                }
+            }
+            nNodes += treeSize[iTree];
+            maxNodesInTree = services::internal::max<cpu, size_t>(maxNodesInTree, treeSize[iTree]);
+        }
+
+        if (nHeapNodes < sparsityRatio * nNodes || nNodes > size_t(FeatureIndexType(-1))) return services::Status();
+
+        _featureIndexes.reset(nNodes);
+        _values.reset(nNodes);
+        _leftChildren.reset(nNodes);
+        _roots.reset(nTrees);
+        services::internal::TArray<size_t, cpu> heapIdxArr(maxNodesInTree);
+        size_t * const heapIdx = heapIdxArr.get();
+        DAAL_CHECK_MALLOC(_featureIndexes.get() && _values.get() && _leftChildren.get() && _roots.get() && heapIdx);
+
+        FeatureIndexType * const fi = _featureIndexes.get();
+        ModelFPType * const fv      = _values.get();
+        FeatureIndexType * const lc = _leftChildren.get();
+
+        size_t root = 0;
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            const DecisionTreeType & t                 = *aTree[iTree];
+            const ModelFPType * const values           = t.getSplitPoints();
+            const FeatureIndexType * const featIndexes = t.getFeatureIndexesForSplit();
+
+            _roots[iTree] = FeatureIndexType(root);
+            heapIdx[0]    = 0;
+            size_t nAdded = 1;
+            for (size_t i = 0; i < nAdded; ++i)
+            {
+                const size_t idx = heapIdx[i];
+                fv[root + i]     = values[idx];
+                if (isLeaf(t, idx))
+                {
+                    fi[root + i] = 0;
+                    lc[root + i] = 0;
+                }
+                else
+                {
+                    fi[root + i]      = featIndexes[idx];
+                    lc[root + i]      = FeatureIndexType(root + nAdded);
+                    heapIdx[nAdded++] = 2 * idx + 1;
+                    heapIdx[nAdded++] = 2 * idx + 2;
+                }
+            }
+            DAAL_ASSERT(nAdded == treeSize[iTree]);
+            root += nAdded;
+        }
+        _nNodes = nNodes;
+        return services::Status();
+    }
+
+    bool isEmpty() const { return _nNodes == 0; }
+
+    /* Same as predictForTree() applied to the tree iTree */
+    template <typename algorithmFPType>
+    algorithmFPType predict(const size_t iTree, const FeatureTypes & featTypes, const algorithmFPType * x) const
+    {
+        const FeatureIndexType * const fi = _featureIndexes.get();
+        const ModelFPType * const fv      = _values.get();
+        const FeatureIndexType * const lc = _leftChildren.get();
+
+        FeatureIndexType i = _roots[iTree];
+        if (featTypes.hasUnorderedFeatures())
+        {
+            for (; lc[i];)
+            {
+                i = lc[i] + (featTypes.isUnordered(fi[i]) ? int(x[fi[i]]) != int(fv[i]) : x[fi[i]] > fv[i]);
+            }
+        }
+        else
+        {
+            for (; lc[i];)
+            {
+                i = lc[i] + (x[fi[i]] > fv[i]);
+            }
+        }
+        return fv[i];
+    }
+
+    /* Same as predictForTreeVector() applied to the tree iTree. The rows of the block are moved
+       down the tree simultaneously until all of them reach the leaves. */
+    template <typename algorithmFPType>
+    void predictVector(const size_t iTree, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[]) const
+    {
+        const FeatureIndexType * const fi = _featureIndexes.get();
+        const ModelFPType * const fv      = _values.get();
+        const FeatureIndexType * const lc = _leftChildren.get();
+        const FeatureIndexType nFeat      = featTypes.getNumberOfFeatures();
+
+        FeatureIndexType i[VECTOR_BLOCK_SIZE];
+        services::internal::service_memset_seq<FeatureIndexType, cpu>(i, _roots[iTree], VECTOR_BLOCK_SIZE);
+
+        const bool hasUnorderedFeatures = featTypes.hasUnorderedFeatures();
+        for (FeatureIndexType nSplits = VECTOR_BLOCK_SIZE; nSplits;)
+        {
+            nSplits = 0;
+            if (hasUnorderedFeatures)
+            {
+                for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+                {
+                    const FeatureIndexType idx          = i[k];
+                    const FeatureIndexType left         = lc[idx];
+                    const FeatureIndexType splitFeature = fi[idx];
+                    const ModelFPType valueFromDataSet  = x[splitFeature + k * nFeat];
+                    const FeatureIndexType sn = featTypes.isUnordered(splitFeature) ? valueFromDataSet != fv[idx] : valueFromDataSet > fv[idx];
+
+                    i[k] = left ? left + sn : idx;
+                    nSplits += (left != 0);
+                }
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+                {
+                    const FeatureIndexType idx  = i[k];
+                    const FeatureIndexType left = lc[idx];
+                    const FeatureIndexType sn   = x[fi[idx] + k * nFeat] > fv[idx];
+
+                    i[k] = left ? left + sn : idx;
+                    nSplits += (left != 0);
+                }
+            }
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
+        {
+            v[k] = fv[i[k]];
+        }
+    }
+
+protected:
+    /* Node idx of the heap is a leaf if it is on the last level, or if both its children are the
+       copies of it made to fill the heap */
+    template <typename DecisionTreeType>
+    static bool isLeaf(const DecisionTreeType & t, const size_t idx)
+    {
+        if (idx >= (t.getNumberOfNodes() >> 1)) return true;
+
+        const ModelFPType * const values           = t.getSplitPoints();
+        const FeatureIndexType * const featIndexes = t.getFeatureIndexesForSplit();
+        const size_t left                          = 2 * idx + 1;
+        const size_t right                         = left + 1;
+        return values[left] == values[idx] && featIndexes[left] == featIndexes[idx] && values[right] == values[idx]
+               && featIndexes[right] == featIndexes[idx];
+    }
+
+protected:
+    services::internal::TArray<FeatureIndexType, cpu> _featureIndexes; /* Split feature of a split node, zero for a leaf */
+    services::internal::TArray<ModelFPType, cpu> _values;              /* Split value of a split node, response of a leaf */
+    services::internal::TArray<FeatureIndexType, cpu> _leftChildren;   /* Index of the left child of a split node, zero for a leaf */
+    services::internal::TArray<FeatureIndexType, cpu> _roots;          /* Index of the root of every tree */
+    size_t _nNodes;
+};
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
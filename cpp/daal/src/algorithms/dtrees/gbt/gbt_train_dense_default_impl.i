@@ -70,6 +70,7 @@ public:
         return _loss;
     }
     const Parameter & par() const { return _par; }
+    size_t maxLeaves() const { return _maxLeaves; }
     const DataHelperType & dataHelper() const { return _dataHelper; }
     const FeatureTypes & featTypes() const { return _featHelper; }
     RowIndexType nFeaturesPerNode() const { return _nFeaturesPerNode; }
@@ -129,10 +130,12 @@ protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
 
     TrainBatchTaskBase(const NumericTable * x, const NumericTable * y, const Parameter & par, const dtrees::internal::FeatureTypes & featTypes,
-                       const dtrees::internal::IndexedFeatures * indexedFeatures, engines::internal::BatchBaseImpl & engine, size_t nClasses)
+                       const dtrees::internal::IndexedFeatures * indexedFeatures, engines::internal::BatchBaseImpl & engine, size_t nClasses,
+                       size_t maxLeaves)
         : _data(x),
           _resp(y),
           _par(par),
+          _maxLeaves(maxLeaves),
           _engine(engine),
           _nClasses(nClasses),
           _nSamples(par.observationsPerTreeFraction * x->getNumberOfRows()),
@@ -198,6 +201,7 @@ protected:
     const NumericTable * _data;
     const NumericTable * _resp;
     const Parameter & _par;
+    const size_t _maxLeaves;
     const RowIndexType _nSamples;
     const RowIndexType _nFeaturesPerNode;
     const int _nThreadsMax;
@@ -336,8 +340,8 @@ public:
 
     TrainBatchTaskBaseXBoost(HostAppIface * hostApp, const NumericTable * x, const NumericTable * y, const Parameter & par,
                              const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
-                             engines::internal::BatchBaseImpl & engine, size_t nClasses)
-        : super(x, y, par, featTypes, indexedFeatures, engine, nClasses), _hostApp(hostApp)
+                             engines::internal::BatchBaseImpl & engine, size_t nClasses, size_t maxLeaves)
+        : super(x, y, par, featTypes, indexedFeatures, engine, nClasses, maxLeaves), _hostApp(hostApp)
     {}
 
     //loss function gradient and hessian values calculated in f() points
@@ -365,7 +369,7 @@ protected:
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
 services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
-                                 const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
+                                 const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses, size_t maxLeaves,
                                  dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                                  algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                                  algorithmFPType * ptrTotalGain)
@@ -376,7 +380,7 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     const bool inexactWithHistMethod =
         !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
 
-    TaskType task(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, engine, nClasses);
+    TaskType task(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, engine, nClasses, maxLeaves);
     DAAL_CHECK_STATUS(s, task.init());
 
     const size_t nTrees = task.nTrees();
@@ -558,14 +562,14 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
-                             const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
+                             const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses, size_t maxLeaves,
                              dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                              algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                              algorithmFPType * ptrTotalGain)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes,
-                                                                              res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, maxLeaves, indexedFeatures,
+                                                                              featTypes, res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
                                                                               ptrTotalGain); // TODO: remove int
 }
 
@@ -115,7 +115,7 @@ protected:
         buildRightnode(newTasks, nTask, res, impRight);
     }
 
-    void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
     {
         NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -126,7 +126,7 @@ protected:
         }
     }
 
-    void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
         NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -181,7 +181,8 @@ protected:
     MergedResultType * _prevRes;
 };
 
-template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename UpdaterType, typename MergedUpdaterType, CpuType cpu>
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename UpdaterType, typename MergedUpdaterType,
+          typename SiblingUpdaterType, CpuType cpu>
 class MergedNodesCreator : public DefaultNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, cpu>
 {
 public:
@@ -202,6 +203,34 @@ protected:
             MergedUpdaterType(super::_data, node1, node2, super::_prevRes);
     }
 
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res)
+    {
+        typename super::NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
+        typename super::ImpurityType impRight;
+        impRight.g = _node.imp.g - _split.left.g;
+        impRight.h = _node.imp.h - _split.left.h;
+        typename super::NodeInfoType leaf(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
+        if (!buildBySibling(newTasks, nTask, leaf, node)) super::buildLeftnode(newTasks, nTask, res);
+    }
+
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
+    {
+        typename super::NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
+        typename super::NodeInfoType leaf(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
+        if (!buildBySibling(newTasks, nTask, leaf, node)) super::buildRightnode(newTasks, nTask, res, impRight);
+    }
+
+    // GHSums of the node are computed as the difference between the parent GHSums and the ones of its leaf sibling
+    // if the sibling has less observations
+    bool buildBySibling(GbtTask ** newTasks, size_t & nTask, typename super::NodeInfoType & leaf, typename super::NodeInfoType & node)
+    {
+        if (!_prevRes || leaf.n >= node.n) return false;
+        newTasks[nTask++] = new (services::internal::service_scalable_calloc<SiblingUpdaterType, cpu>(1))
+            SiblingUpdaterType(super::_data, leaf, node, super::_prevRes);
+        _prevRes = nullptr;
+        return true;
+    }
+
     using super::_data;
     using super::_split;
     using super::_node;
@@ -31,6 +31,9 @@
 #include "src/algorithms/dtrees/gbt/gbt_train_aux.i"
 #include "src/services/service_defines.h"
 #include "src/algorithms/dtrees/gbt/gbt_train_hist_kernel.i"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(gbt.training.hist);
 
 namespace daal
 {
@@ -361,6 +364,8 @@ public:
         const size_t iStart = _iBlock * _blockSize + _node.iStart;
         const size_t iEnd   = (((_iBlock + 1) * _blockSize > _node.n) ? _node.iStart + _node.n : iStart + _blockSize);
 
+        DAAL_ITTNOTIFY_SCOPED_TASK_WITH_BYTES(hist.computeGHSumsByRows, (iEnd - iStart) * nFeatures * sizeof(BinIndexType));
+
         auto * local               = _res->local();
         GHSumType * aGHSum         = local->ghSum;
         algorithmFPType * aGHSumFP = (algorithmFPType *)local->ghSum;
@@ -167,6 +167,12 @@ public:
         DAAL_CHECK_MALLOC(_aBestSplitIdxBuf.get() && _aSample.get());
         DAAL_CHECK_MALLOC(initMemHelper());
         if (_ctx.isParallelNodes() && !_taskGroup) DAAL_CHECK_MALLOC((_taskGroup = new daal::task_group()));
+        if (_ctx.maxLeaves())
+        {
+            _aBestFirstTasks.reset(2 * _ctx.maxLeaves());
+            _aBestFirstNodes.reset(_ctx.maxLeaves());
+            DAAL_CHECK_MALLOC(_aBestFirstTasks.get() && _aBestFirstNodes.get());
+        }
         return services::Status();
     }
     daal::task_group * taskGroup() { return _taskGroup; }
@@ -232,19 +238,19 @@ protected:
         {
             using Mode    = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Mode>(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Mode>(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else
         {
             using Mode    = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree<Mode>(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
 
         if (taskGroup()) taskGroup()->wait();
@@ -327,6 +333,26 @@ protected:
     }
     void buildSplit(GbtTask * task);
 
+    template <typename SplitMode>
+    void buildTree(GbtTask * root)
+    {
+        if (_ctx.maxLeaves())
+            buildBestFirst<SplitMode>(root);
+        else
+            buildSplit(root);
+    }
+
+    template <typename SplitMode>
+    void buildBestFirst(GbtTask * root);
+
+    // Node with the found split waiting for the best-first growth
+    struct BestFirstNode
+    {
+        GbtTask * task;
+        size_t iNode;
+        algorithmFPType impurityDecrease;
+    };
+
 protected:
     CommonCtx & _ctx;
     size_t _iTree = 0;
@@ -335,6 +361,8 @@ protected:
     typedef dtrees::internal::TVector<RowIndexType, cpu> IndexTypeArray;
     mutable IndexTypeArray _aBestSplitIdxBuf;
     mutable IndexTypeArray _aSample;
+    dtrees::internal::TVector<GbtTask *, cpu> _aBestFirstTasks;
+    dtrees::internal::TVector<BestFirstNode, cpu> _aBestFirstNodes;
     MemHelperType * _memHelper    = nullptr;
     daal::task_group * _taskGroup = nullptr;
 };
@@ -417,6 +445,77 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     }
 }
 
+// Grows the tree best-first: the node with the largest loss reduction is split next
+// until the number of leaves reaches maxLeaves or no node can be split
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+template <typename SplitMode>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildBestFirst(GbtTask * root)
+{
+    using UpdaterType = UpdaterBase<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+
+    const size_t maxLeaves = _ctx.maxLeaves();
+    GbtTask ** aTasks      = _aBestFirstTasks.get();
+    BestFirstNode * aNodes = _aBestFirstNodes.get();
+    size_t nAllTasks       = 0;
+    size_t nNodes          = 0;
+    size_t nLeaves         = 1;
+
+    GbtTask * newTasks[2];
+    newTasks[0]   = root;
+    size_t nTasks = 1;
+    for (;;)
+    {
+        for (size_t i = 0; i < nTasks; ++i)
+        {
+            UpdaterType * updater = static_cast<UpdaterType *>(newTasks[i]);
+            updater->execute();
+            aTasks[nAllTasks++] = updater;
+
+            for (size_t iNode = 0; iNode < updater->nNodes(); ++iNode)
+            {
+                algorithmFPType impurityDecrease = 0;
+                if (updater->isSplitFound(iNode, impurityDecrease))
+                {
+                    aNodes[nNodes].task             = updater;
+                    aNodes[nNodes].iNode            = iNode;
+                    aNodes[nNodes].impurityDecrease = impurityDecrease;
+                    ++nNodes;
+                }
+                else
+                {
+                    size_t nLeafTasks = 0;
+                    updater->getNodeTasks(iNode, false, nullptr, nLeafTasks);
+                }
+            }
+        }
+        if (!nNodes || nLeaves >= maxLeaves) break;
+
+        size_t iBest = 0;
+        for (size_t i = 1; i < nNodes; ++i)
+        {
+            if (aNodes[i].impurityDecrease > aNodes[iBest].impurityDecrease) iBest = i;
+        }
+        const BestFirstNode best = aNodes[iBest];
+        aNodes[iBest]            = aNodes[--nNodes];
+
+        nTasks = 0;
+        static_cast<UpdaterType *>(best.task)->getNodeTasks(best.iNode, true, newTasks, nTasks);
+        ++nLeaves;
+    }
+
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        size_t nLeafTasks = 0;
+        static_cast<UpdaterType *>(aNodes[i].task)->getNodeTasks(aNodes[i].iNode, false, nullptr, nLeafTasks);
+    }
+
+    for (size_t i = 0; i < nAllTasks; ++i)
+    {
+        aTasks[i]->~GbtTask();
+        service_scalable_free<GbtTask, cpu>(aTasks[i]);
+    }
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu> * TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::create(CommonCtx & ctx)
 {
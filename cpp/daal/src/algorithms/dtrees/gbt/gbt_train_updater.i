@@ -41,6 +41,8 @@ template <typename algorithmFPType, typename RowIndexType, typename BinIndexType
 class UpdaterByRows;
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
 class MergedUpdaterByRows;
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class SiblingUpdaterByRows;
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MemorySafetySplitMode
@@ -74,9 +76,10 @@ template <typename algorithmFPType, typename RowIndexType, typename BinIndexType
 struct InexactSplitMode
 {
 protected:
-    using ThisType          = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using UpdaterType       = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
-    using MergedUpdaterType = MergedUpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using ThisType           = InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using UpdaterType        = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using MergedUpdaterType  = MergedUpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+    using SiblingUpdaterType = SiblingUpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
 
 public:
     using ResultType = hist::Result<algorithmFPType, cpu>;
@@ -87,7 +90,8 @@ public:
         hist::FindMaxImpurityDecreaseWithGHSumsReduceTaskMerged<algorithmFPType, RowIndexType, BinIndexType, MergedResult<ResultType, cpu>, cpu>;
     using ComputeGHSumsTask = hist::ComputeGHSumsByRowsTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
     using PartitionType     = DefaultPartitionTask<algorithmFPType, RowIndexType, BinIndexType, cpu>;
-    using NodesCreatorType  = MergedNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, MergedUpdaterType, cpu>;
+    using NodesCreatorType =
+        MergedNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, MergedUpdaterType, SiblingUpdaterType, cpu>;
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
@@ -129,6 +133,26 @@ public:
         kidsCreator.create(_iFeature, newTasks, nTasks);
     }
 
+    // Interface used by the best-first tree growth.
+    // After execute() every node handled by the updater is either split into the kids or turned into a leaf independently.
+
+    // Number of the nodes handled by the updater
+    virtual size_t nNodes() const { return 1; }
+
+    // Returns true if the split has been found for the node, impurityDecrease is the loss reduction of this split
+    virtual bool isSplitFound(size_t iNode, algorithmFPType & impurityDecrease) const
+    {
+        impurityDecrease = _bestSplit.impurityDecrease;
+        return _iFeature >= 0;
+    }
+
+    // Splits the node and spawns the tasks for its kids if bSplit is true, makes the node a leaf otherwise
+    virtual void getNodeTasks(size_t iNode, bool bSplit, GbtTask ** newTasks, size_t & nTasks)
+    {
+        NodesCreatorType kidsCreator(_data, _bestSplit, _node, _result);
+        kidsCreator.create(bSplit ? _iFeature : -1, newTasks, nTasks);
+    }
+
 protected:
     const IndexType * chooseFeatures()
     {
@@ -298,11 +322,30 @@ public:
         NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
         kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
 
-        if (_prevRes)
+        releasePrevResult();
+    }
+
+    virtual size_t nNodes() const DAAL_C11_OVERRIDE { return 2; }
+
+    virtual bool isSplitFound(size_t iNode, algorithmFPType & impurityDecrease) const DAAL_C11_OVERRIDE
+    {
+        impurityDecrease = iNode ? _bestSplit2.impurityDecrease : _bestSplit1.impurityDecrease;
+        return (iNode ? _iFeature2 : _iFeature1) >= 0;
+    }
+
+    virtual void getNodeTasks(size_t iNode, bool bSplit, GbtTask ** newTasks, size_t & nTasks) DAAL_C11_OVERRIDE
+    {
+        if (iNode)
         {
-            _prevRes->release(_data);
-            _prevRes = nullptr;
+            NodesCreatorType kidsCreator(_data, _bestSplit2, _node2, _result2);
+            kidsCreator.create(bSplit ? _iFeature2 : -1, newTasks, nTasks);
+        }
+        else
+        {
+            NodesCreatorType kidsCreator(_data, _bestSplit1, _node1, _result1);
+            kidsCreator.create(bSplit ? _iFeature1 : -1, newTasks, nTasks);
         }
+        releasePrevResult(); // parent GHSums are not needed after execute()
     }
 
 protected:
@@ -364,6 +407,15 @@ protected:
     virtual void findBestSplit(SplitDataType & split, DAAL_INT & iFeature, DAAL_INT & idxFeatureValueBestSplit) DAAL_C11_OVERRIDE {
     } // TODO: rework to remove
 
+    void releasePrevResult()
+    {
+        if (_prevRes)
+        {
+            _prevRes->release(_data);
+            _prevRes = nullptr;
+        }
+    }
+
 protected:
     using super::_data;
     NodeInfoType & _node1 = super::_node;
@@ -380,6 +432,78 @@ protected:
     MergedResult<ResultType, cpu> * _result2;
 };
 
+// Updater for the node whose sibling is a leaf.
+// GHSums are computed by rows for the leaf sibling only (it is smaller than the node),
+// GHSums of the node are obtained as the difference between the parent GHSums and the sibling ones.
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class SiblingUpdaterByRows : public MergedUpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+{
+public:
+    using super            = MergedUpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+    using ResultType       = typename super::ResultType;
+    using NodesCreatorType = typename super::NodesCreatorType;
+    using NodeInfoType     = typename super::NodeInfoType;
+    using DataType         = typename super::DataType;
+
+    SiblingUpdaterByRows(DataType & data, NodeInfoType & leafSibling, NodeInfoType & node, MergedResult<ResultType, cpu> * prevResult)
+        : super(data, leafSibling, node, prevResult)
+    {}
+
+    virtual GbtTask * execute() DAAL_C11_OVERRIDE
+    {
+        _result1 = new (services::internal::service_scalable_calloc<MergedResult<ResultType, cpu>, cpu>(1))
+            MergedResult<ResultType, cpu>(_data.ctx.nFeaturesPerNode());
+        _result2 = new (services::internal::service_scalable_calloc<MergedResult<ResultType, cpu>, cpu>(1))
+            MergedResult<ResultType, cpu>(_data.ctx.nFeaturesPerNode());
+
+        DAAL_INT idxFeatureValueBestSplit1;
+        DAAL_INT idxFeatureValueBestSplit2;
+
+        // full GHSums are computed for the leaf sibling
+        this->findBestSplit(_node1, _node2, _bestSplit1, _bestSplit2, _iFeature1, _iFeature2, idxFeatureValueBestSplit1, idxFeatureValueBestSplit2,
+                            _result1, _result2);
+
+        _iFeature1 = -1;
+        _result1->release(_data);
+        _result1 = nullptr;
+        this->releasePrevResult();
+
+        if (_iFeature2 >= 0)
+        {
+            typename super::PartitionTaskType partion(_iFeature2, idxFeatureValueBestSplit2, _data, _node2, _bestSplit2);
+            partion.execute();
+        }
+
+        return nullptr;
+    }
+
+    virtual void getNextTasks(GbtTask ** newTasks, size_t & nTasks) DAAL_C11_OVERRIDE { getNodeTasks(0, true, newTasks, nTasks); }
+
+    virtual size_t nNodes() const DAAL_C11_OVERRIDE { return 1; }
+
+    virtual bool isSplitFound(size_t iNode, algorithmFPType & impurityDecrease) const DAAL_C11_OVERRIDE
+    {
+        return super::isSplitFound(1, impurityDecrease);
+    }
+
+    virtual void getNodeTasks(size_t iNode, bool bSplit, GbtTask ** newTasks, size_t & nTasks) DAAL_C11_OVERRIDE
+    {
+        NodesCreatorType kidsCreator(_data, _bestSplit2, _node2, _result2);
+        kidsCreator.create(bSplit ? _iFeature2 : -1, newTasks, nTasks);
+    }
+
+protected:
+    using super::_data;
+    using super::_node1;
+    using super::_node2;
+    using super::_bestSplit1;
+    using super::_bestSplit2;
+    using super::_iFeature1;
+    using super::_iFeature2;
+    using super::_result1;
+    using super::_result2;
+};
+
 } /* namespace internal */
 } /* namespace training */
 } /* namespace gbt */
@@ -72,6 +72,7 @@ protected:
 protected:
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
+    gbt::prediction::internal::CompactTrees<cpu> _compactTrees;
     const NumericTable * _data;
     NumericTable * _res;
 };
@@ -99,6 +100,7 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    DAAL_CHECK_STATUS_VAR(this->_compactTrees.init(this->_aTree.get(), nTreesTotal, this->_data->getNumberOfRows()));
     return runInternal(pHostApp, this->_res);
 }
 
@@ -147,6 +149,12 @@ template <typename algorithmFPType, CpuType cpu>
 algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x)
 {
     algorithmFPType val = 0;
+    if (!this->_compactTrees.isEmpty())
+    {
+        for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+            val += this->_compactTrees.predict(iTree, this->_featHelper, x);
+        return val;
+    }
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
         val += gbt::prediction::internal::predictForTree<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x);
     return val;
@@ -159,7 +167,10 @@ void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iF
     algorithmFPType v[VECTOR_BLOCK_SIZE];
     for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
     {
-        gbt::prediction::internal::predictForTreeVector<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x, v);
+        if (this->_compactTrees.isEmpty())
+            gbt::prediction::internal::predictForTreeVector<algorithmFPType, TreeType, cpu>(*this->_aTree[iTree], this->_featHelper, x, v);
+        else
+            this->_compactTrees.predictVector(iTree, this->_featHelper, x, v);
 
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
@@ -90,8 +90,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     gbt::regression::Model * m = result->get(model).get();
 
-    const Parameter * par                  = static_cast<gbt::regression::training::Parameter *>(_par);
-    daal::services::Environment::env & env = *_env;
+    const gbt::regression::training::Parameter * par = static_cast<gbt::regression::training::Parameter *>(_par);
+    daal::services::Environment::env & env           = *_env;
     daal::algorithms::engines::internal::BatchBaseImpl * engine =
         dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(par->engine.get());
 
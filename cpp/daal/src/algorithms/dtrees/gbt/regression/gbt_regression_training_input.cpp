@@ -98,6 +98,18 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter() : maxLeaves(0) {}
+Status Parameter::check() const
+{
+    Status s = interface1::Parameter::check();
+    DAAL_CHECK_STATUS_VAR(s);
+    DAAL_CHECK_EX((maxLeaves != 1), ErrorIncorrectParameter, ParameterName, maxLeavesStr());
+    return s;
+}
+} // namespace interface2
 } // namespace training
 } // namespace regression
 } // namespace gbt
@@ -69,28 +69,123 @@ protected:
         return pNode ? pNode->featureValueOrResponse : 0.;
     }
 
+    /* Same as findNode() for the tree stored in the compact layout */
+    template <bool hasUnorderedFeatures>
+    algorithmFPType predict(const size_t iTree, const algorithmFPType * x) const
+    {
+        const size_t iFirstNode      = _treeOffsets[iTree];
+        const int * const fi         = _tFI.get() + iFirstNode;
+        const uint32_t * const lc    = _tLC.get() + iFirstNode;
+        const ModelFPType * const fv = _tFV.get() + iFirstNode;
+
+        uint32_t i = 0;
+        for (; fi[i] != -1;)
+        {
+            const uint32_t sn = (hasUnorderedFeatures && _featHelper.isUnordered(fi[i])) ? (int(x[fi[i]]) != int(fv[i])) : (x[fi[i]] > fv[i]);
+            i                 = lc[i] + sn;
+        }
+        return fv[i];
+    }
+
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x)
     {
         algorithmFPType val    = 0;
         const size_t iLastTree = iFirstTree + nTrees;
 
-        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
+        if (!_tFI.get())
+        {
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
+        }
+        else if (_featHelper.hasUnorderedFeatures())
+        {
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict<true>(iTree, x);
+        }
+        else
+        {
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict<false>(iTree, x);
+        }
         return val;
     }
+    services::Status compactTrees(const size_t nRows);
     services::Status run(services::HostAppIface * pHostApp, algorithmFPType factor);
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    /* Inference-only structure-of-arrays copy of the trees: split feature (-1 for a leaf), index of the left child
+       within the tree and split value or response of every node. The nodes of tree i start at _treeOffsets[i].
+       The arrays are empty if the trees are walked in the model layout. */
+    TArray<int, cpu> _tFI;
+    TArray<uint32_t, cpu> _tLC;
+    TArray<ModelFPType, cpu> _tFV;
+    TArray<size_t, cpu> _treeOffsets;
     const NumericTable * _data;
     NumericTable * _res;
 };
 
+/* Builds the compact layout of the trees, leaves it empty if nRows rows do not visit the trees often enough
+   to amortize the copy of all the nodes, which is made for every prediction call */
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::compactTrees(const size_t nRows)
+{
+    const size_t nTrees = _aTree.size();
+
+    size_t nNodes = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        /* an empty tree is represented by a single leaf with zero response */
+        nNodes += services::internal::max<cpu, size_t>(_aTree[iTree]->getNumberOfRows(), 1);
+    }
+    /* The copy visits nNodes nodes, the prediction visits nTrees trees per row */
+    if (nRows * nTrees < nNodes) return services::Status();
+
+    _treeOffsets.reset(nTrees);
+    DAAL_CHECK_MALLOC(_treeOffsets.get());
+    for (size_t iTree = 0, iFirstNode = 0; iTree < nTrees; ++iTree)
+    {
+        _treeOffsets[iTree] = iFirstNode;
+        iFirstNode += services::internal::max<cpu, size_t>(_aTree[iTree]->getNumberOfRows(), 1);
+    }
+
+    _tFI.reset(nNodes);
+    _tLC.reset(nNodes);
+    _tFV.reset(nNodes);
+    DAAL_CHECK_MALLOC(_tFI.get() && _tLC.get() && _tFV.get());
+
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree) {
+        const size_t iFirstNode        = _treeOffsets[iTree];
+        const size_t treeSize          = _aTree[iTree]->getNumberOfRows();
+        const DecisionTreeNode * aNode = (const DecisionTreeNode *)_aTree[iTree]->getArray();
+        int * const fi                 = _tFI.get() + iFirstNode;
+        uint32_t * const lc            = _tLC.get() + iFirstNode;
+        ModelFPType * const fv         = _tFV.get() + iFirstNode;
+        if (!aNode || !treeSize)
+        {
+            fi[0] = -1;
+            lc[0] = 0;
+            fv[0] = 0;
+            return;
+        }
+        DAAL_ASSERT(treeSize <= size_t(uint32_t(-1)));
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < treeSize; ++i)
+        {
+            fi[i] = aNode[i].featureIndex;
+            lc[i] = aNode[i].isSplit() ? uint32_t(aNode[i].leftIndexOrClass) : 0;
+            fv[i] = aNode[i].featureValueOrResponse;
+        }
+    });
+    return services::Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface * pHostApp, algorithmFPType factor)
 {
     const auto nTreesTotal = _aTree.size();
-    const auto treeSize    = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+    const auto treeSize    = _aTree[0]->getNumberOfRows() * (sizeof(int) + sizeof(uint32_t) + sizeof(ModelFPType));
+    DAAL_CHECK_STATUS_VAR(compactTrees(_data->getNumberOfRows()));
 
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
@@ -53,7 +53,7 @@ using namespace daal::data_management;
 using namespace daal::internal;
 
 template <typename algorithmFpType>
-struct SearchNode;
+struct BlockSearchNode;
 
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
@@ -67,15 +67,15 @@ public:
                              const daal::algorithms::Parameter * par);
 
 protected:
-    void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-                              kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
+    void findNearestNeighbors(const algorithmFpType * const * queries, size_t queryCount, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+                              kdtree_knn_classification::internal::Stack<BlockSearchNode<algorithmFpType>, cpu> & stack, size_t k,
                               const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
                               services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
 
     services::Status predict(algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-                             const NumericTable * labels, size_t k, VoteWeights voteWeights, const NumericTable * modelIndices,
+                             const algorithmFpType * labels, size_t k, VoteWeights voteWeights, const int * modelIndices,
                              data_management::BlockDescriptor<int> & indices, data_management::BlockDescriptor<algorithmFpType> & distances,
-                             size_t index, const size_t nClasses);
+                             size_t index, const size_t nClasses, algorithmFpType * classWeights);
 };
 
 } // namespace internal
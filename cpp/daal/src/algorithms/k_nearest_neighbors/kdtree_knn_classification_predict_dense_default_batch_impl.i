@@ -56,10 +56,10 @@ using namespace daal::internal;
 using namespace kdtree_knn_classification::internal;
 
 template <typename algorithmFpType>
-struct SearchNode
+struct BlockSearchNode
 {
     size_t nodeIndex;
-    algorithmFpType minDistance;
+    algorithmFpType minDistance[__KDTREE_QUERY_BLOCK_SIZE];
 };
 
 template <typename algorithmFpType, CpuType cpu>
@@ -116,6 +116,17 @@ DAAL_FORCEINLINE void releaseNtData(const bool isHomogenSOA, const NumericTable
     }
 }
 
+template <typename algorithmFpType>
+DAAL_FORCEINLINE size_t findLeafStart(const algorithmFpType * query, const KDTreeNode * nodes, size_t rootTreeNodeIndex)
+{
+    const KDTreeNode * node = nodes + rootTreeNodeIndex;
+    while (node->dimension != __KDTREE_NULLDIMENSION)
+    {
+        node = nodes + ((query[node->dimension] < node->cutPoint) ? node->leftIndex : node->rightIndex);
+    }
+    return node->leftIndex;
+}
+
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
                                                                                    NumericTable * y, NumericTable * indices, NumericTable * distances,
@@ -125,8 +136,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> MaxHeap;
-    typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
-    typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
+    typedef kdtree_knn_classification::internal::Stack<BlockSearchNode<algorithmFpType>, cpu> SearchStack;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
     size_t k;
@@ -170,23 +180,31 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
     struct Local
     {
-        MaxHeap heap;
+        MaxHeap heap[__KDTREE_QUERY_BLOCK_SIZE];
         SearchStack stack;
+
+        void clear()
+        {
+            stack.clear();
+            for (size_t i = 0; i < __KDTREE_QUERY_BLOCK_SIZE; ++i)
+            {
+                heap[i].clear();
+            }
+        }
     };
     daal::tls<Local *> localTLS([&]() -> Local * {
         Local * const ptr = service_scalable_calloc<Local, cpu>(1);
         if (ptr)
         {
-            if (!ptr->heap.init(heapSize))
+            bool isInitialized = ptr->stack.init(stackSize);
+            for (size_t i = 0; i < __KDTREE_QUERY_BLOCK_SIZE; ++i)
             {
-                status.add(services::ErrorMemoryAllocationFailed);
-                service_scalable_free<Local, cpu>(ptr);
-                return nullptr;
+                isInitialized = isInitialized && ptr->heap[i].init(heapSize);
             }
-            if (!ptr->stack.init(stackSize))
+            if (!isInitialized)
             {
                 status.add(services::ErrorMemoryAllocationFailed);
-                ptr->heap.clear();
+                ptr->clear();
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
@@ -200,10 +218,31 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     DAAL_CHECK_STATUS_OK((status.ok()), status);
 
+    /* Model indices and labels are gathered once for all queries instead of being read row by row for every found neighbor */
+    data_management::BlockDescriptor<int> modelIndicesBD;
+    data_management::BlockDescriptor<algorithmFpType> labelsBD;
+    const int * modelIndicesPtr       = nullptr;
+    const algorithmFpType * labelsPtr = nullptr;
+    if (indices)
+    {
+        DAAL_ASSERT(modelIndices);
+        status |= const_cast<NumericTable *>(modelIndices)->getBlockOfRows(0, modelIndices->getNumberOfRows(), readOnly, modelIndicesBD);
+        DAAL_CHECK_STATUS_VAR(status);
+        modelIndicesPtr = modelIndicesBD.getBlockPtr();
+    }
+    if (labels)
+    {
+        status |= const_cast<NumericTable *>(labels)->getBlockOfColumnValues(0, 0, labels->getNumberOfRows(), readOnly, labelsBD);
+        DAAL_CHECK_STATUS_VAR(status);
+        labelsPtr = labelsBD.getBlockPtr();
+    }
+
     const auto maxThreads     = threader_get_threads_number();
     const size_t xColumnCount = x->getNumberOfColumns();
-    const auto rowsPerBlock   = (xRowCount + maxThreads - 1) / maxThreads;
-    const auto blockCount     = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    const size_t rowsPerBlock =
+        min<cpu>(static_cast<size_t>((xRowCount + maxThreads - 1) / maxThreads), static_cast<size_t>(__KDTREE_QUERY_GROUP_SIZE));
+    const auto blockCount = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(kdTreeTable.getArray());
     SafeStatus safeStat;
 
     services::internal::TArrayScalable<algorithmFpType *, cpu> soa_arrays;
@@ -215,56 +254,77 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
         {
             services::Status s;
 
-            const size_t first = iBlock * rowsPerBlock;
-            const size_t last  = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
+            const size_t first    = iBlock * rowsPerBlock;
+            const size_t last     = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
+            const size_t rowCount = last - first;
 
-            const algorithmFpType radius = MaxVal::get();
             data_management::BlockDescriptor<algorithmFpType> xBD;
-            const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
+            const_cast<NumericTable &>(*x).getBlockOfRows(first, rowCount, readOnly, xBD);
             const algorithmFpType * const dx = xBD.getBlockPtr();
 
             data_management::BlockDescriptor<int> indicesBD;
             data_management::BlockDescriptor<algorithmFpType> distancesBD;
+            data_management::BlockDescriptor<algorithmFpType> yBD;
             if (indices)
             {
-                s = indices->getBlockOfRows(first, last - first, writeOnly, indicesBD);
+                s = indices->getBlockOfRows(first, rowCount, writeOnly, indicesBD);
                 DAAL_CHECK_STATUS_THR(s);
             }
             if (distances)
             {
-                s = distances->getBlockOfRows(first, last - first, writeOnly, distancesBD);
+                s = distances->getBlockOfRows(first, rowCount, writeOnly, distancesBD);
                 DAAL_CHECK_STATUS_THR(s);
             }
 
+            algorithmFpType * dy      = nullptr;
+            const size_t yColumnCount = labels ? y->getNumberOfColumns() : 0;
             if (labels)
             {
-                const size_t yColumnCount = y->getNumberOfColumns();
-                data_management::BlockDescriptor<algorithmFpType> yBD;
-                y->getBlockOfRows(first, last - first, writeOnly, yBD);
-                auto * const dy = yBD.getBlockPtr();
+                s = y->getBlockOfRows(first, rowCount, writeOnly, yBD);
+                DAAL_CHECK_STATUS_THR(s);
+                dy = yBD.getBlockPtr();
+            }
 
-                for (size_t i = 0; i < last - first; ++i)
-                {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
-                                         isHomogenSOA, soa_arrays);
-                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
-                    DAAL_CHECK_STATUS_THR(s)
-                }
+            TArrayScalable<size_t, cpu> leafStarts(rowCount);
+            TArrayScalable<size_t, cpu> order(rowCount);
+            TArrayScalable<algorithmFpType, cpu> classWeights(labels ? nClasses : 1);
+            DAAL_CHECK_MALLOC_THR(leafStarts.get() && order.get() && classWeights.get());
 
-                s |= y->releaseBlockOfRows(yBD);
-                DAAL_CHECK_STATUS_THR(s);
+            /* Queries that fall into the same or neighboring leaves are processed together, so that they share the tree
+               traversal and every visited leaf bucket is loaded once per block of queries */
+            for (size_t i = 0; i < rowCount; ++i)
+            {
+                leafStarts[i] = findLeafStart<algorithmFpType>(&dx[i * xColumnCount], nodes, rootTreeNodeIndex);
+                order[i]      = i;
             }
-            else
+            daal::algorithms::internal::qSort<size_t, size_t, cpu>(rowCount, leafStarts.get(), order.get());
+
+            const algorithmFpType * queries[__KDTREE_QUERY_BLOCK_SIZE];
+            for (size_t iQuery = 0; iQuery < rowCount; iQuery += __KDTREE_QUERY_BLOCK_SIZE)
             {
-                for (size_t i = 0; i < last - first; ++i)
+                const size_t queryCount = min<cpu>(static_cast<size_t>(__KDTREE_QUERY_BLOCK_SIZE), rowCount - iQuery);
+                for (size_t q = 0; q < queryCount; ++q)
+                {
+                    queries[q] = &dx[order[iQuery + q] * xColumnCount];
+                }
+
+                findNearestNeighbors(queries, queryCount, local->heap, local->stack, k, kdTreeTable, rootTreeNodeIndex, data, isHomogenSOA,
+                                     soa_arrays);
+
+                for (size_t q = 0; q < queryCount; ++q)
                 {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
-                                         isHomogenSOA, soa_arrays);
-                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    const size_t i = order[iQuery + q];
+                    s = predict(dy ? &(dy[i * yColumnCount]) : nullptr, local->heap[q], labelsPtr, k, voteWeights, modelIndicesPtr, indicesBD,
+                                distancesBD, i, nClasses, classWeights.get());
                     DAAL_CHECK_STATUS_THR(s)
                 }
             }
 
+            if (labels)
+            {
+                s |= y->releaseBlockOfRows(yBD);
+            }
+            DAAL_CHECK_STATUS_THR(s);
             if (indices)
             {
                 s |= indices->releaseBlockOfRows(indicesBD);
@@ -280,27 +340,40 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
         }
     });
 
-    DAAL_CHECK_SAFE_STATUS()
+    if (indices)
+    {
+        status |= const_cast<NumericTable *>(modelIndices)->releaseBlockOfRows(modelIndicesBD);
+    }
+    if (labels)
+    {
+        status |= const_cast<NumericTable *>(labels)->releaseBlockOfColumnValues(labelsBD);
+    }
 
     localTLS.reduce([&](Local * ptr) -> void {
         if (ptr)
         {
-            ptr->stack.clear();
-            ptr->heap.clear();
+            ptr->clear();
             service_scalable_free<Local, cpu>(ptr);
         }
     });
+
+    DAAL_CHECK_SAFE_STATUS()
     return status;
 }
 
 template <typename algorithmFpType, CpuType cpu>
-DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType * distance, const algorithmFpType * query, const bool isHomogenSOA,
+DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType (*distance)[__KDTREE_LEAF_BUCKET_SIZE + 1],
+                                      const algorithmFpType * const * queries, const size_t * active, size_t activeCount, const bool isHomogenSOA,
                                       const NumericTable & data, data_management::BlockDescriptor<algorithmFpType> xBD[2],
                                       services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
 {
-    for (size_t i = start; i < end; ++i)
+    const size_t n = end - start;
+    for (size_t a = 0; a < activeCount; ++a)
     {
-        distance[i - start] = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            distance[a][i] = 0;
+        }
     }
 
     size_t curBDIdx  = 0;
@@ -309,19 +382,29 @@ DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType
     const size_t xColumnCount = data.getNumberOfColumns();
 
     const algorithmFpType * nx = nullptr;
-    const algorithmFpType * dx = getNtData(isHomogenSOA, 0, start, end - start, data, xBD[curBDIdx], soa_arrays);
+    const algorithmFpType * dx = getNtData(isHomogenSOA, 0, start, n, data, xBD[curBDIdx], soa_arrays);
 
-    size_t j;
-    for (j = 1; j < xColumnCount; ++j)
+    /* Each feature column of the leaf bucket is applied to all active queries of the block as a rank-1 update */
+    for (size_t j = 0; j < xColumnCount; ++j)
     {
-        nx = getNtData(isHomogenSOA, j, start, end - start, data, xBD[nextBDIdx], soa_arrays);
+        if (j + 1 < xColumnCount)
+        {
+            nx = getNtData(isHomogenSOA, j + 1, start, n, data, xBD[nextBDIdx], soa_arrays);
 
-        DAAL_PREFETCH_READ_T0(nx);
-        DAAL_PREFETCH_READ_T0(nx + 16);
+            DAAL_PREFETCH_READ_T0(nx);
+            DAAL_PREFETCH_READ_T0(nx + 16);
+        }
 
-        for (size_t i = 0; i < end - start; ++i)
+        for (size_t a = 0; a < activeCount; ++a)
         {
-            distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+            const algorithmFpType q = queries[active[a]][j];
+            algorithmFpType * const d = distance[a];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; ++i)
+            {
+                d[i] += (q - dx[i]) * (q - dx[i]);
+            }
         }
 
         releaseNtData<algorithmFpType, cpu>(isHomogenSOA, data, xBD[curBDIdx]);
@@ -329,113 +412,137 @@ DAAL_FORCEINLINE void computeDistance(size_t start, size_t end, algorithmFpType
         services::internal::swap<cpu, size_t>(curBDIdx, nextBDIdx);
         services::internal::swap<cpu, const algorithmFpType *>(dx, nx);
     }
-    {
-        for (size_t i = 0; i < end - start; ++i)
-        {
-            distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-        }
-
-        releaseNtData<algorithmFpType, cpu>(isHomogenSOA, data, xBD[curBDIdx]);
-    }
 }
 
 template <typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighbors(
-    const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-    kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-    const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
+    const algorithmFpType * const * queries, size_t queryCount, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+    kdtree_knn_classification::internal::Stack<BlockSearchNode<algorithmFpType>, cpu> & stack, size_t k, const KDTreeTable & kdTreeTable,
+    size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
     services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays)
 {
-    heap.reset();
-    stack.reset();
-    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
-    size_t i;
-    SearchNode<algorithmFpType> cur, toPush;
-    const KDTreeNode * node;
-    cur.nodeIndex   = rootTreeNodeIndex;
-    cur.minDistance = 0;
+    typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
 
-    DAAL_ALIGNAS(256) algorithmFpType distance[__KDTREE_LEAF_BUCKET_SIZE + 1];
-    size_t start, end;
+    DAAL_ASSERT(queryCount <= __KDTREE_QUERY_BLOCK_SIZE);
 
+    algorithmFpType radius[__KDTREE_QUERY_BLOCK_SIZE];
+    size_t active[__KDTREE_QUERY_BLOCK_SIZE];
+    DAAL_ALIGNAS(256) algorithmFpType distance[__KDTREE_QUERY_BLOCK_SIZE][__KDTREE_LEAF_BUCKET_SIZE + 1];
+
+    stack.reset();
+    BlockSearchNode<algorithmFpType> cur, toPush;
+    cur.nodeIndex = rootTreeNodeIndex;
+    for (size_t q = 0; q < queryCount; ++q)
+    {
+        heaps[q].reset();
+        radius[q]          = MaxVal::get();
+        cur.minDistance[q] = 0;
+    }
+
+    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(kdTreeTable.getArray());
     data_management::BlockDescriptor<algorithmFpType> xBD[2];
     for (;;)
     {
-        node = static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex;
-        if (node->dimension == __KDTREE_NULLDIMENSION)
+        /* A node is visited by the queries of the block that cannot prune it */
+        size_t activeCount = 0;
+        for (size_t q = 0; q < queryCount; ++q)
         {
-            start = node->leftIndex;
-            end   = node->rightIndex;
-
-            computeDistance<algorithmFpType, cpu>(start, end, distance, query, isHomogenSOA, data, xBD, soa_arrays);
+            if (cur.minDistance[q] <= radius[q])
+            {
+                active[activeCount++] = q;
+            }
+        }
 
-            for (i = start; i < end; ++i)
+        const KDTreeNode * const node = nodes + cur.nodeIndex;
+        if (activeCount != 0)
+        {
+            if (node->dimension == __KDTREE_NULLDIMENSION)
             {
-                if (distance[i - start] <= radius)
+                const size_t start = node->leftIndex;
+                const size_t end   = node->rightIndex;
+
+                computeDistance<algorithmFpType, cpu>(start, end, distance, queries, active, activeCount, isHomogenSOA, data, xBD, soa_arrays);
+
+                for (size_t a = 0; a < activeCount; ++a)
                 {
-                    curNeighbor.distance = distance[i - start];
-                    curNeighbor.index    = i;
-                    if (heap.size() < k)
+                    const size_t q = active[a];
+                    auto & heap    = heaps[q];
+                    for (size_t i = start; i < end; ++i)
                     {
-                        heap.push(curNeighbor, k);
-
-                        if (heap.size() == k)
+                        if (distance[a][i - start] <= radius[q])
                         {
-                            radius = heap.getMax()->distance;
+                            curNeighbor.distance = distance[a][i - start];
+                            curNeighbor.index    = i;
+                            if (heap.size() < k)
+                            {
+                                heap.push(curNeighbor, k);
+
+                                if (heap.size() == k)
+                                {
+                                    radius[q] = heap.getMax()->distance;
+                                }
+                            }
+                            else
+                            {
+                                if (heap.getMax()->distance > curNeighbor.distance)
+                                {
+                                    heap.replaceMax(curNeighbor);
+                                    radius[q] = heap.getMax()->distance;
+                                }
+                            }
                         }
                     }
+                }
+            }
+            else
+            {
+                /* The block descends first into the child preferred by the majority of its active queries */
+                size_t leftCount = 0;
+                for (size_t a = 0; a < activeCount; ++a)
+                {
+                    leftCount += (queries[active[a]][node->dimension] < node->cutPoint);
+                }
+                const bool isLeftFirst = 2 * leftCount >= activeCount;
+
+                cur.nodeIndex    = isLeftFirst ? node->leftIndex : node->rightIndex;
+                toPush.nodeIndex = isLeftFirst ? node->rightIndex : node->leftIndex;
+                for (size_t q = 0; q < queryCount; ++q)
+                {
+                    const algorithmFpType diff    = queries[q][node->dimension] - node->cutPoint;
+                    const algorithmFpType farDist = cur.minDistance[q] + diff * diff;
+                    if ((diff < 0) == isLeftFirst)
+                    {
+                        toPush.minDistance[q] = farDist;
+                    }
                     else
                     {
-                        if (heap.getMax()->distance > curNeighbor.distance)
-                        {
-                            heap.replaceMax(curNeighbor);
-                            radius = heap.getMax()->distance;
-                        }
+                        toPush.minDistance[q] = cur.minDistance[q];
+                        cur.minDistance[q]    = farDist;
                     }
                 }
+                stack.push(toPush);
+                continue;
             }
+        }
 
-            if (!stack.empty())
-            {
-                cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
-            }
-            else
-            {
-                break;
-            }
+        if (!stack.empty())
+        {
+            cur = stack.pop();
+            DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
         }
         else
         {
-            algorithmFpType val        = query[node->dimension];
-            const algorithmFpType diff = val - node->cutPoint;
-
-            if (cur.minDistance <= radius)
-            {
-                cur.nodeIndex    = (diff < 0) ? node->leftIndex : node->rightIndex;
-                toPush.nodeIndex = (diff < 0) ? node->rightIndex : node->leftIndex;
-                val -= node->cutPoint;
-                toPush.minDistance = cur.minDistance + val * val;
-                stack.push(toPush);
-            }
-            else if (!stack.empty())
-            {
-                cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
-            }
-            else
-            {
-                break;
-            }
+            break;
         }
     }
 }
 
 template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
-    algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable * labels, size_t k,
-    VoteWeights voteWeights, const NumericTable * modelIndices, data_management::BlockDescriptor<int> & indices,
-    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses)
+    algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const algorithmFpType * labels, size_t k,
+    VoteWeights voteWeights, const int * modelIndices, data_management::BlockDescriptor<int> & indices,
+    data_management::BlockDescriptor<algorithmFpType> & distances, size_t index, const size_t nClasses, algorithmFpType * classWeights)
 {
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -446,9 +553,6 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
     {
         DAAL_ASSERT(modelIndices);
 
-        services::Status s;
-        data_management::BlockDescriptor<int> modelIndicesBD;
-
         const auto nIndices = indices.getNumberOfColumns();
         DAAL_ASSERT(heapSize <= nIndices);
 
@@ -456,20 +560,12 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
 
         for (size_t i = 0; i < heapSize; ++i)
         {
-            s |= const_cast<NumericTable *>(modelIndices)->getBlockOfRows(heap[i].index, 1, readOnly, modelIndicesBD);
-            DAAL_ASSERT(s.ok());
-
-            indicesPtr[i] = *(modelIndicesBD.getBlockPtr());
-
-            s |= const_cast<NumericTable *>(modelIndices)->releaseBlockOfRows(modelIndicesBD);
-            DAAL_ASSERT(s.ok());
+            indicesPtr[i] = modelIndices[heap[i].index];
         }
     }
 
     if (distances.getNumberOfRows() != 0)
     {
-        services::Status s;
-
         const auto nDistances = distances.getNumberOfColumns();
         DAAL_ASSERT(heapSize <= nDistances);
 
@@ -491,29 +587,18 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
     {
         DAAL_ASSERT(predictedClass);
 
-        data_management::BlockDescriptor<algorithmFpType> labelBD;
-        algorithmFpType * classes      = static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(heapSize));
-        algorithmFpType * classWeights = static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(nClasses));
-        DAAL_CHECK_MALLOC(classWeights);
-        DAAL_CHECK_MALLOC(classes);
+        DAAL_ASSERT(classWeights);
 
         for (size_t i = 0; i < nClasses; ++i)
         {
             classWeights[i] = 0;
         }
 
-        for (size_t i = 0; i < heapSize; ++i)
-        {
-            const_cast<NumericTable *>(labels)->getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
-            classes[i] = *(labelBD.getBlockPtr());
-            const_cast<NumericTable *>(labels)->releaseBlockOfColumnValues(labelBD);
-        }
-
         if (voteWeights == voteUniform)
         {
             for (size_t i = 0; i < heapSize; ++i)
             {
-                classWeights[(size_t)(classes[i])] += 1;
+                classWeights[(size_t)(labels[heap[i].index])] += 1;
             }
         }
         else
@@ -539,7 +624,7 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
                 {
                     if (heap[i].distance <= epsilon)
                     {
-                        classWeights[(size_t)(classes[i])] += 1;
+                        classWeights[(size_t)(labels[heap[i].index])] += 1;
                     }
                 }
             }
@@ -547,7 +632,7 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
             {
                 for (size_t i = 0; i < heapSize; ++i)
                 {
-                    classWeights[(size_t)(classes[i])] += Math::sSqrt(1 / heap[i].distance);
+                    classWeights[(size_t)(labels[heap[i].index])] += Math::sSqrt(1 / heap[i].distance);
                 }
             }
         }
@@ -563,10 +648,6 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
             }
         }
         *predictedClass = maxWeightClass;
-
-        service_free<algorithmFpType, cpu>(classes);
-        service_free<algorithmFpType, cpu>(classWeights);
-        classes = nullptr;
     }
 
     return services::Status();
@@ -48,6 +48,8 @@ namespace internal
 #define __KDTREE_MAX_SAMPLES                          1024
 #define __KDTREE_MIN_SAMPLES                          256
 #define __SIMDWIDTH                                   8
+#define __KDTREE_QUERY_BLOCK_SIZE                     16
+#define __KDTREE_QUERY_GROUP_SIZE                     4096
 
 #define __KDTREE_NULLDIMENSION (static_cast<size_t>(-1))
 
@@ -124,8 +124,9 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-    if (method == defaultDense)
+    const bool isDense = (method == defaultDense || method == hamerlyDense);
+    TArray<double, cpu> dS1(isDense ? p : 0);
+    if (isDense)
     {
         DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
     }
@@ -141,6 +142,13 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     size_t blockSize = 0;
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
 
+    HamerlyBounds<algorithmFPType, cpu> bounds(method == hamerlyDense ? n : 0, method == hamerlyDense ? nClusters : 0);
+    if (method == hamerlyDense)
+    {
+        DAAL_CHECK(bounds.isValid(), services::ErrorMemoryAllocationFailed);
+    }
+    algorithmFPType * centroidShifts = bounds.centroidShifts.get();
+
     size_t kIter;
 
     for (kIter = 0; kIter < nIter; kIter++)
@@ -150,8 +158,15 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+            NumericTable * iterAssignNT = assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr;
+            if (method == hamerlyDense)
+            {
+                s = task->addNTToTaskThreadedHamerly(ntData, blockSize, bounds, iterAssignNT);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, iterAssignNT);
+            }
         }
 
         if (!s)
@@ -179,6 +194,10 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
                 if (clusterS0[i] > 0)
                 {
                     const algorithmFPType coeff = 1.0 / clusterS0[i];
+                    if (method == hamerlyDense)
+                    {
+                        centroidShifts[i] = computeCentroidShift<algorithmFPType, cpu>(&inClusters[i * p], &clusterS1[i * p], coeff, p);
+                    }
 
                     PRAGMA_IVDEP
                     PRAGMA_VECTOR_ALWAYS
@@ -196,6 +215,10 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
                     newCentersGoalFunc += cValues[cPos];
                     ReadRows<algorithmFPType, cpu> mtRow(ntData, cIndices[cPos], 1);
                     const algorithmFPType * row = mtRow.get();
+                    if (method == hamerlyDense)
+                    {
+                        centroidShifts[i] = computeCentroidShift<algorithmFPType, cpu>(&inClusters[i * p], row, algorithmFPType(1), p);
+                    }
 
                     PRAGMA_IVDEP
                     PRAGMA_VECTOR_ALWAYS
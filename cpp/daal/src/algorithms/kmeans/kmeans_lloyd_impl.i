@@ -30,6 +30,7 @@
 #include "src/threading/threading.h"
 #include "src/externals/service_blas.h"
 #include "src/externals/service_spblas.h"
+#include "src/externals/service_math.h"
 #include "src/services/service_data_utils.h"
 
 #include "src/algorithms/kmeans/kmeans_lloyd_helper.h"
@@ -46,6 +47,118 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/* State of Hamerly's method kept between the iterations of the Lloyd algorithm: for every observation,
+   the index of the closest centroid and the lower bound of the distance to the second closest one */
+template <typename algorithmFPType, CpuType cpu>
+struct HamerlyBounds
+{
+    HamerlyBounds(const size_t nRows, const size_t nClusters)
+        : assignments(nRows), lowerBounds(nRows), centroidShifts(nClusters), halfMinDistances(nClusters), nRows(nRows), nClusters(nClusters)
+    {}
+
+    bool isValid() const { return assignments.get() && lowerBounds.get() && centroidShifts.get() && halfMinDistances.get(); }
+
+    void update(const size_t dim, const algorithmFPType * const centroids);
+
+    TArray<int, cpu> assignments;
+    TArray<algorithmFPType, cpu> lowerBounds;
+    TArray<algorithmFPType, cpu> centroidShifts; /* Distances the centroids moved on the previous iteration */
+    TArray<algorithmFPType, cpu> halfMinDistances;
+    size_t nRows;
+    size_t nClusters;
+    bool isInitialized = false;
+};
+
+/* Computes half of the distance from every centroid to its closest neighbour and
+   decreases the lower bounds by the largest movement of the other centroids */
+template <typename algorithmFPType, CpuType cpu>
+void HamerlyBounds<algorithmFPType, cpu>::update(const size_t dim, const algorithmFPType * const centroids)
+{
+    const algorithmFPType maxVal    = MaxVal<algorithmFPType>::get();
+    algorithmFPType * const halfMin = halfMinDistances.get();
+
+    daal::threader_for(nClusters, nClusters, [=](size_t i) {
+        algorithmFPType minDistSq = maxVal;
+        for (size_t j = 0; j < nClusters; j++)
+        {
+            if (j == i)
+            {
+                continue;
+            }
+            algorithmFPType distSq = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t d = 0; d < dim; d++)
+            {
+                const algorithmFPType diff = centroids[i * dim + d] - centroids[j * dim + d];
+                distSq += diff * diff;
+            }
+            minDistSq = (distSq < minDistSq) ? distSq : minDistSq;
+        }
+        halfMin[i] = (minDistSq < maxVal) ? algorithmFPType(0.5) * Math<algorithmFPType, cpu>::sSqrt(minDistSq) : maxVal;
+    });
+
+    if (!isInitialized)
+    {
+        return;
+    }
+
+    const algorithmFPType * const shifts = centroidShifts.get();
+    algorithmFPType maxShift             = algorithmFPType(0);
+    algorithmFPType secondMaxShift       = algorithmFPType(0);
+    size_t maxShiftIdx                   = 0;
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (shifts[i] > maxShift)
+        {
+            secondMaxShift = maxShift;
+            maxShift       = shifts[i];
+            maxShiftIdx    = i;
+        }
+        else if (shifts[i] > secondMaxShift)
+        {
+            secondMaxShift = shifts[i];
+        }
+    }
+    if (maxShift == algorithmFPType(0))
+    {
+        return;
+    }
+
+    /* The lower bound covers all centroids except the closest one, so its own movement is not subtracted */
+    const int maxShiftCluster  = (int)maxShiftIdx;
+    const int * const assigned = assignments.get();
+    algorithmFPType * const lb = lowerBounds.get();
+    const size_t blockSize     = 4096;
+    const size_t nBlocks       = nRows / blockSize + !!(nRows % blockSize);
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (begin + blockSize < nRows) ? begin + blockSize : nRows;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = begin; i < end; i++)
+        {
+            lb[i] -= (assigned[i] == maxShiftCluster) ? secondMaxShift : maxShift;
+        }
+    });
+}
+
+/* Distance from the centroid to its new position given as the scaled sum of the assigned observations */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType computeCentroidShift(const algorithmFPType * const centroid, const algorithmFPType * const newSum, const algorithmFPType coeff,
+                                     const size_t dim)
+{
+    algorithmFPType shiftSq = algorithmFPType(0);
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < dim; j++)
+    {
+        const algorithmFPType diff = centroid[j] - newSum[j] * coeff;
+        shiftSq += diff * diff;
+    }
+    return Math<algorithmFPType, cpu>::sSqrt(shiftSq);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 struct TaskKMeansLloyd
 {
@@ -108,6 +221,9 @@ struct TaskKMeansLloyd
     Status addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                   NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault, HamerlyBounds<algorithmFPType, cpu> & bounds,
+                                      NumericTable * ntAssign = nullptr);
+
     template <Method method>
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                NumericTable * ntAssign = nullptr);
@@ -144,7 +260,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+    daal::numa_static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
@@ -259,7 +375,7 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     nBlocks += (nBlocks * blockSizeDefault != n);
 
     SafeStatus safeStat;
-    daal::static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+    daal::numa_static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
         struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
         DAAL_CHECK_MALLOC_THR(tt);
 
@@ -343,6 +459,205 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedHamerly(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                                                         HamerlyBounds<algorithmFPType, cpu> & bounds, NumericTable * ntAssign)
+{
+    const size_t n = ntData->getNumberOfRows();
+    DAAL_ASSERT(bounds.nRows == n && bounds.nClusters == clNum);
+
+    bounds.update(dim, cCenters);
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    const bool isInitialized                       = bounds.isInitialized;
+    int * const closest                            = bounds.assignments.get();
+    algorithmFPType * const lowerBounds            = bounds.lowerBounds.get();
+    const algorithmFPType * const halfMinDistances = bounds.halfMinDistances.get();
+
+    SafeStatus safeStat;
+    daal::numa_static_threader_for(nBlocks, [=, &safeStat](const int k, size_t tid) {
+        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
+        DAAL_CHECK_MALLOC_THR(tt);
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDefault : blockSizeDefault;
+        const size_t rowOffset = k * blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), rowOffset, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+
+        algorithmFPType * trg        = &(tt->goalFunc);
+        algorithmFPType * x_clusters = tt->mklBuff;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, rowOffset, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        TArrayScalable<algorithmFPType, cpu> distSq(blockSize);
+        TArrayScalable<size_t, cpu> rowsToUpdate(blockSize);
+        DAAL_CHECK_MALLOC_THR(distSq.get() && rowsToUpdate.get());
+
+        /* The closest centroid does not change if the distance to it is bounded by half of the distance
+           to its nearest centroid or by the lower bound of the distance to all other centroids */
+        size_t nRowsToUpdate = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            if (isInitialized)
+            {
+                const size_t c            = closest[rowOffset + i];
+                algorithmFPType rowDistSq = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    const algorithmFPType diff = data[i * p + j] - inClusters[c * p + j];
+                    rowDistSq += diff * diff;
+                }
+                distSq[i] = rowDistSq;
+
+                const algorithmFPType bound = (halfMinDistances[c] > lowerBounds[rowOffset + i]) ? halfMinDistances[c] : lowerBounds[rowOffset + i];
+                if (Math<algorithmFPType, cpu>::sSqrt(rowDistSq) <= bound)
+                {
+                    continue;
+                }
+            }
+            rowsToUpdate[nRowsToUpdate++] = i;
+        }
+
+        if (nRowsToUpdate > 0)
+        {
+            /* Compute the distances to all centroids only for the observations that failed the bounds test */
+            const algorithmFPType * rows = data;
+            TArrayScalable<algorithmFPType, cpu> gatheredRows(nRowsToUpdate < blockSize ? nRowsToUpdate * p : 0);
+            if (nRowsToUpdate < blockSize)
+            {
+                DAAL_CHECK_MALLOC_THR(gatheredRows.get());
+                for (size_t r = 0; r < nRowsToUpdate; r++)
+                {
+                    const algorithmFPType * const src = data + rowsToUpdate[r] * p;
+                    algorithmFPType * const dst       = gatheredRows.get() + r * p;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        dst[j] = src[j];
+                    }
+                }
+                rows = gatheredRows.get();
+            }
+
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = nRowsToUpdate;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = nRowsToUpdate;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t r = 0; r < nRowsToUpdate; r++)
+                {
+                    x_clusters[r + j * nRowsToUpdate] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, rows, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+
+            for (size_t r = 0; r < nRowsToUpdate; r++)
+            {
+                algorithmFPType minGoalVal       = x_clusters[r];
+                algorithmFPType secondMinGoalVal = MaxVal<algorithmFPType>::get();
+                size_t minIdx                    = 0;
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                    const algorithmFPType localGoalVal = x_clusters[r + j * nRowsToUpdate];
+                    if (localGoalVal < minGoalVal)
+                    {
+                        secondMinGoalVal = minGoalVal;
+                        minGoalVal       = localGoalVal;
+                        minIdx           = j;
+                    }
+                    else if (localGoalVal < secondMinGoalVal)
+                    {
+                        secondMinGoalVal = localGoalVal;
+                    }
+                }
+
+                algorithmFPType rowSq = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    rowSq += rows[r * p + j] * rows[r * p + j];
+                }
+
+                const size_t i           = rowsToUpdate[r];
+                const algorithmFPType d1 = minGoalVal * 2.0 + rowSq;
+                distSq[i]                = (d1 > algorithmFPType(0)) ? d1 : algorithmFPType(0);
+                closest[rowOffset + i]   = (int)minIdx;
+                if (nClusters > 1)
+                {
+                    const algorithmFPType d2   = secondMinGoalVal * 2.0 + rowSq;
+                    lowerBounds[rowOffset + i] = (d2 > algorithmFPType(0)) ? Math<algorithmFPType, cpu>::sSqrt(d2) : algorithmFPType(0);
+                }
+                else
+                {
+                    lowerBounds[rowOffset + i] = MaxVal<algorithmFPType>::get();
+                }
+            }
+        }
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx = closest[rowOffset + i];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += data[i * p + j];
+            }
+
+            kmeansInsertCandidate(tt, distSq[i], rowOffset + i);
+            cS0[minIdx]++;
+
+            goal += distSq[i];
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        *trg += goal;
+    });
+    Status st = safeStat.detach();
+    if (st)
+    {
+        bounds.isInitialized = true;
+    }
+    return st;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
@@ -385,7 +700,7 @@ template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansComputeCentroids(int * clusterS0, algorithmFPType * clusterS1, double * auxData)
 {
-    if (method == defaultDense && auxData)
+    if ((method == defaultDense || method == hamerlyDense) && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
         {
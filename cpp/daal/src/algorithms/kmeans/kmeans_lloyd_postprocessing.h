@@ -184,6 +184,10 @@ struct PostProcessing<lloydDense, algorithmFPType, cpu>
     }
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct PostProcessing<hamerlyDense, algorithmFPType, cpu> : public PostProcessing<lloydDense, algorithmFPType, cpu>
+{};
+
 template <typename algorithmFPType, CpuType cpu>
 struct PostProcessing<lloydCSR, algorithmFPType, cpu>
 {
@@ -0,0 +1,391 @@
+/* file: newton_cg_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of newton_cg algorithm
+//
+//  Trust-region truncated Newton method: every outer iteration solves the trust-region
+//  subproblem approximately by Steihaug conjugate gradients. The Hessian is never
+//  formed, Hessian-vector products are computed as finite differences of gradients
+//  of the objective function.
+//--
+*/
+
+#ifndef __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+#define __NEWTON_CG_DENSE_DEFAULT_IMPL_I__
+
+#include "src/data_management/service_micro_table.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/externals/service_blas.h"
+#include "src/services/service_utils.h"
+#include "src/services/service_data_utils.h"
+#include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+static algorithmFPType dotProduct(size_t n, const algorithmFPType * x, const algorithmFPType * y)
+{
+    const DAAL_INT nCasted = static_cast<DAAL_INT>(n);
+    const DAAL_INT one     = 1;
+    return Blas<algorithmFPType, cpu>::xxdot(&nCasted, x, &one, y, &one);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static void axpy(size_t n, algorithmFPType a, const algorithmFPType * x, algorithmFPType * y)
+{
+    const DAAL_INT nCasted = static_cast<DAAL_INT>(n);
+    const DAAL_INT one     = 1;
+    Blas<algorithmFPType, cpu>::xxaxpy(&nCasted, &a, x, &one, y, &one);
+}
+
+/**
+ *  \brief Computes the objective function at the argument it was set up with and copies
+ *         the gradient (and the value if requested) into the given buffers
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::computeObjective(sum_of_functions::Batch * function, size_t n,
+                                                                                algorithmFPType * gradient, algorithmFPType * value)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, function->computeNoThrow());
+
+    ReadRows<algorithmFPType, cpu> gradientBD(*function->getResult()->get(objective_function::gradientIdx), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(gradientBD);
+    const algorithmFPType * const gradientPtr = gradientBD.get();
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        gradient[i] = gradientPtr[i];
+    }
+
+    if (value)
+    {
+        ReadRows<algorithmFPType, cpu> valueBD(*function->getResult()->get(objective_function::valueIdx), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(valueBD);
+        *value = valueBD.get()[0];
+    }
+    return s;
+}
+
+/**
+ *  \brief Approximates the product of the Hessian at x and the direction d:
+ *         hd = (gradient(x + eps * d) - gradient(x)) / eps
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::hessianVectorProduct(sum_of_functions::Batch * function, size_t n,
+                                                                                    const algorithmFPType * x, const algorithmFPType * gradient,
+                                                                                    algorithmFPType xNorm, const algorithmFPType * d,
+                                                                                    algorithmFPType * xShift, algorithmFPType * hd)
+{
+    algorithmFPType dNorm = 0;
+    IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(d, n, dNorm);
+    if (dNorm == 0)
+    {
+        daal::services::internal::service_memset<algorithmFPType, cpu>(hd, 0, n);
+        return services::Status();
+    }
+
+    const algorithmFPType eps =
+        daal::internal::Math<algorithmFPType, cpu>::sSqrt(daal::services::internal::EpsilonVal<algorithmFPType>::get()) * (1 + xNorm) / dNorm;
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        xShift[i] = x[i] + eps * d[i];
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, computeObjective(function, n, hd, nullptr));
+
+    const algorithmFPType invEps = algorithmFPType(1) / eps;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        hd[i] = (hd[i] - gradient[i]) * invEps;
+    }
+    return s;
+}
+
+/**
+ *  \brief Approximately solves the trust-region subproblem
+ *         min gradient^T * step + 0.5 * step^T * H * step,  ||step|| <= delta
+ *         by Steihaug conjugate gradients. On exit r holds the residual -gradient - H * step
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::solveTrustRegion(
+    sum_of_functions::Batch * function, size_t n, size_t maxCGIterations, algorithmFPType cgTolerance, algorithmFPType delta,
+    const algorithmFPType * x, const algorithmFPType * gradient, algorithmFPType xNorm, algorithmFPType * step, algorithmFPType * r,
+    algorithmFPType * d, algorithmFPType * hd, algorithmFPType * xShift, size_t & nCGIterations)
+{
+    services::Status s;
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        step[i] = 0;
+        r[i]    = -gradient[i];
+        d[i]    = r[i];
+    }
+
+    algorithmFPType rr = dotProduct<algorithmFPType, cpu>(n, r, r);
+    for (nCGIterations = 0; nCGIterations < maxCGIterations; nCGIterations++)
+    {
+        if (daal::internal::Math<algorithmFPType, cpu>::sSqrt(rr) <= cgTolerance) break;
+
+        DAAL_CHECK_STATUS(s, hessianVectorProduct(function, n, x, gradient, xNorm, d, xShift, hd));
+
+        const algorithmFPType dHd = dotProduct<algorithmFPType, cpu>(n, d, hd);
+        algorithmFPType alpha     = (dHd > 0) ? rr / dHd : 0;
+        if (dHd > 0)
+        {
+            axpy<algorithmFPType, cpu>(n, alpha, d, step);
+        }
+
+        /* Negative curvature or the step left the trust region: move to the boundary along d */
+        if (dHd <= 0 || dotProduct<algorithmFPType, cpu>(n, step, step) > delta * delta)
+        {
+            if (dHd > 0)
+            {
+                axpy<algorithmFPType, cpu>(n, -alpha, d, step);
+            }
+            const algorithmFPType sd     = dotProduct<algorithmFPType, cpu>(n, step, d);
+            const algorithmFPType ss     = dotProduct<algorithmFPType, cpu>(n, step, step);
+            const algorithmFPType dd     = dotProduct<algorithmFPType, cpu>(n, d, d);
+            const algorithmFPType delta2 = delta * delta;
+            const algorithmFPType rad    = daal::internal::Math<algorithmFPType, cpu>::sSqrt(sd * sd + dd * (delta2 - ss));
+            alpha                        = (sd >= 0) ? (delta2 - ss) / (sd + rad) : (rad - sd) / dd;
+
+            axpy<algorithmFPType, cpu>(n, alpha, d, step);
+            axpy<algorithmFPType, cpu>(n, -alpha, hd, r);
+            nCGIterations++;
+            break;
+        }
+
+        axpy<algorithmFPType, cpu>(n, -alpha, hd, r);
+        const algorithmFPType rrNew = dotProduct<algorithmFPType, cpu>(n, r, r);
+        const algorithmFPType beta  = rrNew / rr;
+        rr                          = rrNew;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; i++)
+        {
+            d[i] = r[i] + beta * d[i];
+        }
+    }
+    return s;
+}
+
+/**
+ *  \Kernel for NewtonCG calculation
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status NewtonCGKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                       NumericTable * nIterations, Parameter * parameter)
+{
+    /* Trust-region radius update constants */
+    const algorithmFPType eta0 = 1e-4, eta1 = 0.25, eta2 = 0.75;
+    const algorithmFPType sigma1 = 0.25, sigma2 = 0.5, sigma3 = 4.0;
+
+    services::Status s;
+
+    const size_t nRowsArgument = inputArgument->getNumberOfRows();
+    const size_t nColsArgument = inputArgument->getNumberOfColumns();
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRowsArgument, nColsArgument);
+    const size_t n = nRowsArgument * nColsArgument;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+
+    WriteRows<algorithmFPType, cpu> nIterationsBD(*nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    algorithmFPType * const nIter = nIterationsBD.get();
+    *nIter                        = 0;
+
+    WriteRows<algorithmFPType, cpu> xBD(*minimum, 0, nRowsArgument);
+    DAAL_CHECK_BLOCK_STATUS(xBD);
+    algorithmFPType * const x = xBD.get();
+
+    {
+        ReadRows<algorithmFPType, cpu> initialPointBD(*inputArgument, 0, nRowsArgument);
+        DAAL_CHECK_BLOCK_STATUS(initialPointBD);
+        int result = daal::services::internal::daal_memcpy_s(x, n * sizeof(algorithmFPType), initialPointBD.get(), n * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    /* Gradient, candidate point and its gradient, CG step, residual, direction, Hessian-vector product, shifted point */
+    TArray<algorithmFPType, cpu> workT(8 * n);
+    algorithmFPType * const work = workT.get();
+    DAAL_CHECK_MALLOC(work);
+    algorithmFPType * const gradient    = work;
+    algorithmFPType * const xNew        = work + n;
+    algorithmFPType * const gradientNew = work + 2 * n;
+    algorithmFPType * const step        = work + 3 * n;
+    algorithmFPType * const r           = work + 4 * n;
+    algorithmFPType * const d           = work + 5 * n;
+    algorithmFPType * const hd          = work + 6 * n;
+    algorithmFPType * const xShift      = work + 7 * n;
+
+    NumericTablePtr xNewTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(xNew, nColsArgument, nRowsArgument, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr xShiftTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(xShift, nColsArgument, nRowsArgument, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    sum_of_functions::BatchPtr valueFunction = parameter->function->clone();
+    valueFunction->sumOfFunctionsInput->set(sum_of_functions::argument, xNewTable);
+    valueFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient | objective_function::value;
+    valueFunction->enableChecks(false);
+
+    sum_of_functions::BatchPtr hessianFunction = parameter->function->clone();
+    hessianFunction->sumOfFunctionsInput->set(sum_of_functions::argument, xShiftTable);
+    hessianFunction->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient;
+    hessianFunction->enableChecks(false);
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        xNew[i] = x[i];
+    }
+
+    algorithmFPType value = 0;
+    DAAL_CHECK_STATUS(s, computeObjective(valueFunction.get(), n, gradient, &value));
+
+    algorithmFPType gradientNorm = 0;
+    algorithmFPType xNorm        = 0;
+    IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(gradient, n, gradientNorm);
+    IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(x, n, xNorm);
+
+    const algorithmFPType accuracyThreshold   = parameter->accuracyThreshold;
+    const algorithmFPType cgAccuracyThreshold = parameter->cgAccuracyThreshold;
+    const size_t maxIterations                = parameter->nIterations;
+    const size_t maxCGIterations              = parameter->nCGIterations ? parameter->nCGIterations : n;
+    if (gradientNorm <= accuracyThreshold * (xNorm > 1 ? xNorm : 1)) return s;
+
+    services::internal::HostAppHelper host(pHost, 10);
+    algorithmFPType delta = gradientNorm;
+    size_t iIteration     = 0;
+    for (; iIteration < maxIterations; iIteration++)
+    {
+        size_t nCGIterations = 0;
+        DAAL_CHECK_STATUS(s, solveTrustRegion(hessianFunction.get(), n, maxCGIterations, cgAccuracyThreshold * gradientNorm, delta, x, gradient,
+                                              xNorm, step, r, d, hd, xShift, nCGIterations));
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; i++)
+        {
+            xNew[i] = x[i] + step[i];
+        }
+
+        algorithmFPType valueNew = 0;
+        DAAL_CHECK_STATUS(s, computeObjective(valueFunction.get(), n, gradientNew, &valueNew));
+
+        const algorithmFPType gs     = dotProduct<algorithmFPType, cpu>(n, gradient, step);
+        const algorithmFPType prered = algorithmFPType(-0.5) * (gs - dotProduct<algorithmFPType, cpu>(n, step, r));
+        const algorithmFPType actred = value - valueNew;
+
+        algorithmFPType stepNorm = 0;
+        IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(step, n, stepNorm);
+        if (iIteration == 0 && stepNorm < delta) delta = stepNorm;
+
+        /* Minimizer of the quadratic interpolating value, valueNew and gs along the step */
+        const algorithmFPType curvature = valueNew - value - gs;
+        algorithmFPType alpha           = sigma3;
+        if (curvature > 0)
+        {
+            alpha = algorithmFPType(-0.5) * gs / curvature;
+            if (alpha < sigma1) alpha = sigma1;
+        }
+
+        if (actred < eta0 * prered)
+        {
+            const algorithmFPType shrink = (alpha > sigma1 ? alpha : sigma1) * stepNorm;
+            delta                        = (shrink < sigma2 * delta) ? shrink : sigma2 * delta;
+        }
+        else
+        {
+            const algorithmFPType upper     = (actred < eta1 * prered) ? sigma2 : sigma3;
+            const algorithmFPType lower     = (actred < eta2 * prered) ? sigma1 : 1;
+            const algorithmFPType candidate = (alpha * stepNorm < upper * delta) ? alpha * stepNorm : upper * delta;
+            delta                           = (candidate > lower * delta) ? candidate : lower * delta;
+        }
+
+        if (actred > eta0 * prered)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i]        = xNew[i];
+                gradient[i] = gradientNew[i];
+            }
+            value = valueNew;
+            IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(gradient, n, gradientNorm);
+            IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(x, n, xNorm);
+            if (gradientNorm <= accuracyThreshold * (xNorm > 1 ? xNorm : 1))
+            {
+                iIteration++;
+                break;
+            }
+        }
+
+        /* No further progress is possible in the working precision */
+        const algorithmFPType tiny = algorithmFPType(1e-12) * daal::internal::Math<algorithmFPType, cpu>::sFabs(value);
+        if ((actred <= 0 && prered <= 0) || (daal::internal::Math<algorithmFPType, cpu>::sFabs(actred) <= tiny && prered <= tiny))
+        {
+            iIteration++;
+            break;
+        }
+        if (host.isCancelled(s, 1))
+        {
+            iIteration++;
+            break;
+        }
+    }
+    *nIter = iIteration;
+    return s;
+}
+
+} // namespace internal
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,75 @@
+/* file: newton_cg_dense_default_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+//++
+//  Declaration of template function that calculate newton_cg.
+//--
+
+#ifndef __NEWTON_CG_DENSE_DEFAULT_KERNEL_H__
+#define __NEWTON_CG_DENSE_DEFAULT_KERNEL_H__
+
+#include "algorithms/optimization_solver/newton_cg/newton_cg_batch.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/data_management/service_micro_table.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace internal
+{
+template <typename algorithmFPType, Method method, CpuType cpu>
+class NewtonCGKernel : public Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             Parameter * parameter);
+
+private:
+    services::Status computeObjective(sum_of_functions::Batch * function, size_t n, algorithmFPType * gradient, algorithmFPType * value);
+
+    services::Status hessianVectorProduct(sum_of_functions::Batch * function, size_t n, const algorithmFPType * x, const algorithmFPType * gradient,
+                                          algorithmFPType xNorm, const algorithmFPType * d, algorithmFPType * xShift, algorithmFPType * hd);
+
+    services::Status solveTrustRegion(sum_of_functions::Batch * function, size_t n, size_t maxCGIterations, algorithmFPType cgTolerance,
+                                      algorithmFPType delta, const algorithmFPType * x, const algorithmFPType * gradient, algorithmFPType xNorm,
+                                      algorithmFPType * step, algorithmFPType * r, algorithmFPType * d, algorithmFPType * hd,
+                                      algorithmFPType * xShift, size_t & nCGIterations);
+};
+
+} // namespace internal
+
+} // namespace newton_cg
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
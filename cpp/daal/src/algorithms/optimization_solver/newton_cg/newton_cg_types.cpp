@@ -0,0 +1,84 @@
+/* file: newton_cg_types.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of newton_cg solver classes.
+//--
+*/
+
+#include "algorithms/optimization_solver/newton_cg/newton_cg_types.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace newton_cg
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NEWTON_CG_RESULT_ID);
+
+Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold, size_t nCGIterations,
+                     double cgAccuracyThreshold)
+    : optimization_solver::iterative_solver::Parameter(function, nIterations, accuracyThreshold, false, 1),
+      nCGIterations(nCGIterations),
+      cgAccuracyThreshold(cgAccuracyThreshold)
+{}
+
+services::Status Parameter::check() const
+{
+    services::Status s = iterative_solver::Parameter::check();
+    if (!s) return s;
+
+    DAAL_CHECK_EX(cgAccuracyThreshold > 0 && cgAccuracyThreshold < 1, ErrorIncorrectParameter, ArgumentName, "cgAccuracyThreshold");
+    return s;
+}
+
+Input::Input() {}
+Input::Input(const Input & other) : optimization_solver::iterative_solver::Input(other) {}
+
+services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    if (this->size() != 2) return services::Status(services::ErrorIncorrectNumberOfInputNumericTables);
+
+    return data_management::checkNumericTable(get(iterative_solver::inputArgument).get(), inputArgumentStr(), 0, 0);
+}
+
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    const Input * algInput = static_cast<const Input *>(input);
+    const size_t nRows     = algInput->get(iterative_solver::inputArgument)->getNumberOfRows();
+    const size_t nColumns  = algInput->get(iterative_solver::inputArgument)->getNumberOfColumns();
+
+    services::Status s = data_management::checkNumericTable(get(iterative_solver::minimum).get(), minimumStr(), 0, 0, nColumns, nRows);
+    if (!s) return s;
+    return data_management::checkNumericTable(get(iterative_solver::nIterations).get(), nIterationsStr(), 0, 0, 1, 1);
+}
+
+} // namespace interface1
+} // namespace newton_cg
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
@@ -61,6 +61,12 @@ public:
 
     virtual services::Status resize(const size_t nSize) = 0;
 
+    /**
+     * Restricts the cache lines to the kernel values for the given rows of the data set.
+     * The rows must be sorted in ascending order and must be a subset of the currently active rows.
+     */
+    virtual services::Status setActiveRows(const uint32_t * const rows, const size_t nRows) = 0;
+
 protected:
     SVMCacheIface(const size_t cacheSize, const size_t lineSize, const kernel_function::KernelIfacePtr & kernel)
         : _lineSize(lineSize), _cacheSize(cacheSize), _kernel(kernel)
@@ -116,6 +122,10 @@ public:
         _cache.reset();
         _cacheData.reset();
         _soaData.reset();
+        _activeTask.reset();
+        _activeRows.reset();
+        _nActiveRows = _lineSize;
+        _nUsedLines  = 0;
         return services::Status();
     }
 
@@ -152,6 +162,7 @@ public:
                 _soaData[i]                             = cachei;
                 _kernelIndex[nIndicesForKernel]         = cacheIndex;
                 _kernelOriginalIndex[nIndicesForKernel] = dataIndex;
+                _nUsedLines                             = services::internal::max<cpu, size_t>(_nUsedLines, cacheIndex + 1);
                 ++nIndicesForKernel;
             }
         }
@@ -174,15 +185,80 @@ public:
         return status;
     }
 
+    services::Status setActiveRows(const uint32_t * const rows, const size_t nRows) override
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(cache.setActiveRows);
+
+        services::Status status;
+        DAAL_ASSERT(nRows <= _nActiveRows)
+
+        if (_nUsedLines > 0)
+        {
+            /* Both sets of rows are sorted, so the new position of each kept row never exceeds the old one
+               and cached lines can be compacted in place */
+            TArray<uint32_t, cpu> oldPositionsTArray(nRows);
+            DAAL_CHECK_MALLOC(oldPositionsTArray.get());
+            uint32_t * const oldPositions = oldPositionsTArray.get();
+
+            size_t oldPos = 0;
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                while ((_activeRows.get() ? _activeRows[oldPos] : oldPos) != rows[i])
+                {
+                    ++oldPos;
+                }
+                DAAL_ASSERT(oldPos < _nActiveRows)
+                oldPositions[i] = oldPos;
+            }
+
+            daal::threader_for(_nUsedLines, _nUsedLines, [&](const size_t iLine) {
+                algorithmFPType * const cachei = _cache[iLine];
+                for (size_t i = 0; i < nRows; ++i)
+                {
+                    cachei[i] = cachei[oldPositions[i]];
+                }
+            });
+        }
+
+        if (!_activeRows.get())
+        {
+            _activeRows.reset(nRows);
+            DAAL_CHECK_MALLOC(_activeRows.get());
+        }
+        DAAL_CHECK(!services::internal::daal_memcpy_s(_activeRows.get(), nRows * sizeof(uint32_t), rows, nRows * sizeof(uint32_t)),
+                   services::ErrorMemoryCopyFailedInternal);
+
+        if (!_activeTask.get())
+        {
+            SubDataTaskBase<algorithmFPType, cpu> * task = nullptr;
+            if (_xTable->getDataLayout() == NumericTableIface::csrArray)
+            {
+                task = SubDataTaskCSR<algorithmFPType, cpu>::create(_xTable, nRows);
+            }
+            else
+            {
+                task = SubDataTaskDense<algorithmFPType, cpu>::create(_xTable->getNumberOfColumns(), nRows);
+            }
+            DAAL_CHECK_MALLOC(task);
+            _activeTask = SubDataTaskBasePtr<algorithmFPType, cpu>(task);
+        }
+        DAAL_CHECK_STATUS(status, _activeTask->copyDataByIndices(rows, nRows, _xTable));
+
+        _nActiveRows = nRows;
+        return status;
+    }
+
 protected:
     SVMCache(const size_t cacheSize, const size_t lineSize, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
-        : super(cacheSize, lineSize, kernel), _lruCache(cacheSize), _xTable(xTable)
+        : super(cacheSize, lineSize, kernel), _lruCache(cacheSize), _xTable(xTable), _nActiveRows(lineSize), _nUsedLines(0)
     {}
 
     services::Status computeKernel(const size_t nWorkElements, const uint32_t * indices)
     {
+        DAAL_ITTNOTIFY_SCOPED_TASK_WITH_BYTES(cache.computeKernel, nWorkElements * _nActiveRows * sizeof(algorithmFPType));
+
         services::Status status;
-        auto kernelComputeTable = SOANumericTableCPU<cpu>::create(nWorkElements, _lineSize, DictionaryIface::FeaturesEqual::equal, &status);
+        auto kernelComputeTable = SOANumericTableCPU<cpu>::create(nWorkElements, _nActiveRows, DictionaryIface::FeaturesEqual::equal, &status);
         DAAL_CHECK_STATUS_VAR(status);
 
         for (size_t i = 0; i < nWorkElements; ++i)
@@ -197,7 +273,8 @@ protected:
         DAAL_CHECK_STATUS_VAR(status);
         _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
 
-        _kernel->getInput()->set(kernel_function::X, _xTable);
+        /* Only the columns of the active rows are computed once some rows are shrunk */
+        _kernel->getInput()->set(kernel_function::X, _activeTask.get() ? _activeTask->getTableData() : _xTable);
         _kernel->getInput()->set(kernel_function::Y, _blockTask->getTableData());
 
         kernel_function::ResultPtr shRes(new kernel_function::Result());
@@ -224,7 +301,7 @@ protected:
 
     services::Status initCache()
     {
-        DAAL_ITTNOTIFY_SCOPED_TASK(cache.initCache);
+        DAAL_ITTNOTIFY_SCOPED_TASK_WITH_BYTES(cache.initCache, _cacheSize * _lineSize * sizeof(algorithmFPType));
 
         services::Status status;
 
@@ -291,6 +368,10 @@ protected:
     TArrayScalable<algorithmFPType *, cpu> _cache;
     TArrayScalable<algorithmFPType, cpu> _cacheData;
     TArrayScalable<algorithmFPType *, cpu> _soaData;
+    SubDataTaskBasePtr<algorithmFPType, cpu> _activeTask; /*!< Copy of the active rows of the data set */
+    TArray<uint32_t, cpu> _activeRows;                    /*!< Indices of the active rows, null if all rows are active */
+    size_t _nActiveRows;                                  /*!< Number of elements in use in each cache line */
+    size_t _nUsedLines;                                   /*!< Number of cache lines filled with kernel values */
 };
 
 } // namespace internal
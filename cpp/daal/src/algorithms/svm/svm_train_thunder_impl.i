@@ -134,17 +134,75 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
     TArray<char, cpu> I(nWS);
     DAAL_CHECK_MALLOC(I.get());
 
+    TArray<uint32_t, cpu> wsPositionsTArray(nWS);
+    DAAL_CHECK_MALLOC(wsPositionsTArray.get());
+    uint32_t * const wsPositions = wsPositionsTArray.get();
+
     size_t defaultCacheSize = services::internal::min<cpu, size_t>(nVectors, cacheSize / nVectors / sizeof(algorithmFPType));
     defaultCacheSize        = services::internal::max<cpu, size_t>(nWS, defaultCacheSize);
     auto cachePtr           = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, status);
     DAAL_CHECK_STATUS_VAR(status);
 
+    /* Shrinking: the rows of the data set whose variables are bounded and are not expected to change are excluded
+       from the working set selection, from the gradient update and from the columns of the kernel cache */
+    bool doShrinking = svmPar.doShrinking;
+    TArray<uint32_t, cpu> activeRowsTArray;
+    TArray<uint32_t, cpu> kernelPositionsTArray;
+    TArray<uint32_t, cpu> activeIndicesTArray;
+    TArray<char, cpu> shrinkFlagsTArray;
+    TArray<algorithmFPType, cpu> gradInitTArray;
+    if (doShrinking)
+    {
+        activeRowsTArray.reset(nVectors);
+        DAAL_CHECK_MALLOC(activeRowsTArray.get());
+        kernelPositionsTArray.reset(nVectors);
+        DAAL_CHECK_MALLOC(kernelPositionsTArray.get());
+        activeIndicesTArray.reset(nTrainVectors);
+        DAAL_CHECK_MALLOC(activeIndicesTArray.get());
+        shrinkFlagsTArray.reset(nVectors);
+        DAAL_CHECK_MALLOC(shrinkFlagsTArray.get());
+        gradInitTArray.reset(nTrainVectors);
+        DAAL_CHECK_MALLOC(gradInitTArray.get());
+
+        for (size_t i = 0; i < nVectors; ++i)
+        {
+            activeRowsTArray[i] = i;
+        }
+        DAAL_CHECK(!services::internal::daal_memcpy_s(gradInitTArray.get(), nTrainVectors * sizeof(algorithmFPType), grad,
+                                                      nTrainVectors * sizeof(algorithmFPType)),
+                   services::ErrorMemoryCopyFailedInternal);
+    }
+    uint32_t * const activeRows      = activeRowsTArray.get();
+    uint32_t * const kernelPositions = kernelPositionsTArray.get();
+    uint32_t * const activeIndices   = activeIndicesTArray.get();
+    char * const shrinkFlags         = shrinkFlagsTArray.get();
+    const algorithmFPType * gradInit = gradInitTArray.get();
+    size_t nActiveRows               = nVectors;
+    size_t nActiveIndices            = nTrainVectors;
+
+    /* Restores the shrunk rows and recomputes their gradients from the current alpha */
+    auto unshrinkAll = [&]() -> services::Status {
+        services::Status s;
+        cachePtr->clear();
+        DAAL_CHECK_STATUS(s, reconstructGradient(xTable, kernel, nVectors, nTrainVectors, activeRows, nActiveRows, y, alpha, gradInit, shrinkFlags,
+                                                 grad));
+        for (size_t i = 0; i < nVectors; ++i)
+        {
+            activeRows[i] = i;
+        }
+        nActiveRows    = nVectors;
+        nActiveIndices = nTrainVectors;
+        cachePtr       = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(defaultCacheSize, nWS, nVectors, xTable, kernel, s);
+        return s;
+    };
+
     if (svmType == SvmType::nu_classification || svmType == SvmType::nu_regression)
     {
         DAAL_CHECK_STATUS(status, initGrad(xTable, kernel, nVectors, nTrainVectors, y, alpha, grad));
     }
 
-    size_t iter = 0;
+    bool unshrink = false;
+    size_t iter   = 0;
     for (; iter < maxIterations; ++iter)
     {
         if (iter != 0)
@@ -152,7 +210,8 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
             DAAL_CHECK_STATUS(status, workSet.copyLastToFirst());
         }
 
-        DAAL_CHECK_STATUS(status, workSet.select(y, alpha, grad, cw));
+        const bool isShrunk = nActiveRows < nVectors;
+        DAAL_CHECK_STATUS(status, workSet.select(y, alpha, grad, cw, isShrunk ? activeIndices : nullptr, nActiveIndices));
         const uint32_t * const wsIndices = workSet.getIndices();
         algorithmFPType ** kernelSOARes  = nullptr;
         {
@@ -161,15 +220,64 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::compute(const Nume
             DAAL_CHECK_STATUS(status, cachePtr->getRowsBlock(wsIndices, nWS, kernelSOARes));
         }
 
-        DAAL_CHECK_STATUS(status, SMOBlockSolver(y, grad, wsIndices, kernelSOARes, nVectors, nWS, cw, accuracyThreshold, tau, buffer.get(), I.get(),
-                                                 alpha, deltaAlpha.get(), diff, svmType));
+        for (size_t i = 0; i < nWS; ++i)
+        {
+            const size_t dataIndex = wsIndices[i] % nVectors;
+            wsPositions[i]         = isShrunk ? kernelPositions[dataIndex] : dataIndex;
+        }
+
+        DAAL_CHECK_STATUS(status, SMOBlockSolver(y, grad, wsIndices, kernelSOARes, wsPositions, nWS, cw, accuracyThreshold, tau, buffer.get(),
+                                                 I.get(), alpha, deltaAlpha.get(), diff, svmType));
+
+        if (isShrunk)
+        {
+            DAAL_CHECK_STATUS(status,
+                              updateGradByRows(kernelSOARes, deltaAlpha.get(), grad, activeRows, nActiveRows, nVectors, nTrainVectors, nWS));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), grad, nVectors, nTrainVectors, nWS));
+        }
+
+        if (checkStopCondition(diff, diffPrev, accuracyThreshold, sameLocalDiff) && iter >= nNoChanges)
+        {
+            if (!isShrunk) break;
 
-        DAAL_CHECK_STATUS(status, updateGrad(kernelSOARes, deltaAlpha.get(), grad, nVectors, nTrainVectors, nWS));
-        if (checkStopCondition(diff, diffPrev, accuracyThreshold, sameLocalDiff) && iter >= nNoChanges) break;
+            /* Converged on the active set: check the optimality on the whole data set */
+            DAAL_CHECK_STATUS(status, unshrinkAll());
+            doShrinking   = false;
+            sameLocalDiff = 0;
+        }
+        else if (doShrinking)
+        {
+            if (!unshrink && diff < algorithmFPType(10) * accuracyThreshold)
+            {
+                unshrink = true;
+                if (isShrunk)
+                {
+                    DAAL_CHECK_STATUS(status, unshrinkAll());
+                }
+            }
+            else if ((iter + 1) % cShrinkingStep == 0)
+            {
+                const size_t nRemainingRows = shrink(y, alpha, grad, cw, wsIndices, nWS, nVectors, nTrainVectors, svmType, shrinkFlags, activeRows,
+                                                     nActiveRows, kernelPositions, activeIndices, nActiveIndices);
+                if (nRemainingRows < nActiveRows)
+                {
+                    nActiveRows = nRemainingRows;
+                    DAAL_CHECK_STATUS(status, cachePtr->setActiveRows(activeRows, nActiveRows));
+                }
+            }
+        }
         diffPrev = diff;
     }
 
     cachePtr->clear();
+    if (nActiveRows < nVectors)
+    {
+        DAAL_CHECK_STATUS(status, reconstructGradient(xTable, kernel, nVectors, nTrainVectors, activeRows, nActiveRows, y, alpha, gradInit,
+                                                      shrinkFlags, grad));
+    }
     SaveResultTask<algorithmFPType, cpu> saveResult(nVectors, y, alpha, grad, svmType, cachePtr.get());
     DAAL_CHECK_STATUS(status, saveResult.compute(xTable, *static_cast<Model *>(r), cw));
 
@@ -330,7 +438,7 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::regressionInit(Num
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::SMOBlockSolver(
-    const algorithmFPType * y, const algorithmFPType * grad, const uint32_t * wsIndices, algorithmFPType ** kernelWS, const size_t nVectors,
+    const algorithmFPType * y, const algorithmFPType * grad, const uint32_t * wsIndices, algorithmFPType ** kernelWS, const uint32_t * wsPositions,
     const size_t nWS, const algorithmFPType * cw, const double accuracyThreshold, const double tau, algorithmFPType * buffer, char * I,
     algorithmFPType * alpha, algorithmFPType * deltaAlpha, algorithmFPType & localDiff, SvmType svmType) const
 {
@@ -368,7 +476,7 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::SMOBlockSolver(
                 oldAlphaLocal[i]                           = alpha[wsIndex];
                 alphaLocal[i]                              = alpha[wsIndex];
                 cwLocal[i]                                 = cw[wsIndex];
-                kdLocal[i]                                 = kernelWSData[wsIndex % nVectors];
+                kdLocal[i]                                 = kernelWSData[wsPositions[i]];
                 char Ii                                    = free;
                 Ii |= HelperTrainSVM<algorithmFPType, cpu>::isUpper(yLocal[i], alphaLocal[i], cwLocal[i]) ? up : free;
                 Ii |= HelperTrainSVM<algorithmFPType, cpu>::isLower(yLocal[i], alphaLocal[i], cwLocal[i]) ? low : free;
@@ -379,7 +487,7 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::SMOBlockSolver(
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < nWS; ++j)
                 {
-                    kernelLocal[i * nWS + j] = kernelWSData[wsIndices[j] % nVectors];
+                    kernelLocal[i * nWS + j] = kernelWSData[wsPositions[j]];
                 }
             }
         });
@@ -575,6 +683,51 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGrad(algorit
     return services::Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::updateGradByRows(algorithmFPType ** kernelWS, const algorithmFPType * deltaalpha,
+                                                                               algorithmFPType * grad, const uint32_t * rows, const size_t nRows,
+                                                                               const size_t nVectors, const size_t nTrainVectors, const size_t nWS)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(updateGradByRows);
+
+    const size_t blockSizeGrad = 64;
+    const size_t nBlocksGrad   = (nRows / blockSizeGrad) + !!(nRows % blockSizeGrad);
+
+    DAAL_INT incX(1);
+    DAAL_INT incY(1);
+
+    /* kernelWS[i][p] holds the kernel value for rows[p], the gradient is accumulated in a dense block and then scattered */
+    daal::threader_for(nBlocksGrad, nBlocksGrad, [&](const size_t iBlockGrad) {
+        const size_t startRowGrad     = iBlockGrad * blockSizeGrad;
+        const size_t nRowsInBlockGrad = (iBlockGrad != nBlocksGrad - 1) ? blockSizeGrad : nRows - iBlockGrad * blockSizeGrad;
+
+        algorithmFPType gradDelta[blockSizeGrad];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nRowsInBlockGrad; ++j)
+        {
+            gradDelta[j] = algorithmFPType(0);
+        }
+
+        for (size_t i = 0; i < nWS; ++i)
+        {
+            algorithmFPType deltaalphai = deltaalpha[i];
+            Blas<algorithmFPType, cpu>::xxaxpy((DAAL_INT *)&nRowsInBlockGrad, &deltaalphai, kernelWS[i] + startRowGrad, &incX, gradDelta, &incY);
+        }
+
+        const uint32_t * const rowsBlock = rows + startRowGrad;
+        for (size_t j = 0; j < nRowsInBlockGrad; ++j)
+        {
+            for (size_t index = rowsBlock[j]; index < nTrainVectors; index += nVectors)
+            {
+                grad[index] += gradDelta[j];
+            }
+        }
+    });
+
+    return services::Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 bool SVMTrainImpl<thunder, algorithmFPType, cpu>::checkStopCondition(const algorithmFPType diff, const algorithmFPType diffPrev,
                                                                      const algorithmFPType accuracyThreshold, size_t & sameLocalDiff)
@@ -590,7 +743,8 @@ bool SVMTrainImpl<thunder, algorithmFPType, cpu>::checkStopCondition(const algor
 template <typename algorithmFPType, CpuType cpu>
 services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel,
                                                                        const size_t nVectors, const size_t nTrainVectors, algorithmFPType * const y,
-                                                                       algorithmFPType * const alpha, algorithmFPType * grad)
+                                                                       algorithmFPType * const alpha, algorithmFPType * grad, const uint32_t * rows,
+                                                                       const size_t nRows)
 {
     services::Status status;
 
@@ -615,7 +769,14 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(const Num
 
     const size_t nBlocks = nNonZeroAlphas / maxBlockSize + !!(nNonZeroAlphas % maxBlockSize);
 
-    auto cachePtr = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(maxBlockSize, maxBlockSize, nVectors, xTable, kernel, status);
+    /* If rows are given, the gradient is updated only for them */
+    const size_t lineSize = rows ? nRows : nVectors;
+    auto cachePtr         = SVMCache<thunder, lruCache, algorithmFPType, cpu>::create(maxBlockSize, maxBlockSize, lineSize, xTable, kernel, status);
+    DAAL_CHECK_STATUS_VAR(status);
+    if (rows)
+    {
+        DAAL_CHECK_STATUS(status, cachePtr->setActiveRows(rows, nRows));
+    }
 
     for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
     {
@@ -634,7 +795,14 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(const Num
             status |= cachePtr->getRowsBlock(indices + startRow, nRowsInBlock, kernelSOARes);
         }
 
-        status |= updateGrad(kernelSOARes, deltaAlpha + startRow, grad, nVectors, nTrainVectors, nRowsInBlock);
+        if (rows)
+        {
+            status |= updateGradByRows(kernelSOARes, deltaAlpha + startRow, grad, rows, nRows, nVectors, nTrainVectors, nRowsInBlock);
+        }
+        else
+        {
+            status |= updateGrad(kernelSOARes, deltaAlpha + startRow, grad, nVectors, nTrainVectors, nRowsInBlock);
+        }
     }
 
     cachePtr->clear();
@@ -642,6 +810,154 @@ services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::initGrad(const Num
     return status;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool SVMTrainImpl<thunder, algorithmFPType, cpu>::isShrinkable(const algorithmFPType y, const algorithmFPType alpha, const algorithmFPType cw,
+                                                               const algorithmFPType grad, const algorithmFPType GMin,
+                                                               const algorithmFPType GMax2) const
+{
+    const bool isUpper = HelperTrainSVM<algorithmFPType, cpu>::isUpper(y, alpha, cw);
+    const bool isLower = HelperTrainSVM<algorithmFPType, cpu>::isLower(y, alpha, cw);
+    if (isUpper && isLower)
+    {
+        return false;
+    }
+    if (isUpper)
+    {
+        return grad > GMax2;
+    }
+    if (isLower)
+    {
+        return grad < GMin;
+    }
+    return true;
+}
+
+/**
+ * \brief Excludes from the active set the rows whose variables are bounded and cannot be selected into a violating pair
+ *        (see the shrinking heuristic in LIBSVM). The rows of the current working set are never shrunk.
+ *
+ * \return Number of rows that remain active
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t SVMTrainImpl<thunder, algorithmFPType, cpu>::shrink(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * grad,
+                                                           const algorithmFPType * cw, const uint32_t * wsIndices, const size_t nWS,
+                                                           const size_t nVectors, const size_t nTrainVectors, const SvmType svmType, char * flags,
+                                                           uint32_t * activeRows, const size_t nActiveRows, uint32_t * kernelPositions,
+                                                           uint32_t * activeIndices, size_t & nActiveIndices)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(shrink);
+
+    /* For nu-SVM the thresholds are computed separately for the positive and the negative classes */
+    const bool isNu             = svmType == SvmType::nu_classification || svmType == SvmType::nu_regression;
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    algorithmFPType GMin[2]     = { fpMax, fpMax };
+    algorithmFPType GMax2[2]    = { -fpMax, -fpMax };
+    const size_t nTrainPerRow   = nTrainVectors / nVectors;
+
+    for (size_t i = 0; i < nActiveRows; ++i)
+    {
+        for (size_t index = activeRows[i]; index < nTrainVectors; index += nVectors)
+        {
+            const size_t sign = (isNu && y[index] < 0) ? 1 : 0;
+            if (HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[index], alpha[index], cw[index]))
+            {
+                GMin[sign] = services::internal::min<cpu, algorithmFPType>(GMin[sign], grad[index]);
+            }
+            if (HelperTrainSVM<algorithmFPType, cpu>::isLower(y[index], alpha[index], cw[index]))
+            {
+                GMax2[sign] = services::internal::max<cpu, algorithmFPType>(GMax2[sign], grad[index]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < nActiveRows; ++i)
+    {
+        flags[activeRows[i]] = 0;
+    }
+    for (size_t i = 0; i < nWS; ++i)
+    {
+        flags[wsIndices[i] % nVectors] = 1;
+    }
+
+    size_t nRemainingRows = 0;
+    for (size_t i = 0; i < nActiveRows; ++i)
+    {
+        const size_t row = activeRows[i];
+        bool keep        = flags[row];
+        for (size_t index = row; !keep && index < nTrainVectors; index += nVectors)
+        {
+            const size_t sign = (isNu && y[index] < 0) ? 1 : 0;
+            keep              = !isShrinkable(y[index], alpha[index], cw[index], grad[index], GMin[sign], GMax2[sign]);
+        }
+        flags[row] = keep;
+        nRemainingRows += keep;
+    }
+
+    /* The active set must stay large enough to fill the working set */
+    if (nRemainingRows == nActiveRows || nRemainingRows * nTrainPerRow < nWS)
+    {
+        return nActiveRows;
+    }
+
+    size_t nRows   = 0;
+    nActiveIndices = 0;
+    for (size_t i = 0; i < nActiveRows; ++i)
+    {
+        const uint32_t row = activeRows[i];
+        if (flags[row])
+        {
+            activeRows[nRows]    = row;
+            kernelPositions[row] = nRows;
+            for (size_t index = row; index < nTrainVectors; index += nVectors)
+            {
+                activeIndices[nActiveIndices++] = index;
+            }
+            ++nRows;
+        }
+    }
+    DAAL_ASSERT(nRows == nRemainingRows);
+    return nRows;
+}
+
+/**
+ * \brief Recomputes the gradient for the rows that were shrunk: grad = gradInit + sum(alpha[j] * y[j] * K(x_j, x_i))
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, cpu>::reconstructGradient(
+    const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const size_t nVectors, const size_t nTrainVectors,
+    const uint32_t * activeRows, const size_t nActiveRows, algorithmFPType * const y, algorithmFPType * const alpha, const algorithmFPType * gradInit,
+    char * flags, algorithmFPType * grad)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(reconstructGradient);
+
+    const size_t nShrunkRows = nVectors - nActiveRows;
+    TArray<uint32_t, cpu> shrunkRowsTArray(nShrunkRows);
+    DAAL_CHECK_MALLOC(shrunkRowsTArray.get());
+    uint32_t * const shrunkRows = shrunkRowsTArray.get();
+
+    services::internal::service_memset_seq<char, cpu>(flags, 0, nVectors);
+    for (size_t i = 0; i < nActiveRows; ++i)
+    {
+        flags[activeRows[i]] = 1;
+    }
+
+    size_t nRows = 0;
+    for (size_t row = 0; row < nVectors; ++row)
+    {
+        if (!flags[row])
+        {
+            shrunkRows[nRows++] = row;
+            for (size_t index = row; index < nTrainVectors; index += nVectors)
+            {
+                grad[index] = gradInit[index];
+            }
+        }
+    }
+    DAAL_ASSERT(nRows == nShrunkRows);
+
+    return initGrad(xTable, kernel, nVectors, nTrainVectors, y, alpha, grad, shrunkRows, nShrunkRows);
+}
+
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -59,17 +59,34 @@ private:
                                     algorithmFPType * cw, size_t & nNonZeroWeights, const SvmType svmType);
 
     services::Status SMOBlockSolver(const algorithmFPType * y, const algorithmFPType * grad, const uint32_t * wsIndices, algorithmFPType ** kernelWS,
-                                    const size_t nVectors, const size_t nWS, const algorithmFPType * cw, const double eps, const double tau,
+                                    const uint32_t * wsPositions, const size_t nWS, const algorithmFPType * cw, const double eps, const double tau,
                                     algorithmFPType * buffer, char * I, algorithmFPType * alpha, algorithmFPType * deltaAlpha,
                                     algorithmFPType & localDiff, SvmType svmType) const;
 
     services::Status updateGrad(algorithmFPType ** kernelWS, const algorithmFPType * deltaalpha, algorithmFPType * grad, const size_t nVectors,
                                 const size_t nTrainVectors, const size_t nWS);
 
+    services::Status updateGradByRows(algorithmFPType ** kernelWS, const algorithmFPType * deltaalpha, algorithmFPType * grad, const uint32_t * rows,
+                                      const size_t nRows, const size_t nVectors, const size_t nTrainVectors, const size_t nWS);
+
     bool checkStopCondition(const algorithmFPType diff, const algorithmFPType diffPrev, const algorithmFPType eps, size_t & sameLocalDiff);
 
     services::Status initGrad(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const size_t nVectors,
-                              const size_t nTrainVectors, algorithmFPType * const y, algorithmFPType * const alpha, algorithmFPType * grad);
+                              const size_t nTrainVectors, algorithmFPType * const y, algorithmFPType * const alpha, algorithmFPType * grad,
+                              const uint32_t * rows = nullptr, const size_t nRows = 0);
+
+    size_t shrink(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * grad, const algorithmFPType * cw,
+                  const uint32_t * wsIndices, const size_t nWS, const size_t nVectors, const size_t nTrainVectors, const SvmType svmType,
+                  char * flags, uint32_t * activeRows, const size_t nActiveRows, uint32_t * kernelPositions, uint32_t * activeIndices,
+                  size_t & nActiveIndices);
+
+    services::Status reconstructGradient(const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel, const size_t nVectors,
+                                         const size_t nTrainVectors, const uint32_t * activeRows, const size_t nActiveRows,
+                                         algorithmFPType * const y, algorithmFPType * const alpha, const algorithmFPType * gradInit, char * flags,
+                                         algorithmFPType * grad);
+
+    bool isShrinkable(const algorithmFPType y, const algorithmFPType alpha, const algorithmFPType cw, const algorithmFPType grad,
+                      const algorithmFPType GMin, const algorithmFPType GMax2) const;
 
     // One of the conditions for stopping is diff stays unchanged. nNoChanges - number of repetitions
     static const size_t nNoChanges = 5;
@@ -80,6 +97,8 @@ private:
     // Need of (maxBlockSize*6 + maxBlockSize*maxBlockSize)*sizeof(algorithmFPType) internal memory.
     // It should fit into the cache L2 including the use of hardware prefetch.
     static const size_t maxBlockSize = 2048;
+    // Number of outer iterations between the shrinking steps.
+    static const size_t cShrinkingStep = 5;
     // Inner threshold for break from SVM
     static constexpr algorithmFPType accuracyThresholdInner = algorithmFPType(1e-3);
 
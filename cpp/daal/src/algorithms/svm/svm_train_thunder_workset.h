@@ -47,7 +47,7 @@ struct TaskWorkingSet
     using IdxValType = daal::IdxValType<algorithmFPType>;
 
     TaskWorkingSet(const size_t nNonZeroWeights, const size_t nVectors, const size_t maxWS, SvmType svmType)
-        : _nNonZeroWeights(nNonZeroWeights), _nVectors(nVectors), _maxWS(maxWS), _svmType(svmType)
+        : _nNonZeroWeights(nNonZeroWeights), _nVectors(nVectors), _nActiveVectors(nVectors), _maxWS(maxWS), _svmType(svmType)
     {}
 
     services::Status init()
@@ -89,35 +89,42 @@ struct TaskWorkingSet
         return status;
     }
 
-    services::Status select(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * f, const algorithmFPType * cw)
+    /**
+     * Selects the working set among the active observations. If activeIndices is null, all observations are active.
+     */
+    services::Status select(const algorithmFPType * y, const algorithmFPType * alpha, const algorithmFPType * f, const algorithmFPType * cw,
+                            const IndexType * activeIndices = nullptr, const size_t nActiveVectors = 0)
     {
         DAAL_ITTNOTIFY_SCOPED_TASK(select);
         services::Status status;
         IdxValType * sortedFIndices = _sortedFIndices.get();
+        _nActiveVectors             = activeIndices ? nActiveVectors : _nVectors;
+        DAAL_ASSERT(_nActiveVectors >= _nWS)
 
         /* The operation copy is lightweight, therefore a large size is chosen
         so that the number of blocks is a reasonable number. */
         const size_t blockSize = 16384;
-        const size_t nBlocks   = _nVectors / blockSize + !!(_nVectors % blockSize);
+        const size_t nBlocks   = _nActiveVectors / blockSize + !!(_nActiveVectors % blockSize);
         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
             const size_t startRow = iBlock * blockSize;
-            const size_t endRow   = (iBlock != nBlocks - 1) ? startRow + blockSize : _nVectors;
+            const size_t endRow   = (iBlock != nBlocks - 1) ? startRow + blockSize : _nActiveVectors;
             for (size_t i = startRow; i < endRow; ++i)
             {
-                sortedFIndices[i].value = f[i];
-                sortedFIndices[i].index = i;
+                const IndexType index   = activeIndices ? activeIndices[i] : i;
+                sortedFIndices[i].value = f[index];
+                sortedFIndices[i].index = index;
             }
         });
 
-        daal::parallel_sort(sortedFIndices, sortedFIndices + _nVectors);
+        daal::parallel_sort(sortedFIndices, sortedFIndices + _nActiveVectors);
 
         if (_svmType == SvmType::nu_classification || _svmType == SvmType::nu_regression)
         {
             int64_t pLeftPos  = 0;
             int64_t pLeftNeg  = 0;
-            int64_t pRightPos = _nVectors - 1;
-            int64_t pRightNeg = _nVectors - 1;
-            while (_nSelected < _nWS && (pRightPos >= 0 || pRightNeg >= 0 || pLeftPos < _nVectors || pLeftNeg < _nVectors))
+            int64_t pRightPos = _nActiveVectors - 1;
+            int64_t pRightNeg = _nActiveVectors - 1;
+            while (_nSelected < _nWS && (pRightPos >= 0 || pRightNeg >= 0 || pLeftPos < _nActiveVectors || pLeftNeg < _nActiveVectors))
             {
                 moveRight(pLeftPos, sortedFIndices, y, alpha, cw, SignNuType::positive);
                 if (_nSelected == _nWS) break;
@@ -131,8 +138,8 @@ struct TaskWorkingSet
         else
         {
             int64_t pLeft  = 0;
-            int64_t pRight = _nVectors - 1;
-            while (_nSelected < _nWS && (pRight >= 0 || pLeft < _nVectors))
+            int64_t pRight = _nActiveVectors - 1;
+            while (_nSelected < _nWS && (pRight >= 0 || pLeft < _nActiveVectors))
             {
                 moveRight(pLeft, sortedFIndices, y, alpha, cw);
                 if (_nSelected == _nWS) break;
@@ -144,10 +151,11 @@ struct TaskWorkingSet
         int64_t pLeft = 0;
         while (_nSelected < _nWS)
         {
-            if (!_indicator[pLeft])
+            const IndexType i = activeIndices ? sortedFIndices[pLeft].index : pLeft;
+            if (!_indicator[i])
             {
-                _wsIndices[_nSelected] = pLeft;
-                _indicator[pLeft]      = true;
+                _wsIndices[_nSelected] = i;
+                _indicator[i]          = true;
                 ++_nSelected;
             }
             ++pLeft;
@@ -179,19 +187,19 @@ protected:
     void moveRight(int64_t & pLeft, const IdxValType * sortedFIndices, const algorithmFPType * y, const algorithmFPType * alpha,
                    const algorithmFPType * cw, SignNuType signNuType = SignNuType::none)
     {
-        if (pLeft < _nVectors)
+        if (pLeft < _nActiveVectors)
         {
             IndexType i = sortedFIndices[pLeft].index;
             while (_indicator[i] || !HelperTrainSVM<algorithmFPType, cpu>::isUpper(y[i], alpha[i], cw[i], signNuType))
             {
                 pLeft++;
-                if (pLeft == _nVectors)
+                if (pLeft == _nActiveVectors)
                 {
                     break;
                 }
                 i = sortedFIndices[pLeft].index;
             }
-            if (pLeft < _nVectors)
+            if (pLeft < _nActiveVectors)
             {
                 _wsIndices[_nSelected] = i;
                 _indicator[i]          = true;
@@ -227,6 +235,7 @@ protected:
 private:
     size_t _nNonZeroWeights;
     size_t _nVectors;
+    size_t _nActiveVectors;
     size_t _maxWS;
     size_t _nSelected;
     size_t _nWS;
@@ -250,6 +250,8 @@ FARPROC load_daal_thr_func(char * ordinal)
 
 typedef void * (*_threaded_malloc_t)(const size_t, const size_t);
 typedef void (*_threaded_free_t)(void *);
+typedef void (*_threaded_numa_first_touch_t)(void *, const size_t);
+typedef void (*_daal_set_numa_first_touch_t)(bool);
 
 typedef void (*_daal_threader_for_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_threader_for_int64_t)(int64_t, const void *, daal::functype_int64);
@@ -260,6 +262,7 @@ typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::funct
 typedef int (*_daal_threader_get_max_threads_t)(void);
 typedef int (*_daal_threader_get_current_thread_index_t)(void);
 typedef void (*_daal_threader_for_break_t)(int, int, const void *, daal::functype_break);
+typedef void (*_daal_threader_execute_in_arena_t)(int, int, const void *, daal::functype_arena);
 
 typedef int64_t (*_daal_parallel_reduce_int32_int64_t)(int32_t, int64_t, const void *, daal::loop_functype_int32_int64, const void *,
                                                        daal::reduction_functype_int64);
@@ -313,19 +316,23 @@ typedef bool (*_thread_pinner_set_pinning_t)(bool p);
 typedef void * (*_getThreadPinner_t)(bool create_pinner, void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *));
 #endif
 
-static _threaded_malloc_t _threaded_malloc_ptr = NULL;
-static _threaded_free_t _threaded_free_ptr     = NULL;
+static _threaded_malloc_t _threaded_malloc_ptr                     = NULL;
+static _threaded_free_t _threaded_free_ptr                         = NULL;
+static _threaded_numa_first_touch_t _threaded_numa_first_touch_ptr = NULL;
+static _daal_set_numa_first_touch_t _daal_set_numa_first_touch_ptr = NULL;
 
 static _daal_threader_for_t _daal_threader_for_ptr                                           = NULL;
 static _daal_threader_for_simple_t _daal_threader_for_simple_ptr                             = NULL;
 static _daal_threader_for_int64_t _daal_threader_for_int64_ptr                               = NULL;
 static _daal_threader_for_int32ptr_t _daal_threader_for_int32ptr_ptr                         = NULL;
 static _daal_static_threader_for_t _daal_static_threader_for_ptr                             = NULL;
+static _daal_static_threader_for_t _daal_numa_static_threader_for_ptr                        = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr                           = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr                                  = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr                   = NULL;
 static _daal_threader_get_current_thread_index_t _daal_threader_get_current_thread_index_ptr = NULL;
 static _daal_threader_for_break_t _daal_threader_for_break_ptr                               = NULL;
+static _daal_threader_execute_in_arena_t _daal_threader_execute_in_arena_ptr                 = NULL;
 
 static _daal_parallel_reduce_int32_int64_t _daal_parallel_reduce_int32_int64_ptr                     = NULL;
 static _daal_parallel_reduce_int32_int64_t_simple _daal_parallel_reduce_int32_int64_simple_ptr       = NULL;
@@ -396,6 +403,26 @@ DAAL_EXPORT void _threaded_scalable_free(void * ptr)
     _threaded_free_ptr(ptr);
 }
 
+DAAL_EXPORT void _threaded_numa_first_touch(void * ptr, const size_t size)
+{
+    load_daal_thr_dll();
+    if (_threaded_numa_first_touch_ptr == NULL)
+    {
+        _threaded_numa_first_touch_ptr = (_threaded_numa_first_touch_t)load_daal_thr_func("_threaded_numa_first_touch");
+    }
+    _threaded_numa_first_touch_ptr(ptr, size);
+}
+
+DAAL_EXPORT void _daal_set_numa_first_touch(bool enable)
+{
+    load_daal_thr_dll();
+    if (_daal_set_numa_first_touch_ptr == NULL)
+    {
+        _daal_set_numa_first_touch_ptr = (_daal_set_numa_first_touch_t)load_daal_thr_func("_daal_set_numa_first_touch");
+    }
+    _daal_set_numa_first_touch_ptr(enable);
+}
+
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -446,6 +473,16 @@ DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::funct
     _daal_static_threader_for_ptr(n, a, func);
 }
 
+DAAL_EXPORT void _daal_numa_static_threader_for(size_t n, const void * a, daal::functype_static func)
+{
+    load_daal_thr_dll();
+    if (_daal_numa_static_threader_for_ptr == NULL)
+    {
+        _daal_numa_static_threader_for_ptr = (_daal_static_threader_for_t)load_daal_thr_func("_daal_numa_static_threader_for");
+    }
+    _daal_numa_static_threader_for_ptr(n, a, func);
+}
+
 DAAL_EXPORT void _daal_parallel_sort_int32(int * begin_ptr, int * end_ptr)
 {
     load_daal_thr_dll();
@@ -563,6 +600,16 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
     _daal_threader_for_break_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_execute_in_arena_ptr == NULL)
+    {
+        _daal_threader_execute_in_arena_ptr = (_daal_threader_execute_in_arena_t)load_daal_thr_func("_daal_threader_execute_in_arena");
+    }
+    _daal_threader_execute_in_arena_ptr(max_concurrency, numa_node, a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -97,6 +97,8 @@ private:
         static daal::internal::ittnotify::StringHandle __ittnotify_stringhandle(#name); \
         daal::internal::ittnotify::ScopedTask __ittnotify_task(__ittnotify_domain, __ittnotify_stringhandle)
 
+    #define DAAL_ITTNOTIFY_SCOPED_TASK_WITH_BYTES(name, bytes) DAAL_ITTNOTIFY_SCOPED_TASK(name)
+
 #else
     #include "src/externals/service_profiler.h"
 
@@ -109,5 +111,10 @@ private:
     #define DAAL_ITTNOTIFY_SCOPED_TASK(name) \
         daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = daal::internal::Profiler::startTask(#name);
 
+    // Records the number of bytes processed by the task along with its timing
+    #define DAAL_ITTNOTIFY_SCOPED_TASK_WITH_BYTES(name, bytes)                                            \
+        daal::internal::ProfilerTask DAAL_ITTNOTIFY_CONCAT(__profiler_taks__, DAAL_ITTNOTIFY_UNIQUE_ID) = \
+            daal::internal::Profiler::startTask(#name, bytes);
+
 #endif // __DAAL_ITTNOTIFY_ENABLE__
 #endif // __SERVICE_ITTNOTIFY_H__
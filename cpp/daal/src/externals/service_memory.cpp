@@ -23,6 +23,7 @@
 
 #include "src/externals/service_memory.h"
 #include "src/externals/service_service.h"
+#include "src/threading/threading.h"
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
@@ -47,6 +48,13 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
     return ptr;
 }
 
+void * daal::services::internal::daal_numa_malloc(size_t size, size_t alignment)
+{
+    void * ptr = daal::services::daal_malloc(size, alignment);
+    _threaded_numa_first_touch(ptr, size);
+    return ptr;
+}
+
 void daal::services::daal_free(void * ptr)
 {
     daal::internal::Service<>::serv_free(ptr);
@@ -35,6 +35,16 @@ namespace services
 {
 namespace internal
 {
+/**
+* Allocates an aligned block of memory. If NUMA first-touch placement is enabled with
+* Environment::enableNumaFirstTouch, pages of a large block are zeroed by the threads of all NUMA nodes,
+* so that every node owns the part of the block processed by its threads in numa_static_threader_for
+* \param[in] size      Size of the block of memory in bytes
+* \param[in] alignment Alignment constraint. Must be a power of two
+* \return Pointer to the beginning of a newly allocated block of memory
+*/
+DAAL_EXPORT void * daal_numa_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
 template <typename T, CpuType cpu>
 T * service_calloc(size_t size, size_t alignment = 64)
 {
@@ -16,23 +16,231 @@
 *******************************************************************************/
 
 #include "src/externals/service_profiler.h"
+#include "src/algorithms/service_threading.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include <vector>
 
 namespace daal
 {
 namespace internal
 {
-ProfilerTask Profiler::startTask(const char * taskName)
+namespace
+{
+struct ProfilerEvent
+{
+    const char * name;
+    unsigned long long startTime; /* In nanoseconds since the start of recording */
+    unsigned long long duration;
+    size_t bytes;
+    int threadIndex; /* Index of the thread in the threading layer */
+};
+
+/* Events of one thread. Only the owning thread appends, without locks. An event is published by the release store
+   of the chunk size, so that the trace can be written while other threads still record tasks */
+class ProfilerThreadLog
+{
+public:
+    struct Chunk
+    {
+        static const size_t capacity = 1024;
+
+        Chunk() : size(0), next(nullptr) {}
+
+        ProfilerEvent events[capacity];
+        std::atomic<size_t> size;
+        std::atomic<Chunk *> next;
+    };
+
+    explicit ProfilerThreadLog(size_t id) : _threadId(id), _tail(&_head) {}
+
+    size_t threadId() const { return _threadId; }
+    const Chunk * head() const { return &_head; }
+
+    void append(const ProfilerEvent & event)
+    {
+        size_t size = _tail->size.load(std::memory_order_relaxed);
+        if (size == Chunk::capacity)
+        {
+            Chunk * chunk = new (std::nothrow) Chunk();
+            if (!chunk) return;
+            _tail->next.store(chunk, std::memory_order_release);
+            _tail = chunk;
+            size  = 0;
+        }
+        _tail->events[size] = event;
+        _tail->size.store(size + 1, std::memory_order_release);
+    }
+
+private:
+    size_t _threadId;
+    Chunk _head;
+    Chunk * _tail;
+};
+
+class ProfilerState
+{
+public:
+    static ProfilerState & get()
+    {
+        /* Created at the first instrumented task and never destroyed,
+           so that the tasks finished by other threads at exit still can be recorded */
+        static ProfilerState * state = new ProfilerState();
+        return *state;
+    }
+
+    bool isEnabled() const { return _isEnabled.load(std::memory_order_relaxed); }
+
+    void enable(const char * traceFileName)
+    {
+        {
+            AUTOLOCK(_mutex);
+            if (!traceFileName || !traceFileName[0]) return;
+            ::snprintf(_traceFileName, sizeof(_traceFileName), "%s", traceFileName);
+            if (!_isDumpRegistered)
+            {
+                _isDumpRegistered = (::atexit(dumpAtExit) == 0);
+            }
+        }
+        _isEnabled.store(true, std::memory_order_relaxed);
+    }
+
+    void disable()
+    {
+        _isEnabled.store(false, std::memory_order_relaxed);
+        AUTOLOCK(_mutex);
+        _traceFileName[0] = '\0';
+    }
+
+    unsigned long long now() const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - _origin;
+        return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void record(const ProfilerEvent & event)
+    {
+        static thread_local ProfilerThreadLog * threadLog = nullptr;
+        if (!threadLog)
+        {
+            AUTOLOCK(_mutex);
+            threadLog = new (std::nothrow) ProfilerThreadLog(_logs.size());
+            if (!threadLog) return;
+            _logs.push_back(threadLog);
+        }
+        threadLog->append(event);
+    }
+
+    bool dump()
+    {
+        AUTOLOCK(_mutex);
+        if (!_traceFileName[0]) return true;
+        FILE * file = ::fopen(_traceFileName, "w");
+        if (!file) return false;
+
+        ::fprintf(file, "{\"traceEvents\":[");
+        bool isFirst = true;
+        for (size_t i = 0; i < _logs.size(); ++i)
+        {
+            const size_t threadId = _logs[i]->threadId();
+            for (const ProfilerThreadLog::Chunk * chunk = _logs[i]->head(); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+            {
+                const size_t size = chunk->size.load(std::memory_order_acquire);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    const ProfilerEvent & e = chunk->events[j];
+                    ::fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"daal\",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,", isFirst ? "" : ",", e.name,
+                              threadId);
+                    ::fprintf(file, "\"ts\":%.3f,\"dur\":%.3f,", e.startTime / 1000.0, e.duration / 1000.0);
+                    ::fprintf(file, "\"args\":{\"bytes\":%zu,\"thread_index\":%d}}", e.bytes, e.threadIndex);
+                    isFirst = false;
+                }
+            }
+        }
+        ::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        return ::fclose(file) == 0;
+    }
+
+private:
+    ProfilerState() : _isEnabled(false), _isDumpRegistered(false), _origin(std::chrono::steady_clock::now())
+    {
+        _traceFileName[0] = '\0';
+
+        const char * traceFileName = ::getenv("DAAL_PROFILER_TRACE");
+        if (traceFileName && traceFileName[0]) enable(traceFileName);
+    }
+
+    static void dumpAtExit() { get().dump(); }
+
+    std::atomic<bool> _isEnabled;
+    bool _isDumpRegistered;
+    const std::chrono::steady_clock::time_point _origin;
+    char _traceFileName[4096];
+    Mutex _mutex;
+    std::vector<ProfilerThreadLog *> _logs;
+};
+
+} // namespace
+
+ProfilerTask Profiler::startTask(const char * taskName, size_t bytes)
+{
+    return ProfilerTask(taskName, bytes);
+}
+
+void Profiler::enable(const char * traceFileName)
+{
+    ProfilerState::get().enable(traceFileName);
+}
+
+void Profiler::disable()
+{
+    ProfilerState::get().disable();
+}
+
+bool Profiler::isEnabled()
 {
-    return ProfilerTask(taskName);
+    return ProfilerState::get().isEnabled();
 }
 
-void Profiler::endTask(const char * taskName) {}
+bool Profiler::writeTrace()
+{
+    return ProfilerState::get().dump();
+}
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+ProfilerTask::ProfilerTask(const char * taskName, size_t bytes) : _taskName(taskName), _bytes(bytes), _startTime(0), _isActive(false)
+{
+    ProfilerState & state = ProfilerState::get();
+    if (state.isEnabled())
+    {
+        _startTime = state.now();
+        _isActive  = true;
+    }
+}
+
+ProfilerTask::ProfilerTask(ProfilerTask && other)
+    : _taskName(other._taskName), _bytes(other._bytes), _startTime(other._startTime), _isActive(other._isActive)
+{
+    other._isActive = false;
+}
 
 ProfilerTask::~ProfilerTask()
 {
-    Profiler::endTask(_taskName);
+    if (!_isActive) return;
+
+    ProfilerState & state = ProfilerState::get();
+    const unsigned long long endTime = state.now();
+
+    ProfilerEvent event;
+    event.name        = _taskName;
+    event.startTime   = _startTime;
+    event.duration    = endTime - _startTime;
+    event.bytes       = _bytes;
+    event.threadIndex = _daal_threader_get_current_thread_index();
+    state.record(event);
 }
 
 } // namespace internal
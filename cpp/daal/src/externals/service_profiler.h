@@ -18,30 +18,61 @@
 /*
 //++
 //  Profiler for time measurement of kernels
+//
+//  The profiler is disabled by default. It is enabled by setting the DAAL_PROFILER_TRACE
+//  environment variable to the name of the output file, or by Profiler::enable().
+//  Every instrumented task is recorded with its start time, duration, thread and
+//  optional byte count, and the timeline is written in the Chrome trace event format
+//  at the exit of the process. The file can be opened in chrome://tracing or Perfetto.
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include <stddef.h>
+#include "services/daal_defines.h"
+
 namespace daal
 {
 namespace internal
 {
-class ProfilerTask
+class DAAL_EXPORT ProfilerTask
 {
 public:
-    ProfilerTask(const char * taskName);
+    ProfilerTask(const char * taskName, size_t bytes = 0);
+    ProfilerTask(ProfilerTask && other);
     ~ProfilerTask();
 
 private:
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask & operator=(const ProfilerTask &);
+
     const char * _taskName;
+    size_t _bytes;
+    unsigned long long _startTime;
+    bool _isActive;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+// This class can be redefined in Benchmarks
 class Profiler
 {
 public:
-    static ProfilerTask startTask(const char * taskName);
-    static void endTask(const char * taskName);
+    DAAL_EXPORT static ProfilerTask startTask(const char * taskName, size_t bytes = 0);
+
+    /* Enables recording of tasks. The timeline is written to traceFileName at the exit of the process */
+    DAAL_EXPORT static void enable(const char * traceFileName);
+
+    /* Stops recording of tasks and cancels writing of the timeline at the exit of the process */
+    DAAL_EXPORT static void disable();
+
+    DAAL_EXPORT static bool isEnabled();
+
+    /* Writes the tasks recorded so far to the trace file. Returns false if the file cannot be written */
+    DAAL_EXPORT static bool writeTrace();
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif
@@ -124,6 +124,7 @@
     DECLARE_DAAL_STRING_CONST(nTransactions)                     \
     DECLARE_DAAL_STRING_CONST(maxBins)                           \
     DECLARE_DAAL_STRING_CONST(minBinSize)                        \
+    DECLARE_DAAL_STRING_CONST(maxLeaves)                         \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(minItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(largeItemsets)                     \
@@ -326,6 +327,7 @@
     DECLARE_DAAL_STRING_CONST(nBlocks)                           \
     DECLARE_DAAL_STRING_CONST(leftBlocks)                        \
     DECLARE_DAAL_STRING_CONST(rightBlocks)                       \
+    DECLARE_DAAL_STRING_CONST(neighborhoodEngine)                \
     DECLARE_DAAL_STRING_CONST(partialWeights)                    \
     DECLARE_DAAL_STRING_CONST(step1Data)                         \
     DECLARE_DAAL_STRING_CONST(partialOrder)                      \
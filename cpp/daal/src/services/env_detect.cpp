@@ -197,3 +197,9 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+DAAL_EXPORT void daal::services::Environment::enableNumaFirstTouch(const bool enableNumaFirstTouchFlag)
+{
+    initNumberOfThreads();
+    _daal_set_numa_first_touch(enableNumaFirstTouchFlag);
+}
@@ -38,9 +38,98 @@
 
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
         #include <tbb/task.h>
+        #include <tbb/info.h>
+        #include <string.h> // memset
+        #include <vector>
+        #define DAAL_TBB_NUMA_ARENAS
     #endif
 
 using namespace daal::services;
+
+    #if defined(DAAL_TBB_NUMA_ARENAS)
+namespace
+{
+/* Buffers smaller than this are not worth distributing among NUMA nodes */
+const size_t numaFirstTouchThreshold = 16 * 1024 * 1024;
+
+/* First-touch placement is off unless enabled with Environment::enableNumaFirstTouch */
+bool numaFirstTouchEnabled = false;
+
+/* Task arenas bound to the NUMA nodes of the system. Thread indices [0, totalConcurrency) are split
+   into contiguous ranges, one per node, in proportion to the node concurrencies */
+class NumaArenas
+{
+public:
+    static NumaArenas & get()
+    {
+        static NumaArenas instance;
+        return instance;
+    }
+
+    size_t nNodes() const { return _arenas.size(); }
+    size_t totalConcurrency() const { return _offsets.back(); }
+
+    /* The per-node arenas are used only if they cover the same thread indices as the current arena:
+       a single-node system, a nested call or a reduced thread limit fall back to the regular path */
+    bool isApplicable() const
+    {
+        return nNodes() > 1 && !_daal_is_in_parallel() && totalConcurrency() == size_t(_daal_threader_get_max_threads());
+    }
+
+    /* Range [begin, end) of the n items owned by thread index tid. The same split is used for the blocks
+       of numa_static_threader_for and for the bytes of first-touched buffers, so that the rows of a block
+       are placed on the node of the thread that processes the block */
+    void threadRange(size_t n, size_t tid, size_t & begin, size_t & end) const
+    {
+        const size_t nthreads = totalConcurrency();
+        begin                 = n / nthreads * tid + n % nthreads * tid / nthreads;
+        end                   = n / nthreads * (tid + 1) + n % nthreads * (tid + 1) / nthreads;
+    }
+
+    /* Calls body(tid) for every tid in [0, totalConcurrency) in the arena of the node that owns tid */
+    template <typename Body>
+    void parallelFor(const Body & body)
+    {
+        const size_t n = nNodes();
+        std::vector<tbb::task_group> groups(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            _arenas[i].execute([&, i]() {
+                groups[i].run([&, i]() {
+                    tbb::parallel_for(
+                        tbb::blocked_range<size_t>(_offsets[i], _offsets[i + 1], 1),
+                        [&](tbb::blocked_range<size_t> r) {
+                            for (size_t tid = r.begin(); tid < r.end(); ++tid) body(tid);
+                        },
+                        tbb::static_partitioner());
+                });
+            });
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            _arenas[i].execute([&, i]() { groups[i].wait(); });
+        }
+    }
+
+private:
+    NumaArenas() : _offsets(1, 0)
+    {
+        const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+        if (nodes.size() < 2) return;
+
+        _arenas.reserve(nodes.size());
+        for (const tbb::numa_node_id node : nodes)
+        {
+            _arenas.emplace_back(tbb::task_arena::constraints(node), 0);
+            _offsets.push_back(_offsets.back() + tbb::info::default_concurrency(node));
+        }
+    }
+
+    std::vector<tbb::task_arena> _arenas;
+    std::vector<size_t> _offsets;
+};
+} // namespace
+    #endif
 #else
     #include "src/externals/service_service.h"
     #include "src/algorithms/service_qsort.h"
@@ -64,6 +153,30 @@ DAAL_EXPORT void _threaded_scalable_free(void * ptr)
 #endif
 }
 
+DAAL_EXPORT void _threaded_numa_first_touch(void * ptr, const size_t size)
+{
+#if defined(DAAL_TBB_NUMA_ARENAS)
+    if (!numaFirstTouchEnabled || !ptr || size < numaFirstTouchThreshold) return;
+
+    NumaArenas & numa = NumaArenas::get();
+    if (!numa.isApplicable()) return;
+
+    char * const bytes = static_cast<char *>(ptr);
+    numa.parallelFor([&](size_t tid) {
+        size_t begin, end;
+        numa.threadRange(size, tid, begin, end);
+        ::memset(bytes + begin, 0, end - begin);
+    });
+#endif
+}
+
+DAAL_EXPORT void _daal_set_numa_first_touch(bool enable)
+{
+#if defined(DAAL_TBB_NUMA_ARENAS)
+    numaFirstTouchEnabled = enable;
+#endif
+}
+
 DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& globalControl)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -244,6 +357,29 @@ DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::funct
 #endif
 }
 
+DAAL_EXPORT void _daal_numa_static_threader_for(size_t n, const void * a, daal::functype_static func)
+{
+#if defined(DAAL_TBB_NUMA_ARENAS)
+    NumaArenas & numa = NumaArenas::get();
+
+    /* Thread indices must stay within the range expected by the caller's thread-local storage */
+    if (numa.isApplicable())
+    {
+        numa.parallelFor([&](size_t tid) {
+            size_t begin, end;
+            numa.threadRange(n, tid, begin, end);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                func(i, tid, a);
+            }
+        });
+        return;
+    }
+#endif
+    _daal_static_threader_for(n, a, func);
+}
+
 template <typename F>
 DAAL_EXPORT void _daal_parallel_sort_template(F * begin_p, F * end_p)
 {
@@ -321,6 +457,33 @@ DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void
 #endif
 }
 
+DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (max_concurrency <= 0 && numa_node < 0)
+    {
+        func(a);
+        return;
+    }
+
+    const int concurrency = max_concurrency > 0 ? max_concurrency : int(tbb::task_arena::automatic);
+    #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
+    /* Bind the arena to the NUMA node only if such node is known to TBB */
+    int numa_id = tbb::task_arena::automatic;
+    for (const auto node : tbb::info::numa_nodes())
+    {
+        if (node == numa_node) numa_id = numa_node;
+    }
+    tbb::task_arena arena(tbb::task_arena::constraints(numa_id, concurrency));
+    #else
+    tbb::task_arena arena(concurrency);
+    #endif
+    arena.execute([&]() { func(a); });
+#elif defined(__DO_SEQ_LAYER__)
+    func(a);
+#endif
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
 #if defined(__DO_TBB_LAYER__)
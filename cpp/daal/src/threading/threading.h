@@ -47,6 +47,7 @@ typedef void (*functype2)(int i, int n, const void * a);
 typedef void * (*tls_functype)(const void * a);
 typedef void (*tls_reduce_functype)(void * p, const void * a);
 typedef void (*functype_break)(int i, bool & needBreak, const void * a);
+typedef void (*functype_arena)(const void * a);
 typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t end_idx_reduce, int64_t value_for_reduce, const void * a);
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
@@ -64,9 +65,11 @@ extern "C"
     DAAL_EXPORT void _daal_threader_for_simple(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_int32ptr(const int * begin, const int * end, const void * a, daal::functype_int32ptr func);
     DAAL_EXPORT void _daal_static_threader_for(size_t n, const void * a, daal::functype_static func);
+    DAAL_EXPORT void _daal_numa_static_threader_for(size_t n, const void * a, daal::functype_static func);
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_break(int n, int threads_request, const void * a, daal::functype_break func);
+    DAAL_EXPORT void _daal_threader_execute_in_arena(int max_concurrency, int numa_node, const void * a, daal::functype_arena func);
 
     DAAL_EXPORT int64_t _daal_parallel_reduce_int32_int64(int32_t n, int64_t init, const void * a, daal::loop_functype_int32_int64 loop_func,
                                                           const void * b, daal::reduction_functype_int64 reduction_func);
@@ -106,6 +109,8 @@ extern "C"
 
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
+    DAAL_EXPORT void _threaded_numa_first_touch(void * ptr, const size_t size);
+    DAAL_EXPORT void _daal_set_numa_first_touch(bool enable);
 
 #define DAAL_PARALLEL_SORT_DECL(TYPE, NAMESUFFIX) DAAL_EXPORT void _daal_parallel_sort_##NAMESUFFIX(TYPE * begin_ptr, TYPE * end_ptr);
     DAAL_PARALLEL_SORT_DECL(int, int32)
@@ -254,6 +259,18 @@ inline void static_threader_for(size_t n, const F & lambda)
     _daal_static_threader_for(n, a, static_threader_func<F>);
 }
 
+/* Same as static_threader_for, but the threads processing the blocks of each thread index range
+   run on the NUMA node that owns the range. The blocks are split among thread indices in proportion,
+   the same way as the bytes of buffers placed by the NUMA first-touch allocation.
+   Falls back to static_threader_for on single-node systems */
+template <typename F>
+inline void numa_static_threader_for(size_t n, const F & lambda)
+{
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_numa_static_threader_for(n, a, static_threader_func<F>);
+}
+
 template <typename F>
 inline void threader_for_blocked(int n, int threads_request, const F & lambda)
 {
@@ -21,7 +21,9 @@
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/compute.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/finalize_compute.hpp"
 #include "oneapi/dal/infer.hpp"
+#include "oneapi/dal/partial_compute.hpp"
 #include "oneapi/dal/read.hpp"
 #include "oneapi/dal/train.hpp"
 
@@ -51,6 +53,7 @@
 #include "oneapi/dal/algo/knn.hpp"
 #include "oneapi/dal/algo/linear_kernel.hpp"
 #include "oneapi/dal/algo/louvain.hpp"
+#include "oneapi/dal/algo/page_rank.hpp"
 #include "oneapi/dal/algo/pca.hpp"
 #include "oneapi/dal/algo/polynomial_kernel.hpp"
 #include "oneapi/dal/algo/sigmoid_kernel.hpp"
@@ -0,0 +1,376 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+#include "oneapi/dal/algo/basic_statistics/compute_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+#include "oneapi/dal/table/detail/csr_accessor.hpp"
+
+namespace oneapi::dal::basic_statistics::backend {
+
+namespace bk = dal::backend;
+namespace daal_lom = daal::algorithms::low_order_moments;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, daal_lom::defaultDense, Cpu>;
+
+/// Statistics accumulated over the processed rows. The arrays are stored
+/// contiguously as [n_rows, min, max, sum, sum_squares, sum_squares_centered]
+/// to be exchanged between ranks with a single collective operation.
+template <typename Float>
+struct partial_state {
+    static constexpr std::int64_t row_vector_count = 5;
+
+    std::int64_t column_count = 0;
+    array<Float> packed;
+
+    std::int64_t get_packed_count() const {
+        return 1 + row_vector_count * column_count;
+    }
+
+    /// Returns the array of the i-th statistic, the 0-th one is the number of rows
+    array<Float> get(std::int64_t i) const {
+        const std::int64_t offset = (i == 0) ? 0 : 1 + (i - 1) * column_count;
+        const std::int64_t count = (i == 0) ? 1 : column_count;
+        return array<Float>{ packed, packed.get_mutable_data() + offset, count };
+    }
+};
+
+template <typename Float>
+inline partial_state<Float> make_empty_partial_state(std::int64_t column_count) {
+    partial_state<Float> state;
+    state.column_count = column_count;
+
+    dal::detail::check_mul_overflow(column_count, partial_state<Float>::row_vector_count);
+    state.packed = array<Float>::zeros(state.get_packed_count());
+    return state;
+}
+
+template <typename Float, typename Task>
+inline partial_state<Float> make_partial_state(const partial_compute_result<Task>& partial) {
+    auto state = make_empty_partial_state<Float>(partial.get_partial_sum().get_column_count());
+
+    const table tables[] = { partial.get_partial_n_rows(),
+                             partial.get_partial_min(),
+                             partial.get_partial_max(),
+                             partial.get_partial_sum(),
+                             partial.get_partial_sum_squares(),
+                             partial.get_partial_sum_squares_centered() };
+
+    for (std::int64_t i = 0; i <= partial_state<Float>::row_vector_count; ++i) {
+        const auto rows = row_accessor<const Float>{ tables[i] }.pull();
+        auto dst = state.get(i);
+        ONEDAL_ASSERT(rows.get_count() == dst.get_count());
+        bk::copy(dst.get_mutable_data(), rows.get_data(), rows.get_count());
+    }
+    return state;
+}
+
+template <typename Float, typename Task>
+inline partial_compute_result<Task> make_partial_result(const partial_state<Float>& state) {
+    const std::int64_t column_count = state.column_count;
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(state.get(0), 1, 1))
+        .set_partial_min(homogen_table::wrap(state.get(1), 1, column_count))
+        .set_partial_max(homogen_table::wrap(state.get(2), 1, column_count))
+        .set_partial_sum(homogen_table::wrap(state.get(3), 1, column_count))
+        .set_partial_sum_squares(homogen_table::wrap(state.get(4), 1, column_count))
+        .set_partial_sum_squares_centered(homogen_table::wrap(state.get(5), 1, column_count));
+}
+
+/// Computes the statistics of the CSR data. Only non-zero elements are
+/// visited, the contribution of the zeros is accounted for analytically.
+template <typename Float>
+inline partial_state<Float> make_csr_partial_state(const dal::detail::csr_table& data) {
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    auto state = make_empty_partial_state<Float>(column_count);
+    if (row_count == 0) {
+        return state;
+    }
+
+    const auto block = dal::detail::csr_accessor<const Float>{ data }.pull();
+    const Float* values = block.data.get_data();
+    const std::int64_t* column_indices = block.column_indices.get_data();
+    const std::int64_t* row_offsets = block.row_indices.get_data();
+
+    // Indices are one-based
+    const std::int64_t nonzero_count = row_offsets[row_count] - row_offsets[0];
+
+    auto arr_column_nonzero_count = array<std::int64_t>::zeros(column_count);
+    std::int64_t* column_nonzero_count = arr_column_nonzero_count.get_mutable_data();
+
+    Float* n_rows = state.get(0).get_mutable_data();
+    Float* min = n_rows + 1;
+    Float* max = min + column_count;
+    Float* sum = max + column_count;
+    Float* sum_squares = sum + column_count;
+    Float* sum_squares_centered = sum_squares + column_count;
+
+    n_rows[0] = Float(row_count);
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        min[j] = std::numeric_limits<Float>::max();
+        max[j] = std::numeric_limits<Float>::lowest();
+    }
+
+    for (std::int64_t i = 0; i < nonzero_count; ++i) {
+        const std::int64_t j = column_indices[i] - 1;
+        const Float value = values[i];
+        ++column_nonzero_count[j];
+        min[j] = std::min(min[j], value);
+        max[j] = std::max(max[j], value);
+        sum[j] += value;
+        sum_squares[j] += value * value;
+    }
+
+    const Float inv_n_rows = Float(1) / Float(row_count);
+    for (std::int64_t i = 0; i < nonzero_count; ++i) {
+        const std::int64_t j = column_indices[i] - 1;
+        const Float diff = values[i] - sum[j] * inv_n_rows;
+        sum_squares_centered[j] += diff * diff;
+    }
+
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        const std::int64_t zero_count = row_count - column_nonzero_count[j];
+        if (zero_count > 0) {
+            const Float mean = sum[j] * inv_n_rows;
+            min[j] = std::min(min[j], Float(0));
+            max[j] = std::max(max[j], Float(0));
+            sum_squares_centered[j] += Float(zero_count) * mean * mean;
+        }
+    }
+
+    return state;
+}
+
+template <typename Float>
+inline void merge_partial_state(std::int64_t column_count, const Float* other, Float* state);
+
+/// Adds the rows of `data` to the accumulated statistics. If `is_empty` is
+/// true, the state is initialized from `data` only.
+template <typename Float>
+inline void update_partial_state(const bk::context_cpu& ctx,
+                                 const table& data,
+                                 bool is_empty,
+                                 partial_state<Float>& state) {
+    ONEDAL_ASSERT(data.get_column_count() == state.column_count);
+    const std::int64_t column_count = state.column_count;
+
+    // The statistics of the CSR block, zeros included, are computed from its
+    // non-zero elements and merged into the state, so the block is not densified
+    if (data.get_kind() == dal::detail::csr_table::kind()) {
+        const auto csr_state =
+            make_csr_partial_state<Float>(static_cast<const dal::detail::csr_table&>(data));
+        if (is_empty) {
+            state.packed = csr_state.packed;
+        }
+        else {
+            merge_partial_state(column_count,
+                                csr_state.packed.get_data(),
+                                state.packed.get_mutable_data());
+        }
+        return;
+    }
+
+    const daal_lom::PartialResultId ids[] = { daal_lom::nObservations,
+                                              daal_lom::partialMinimum,
+                                              daal_lom::partialMaximum,
+                                              daal_lom::partialSum,
+                                              daal_lom::partialSumSquares,
+                                              daal_lom::partialSumSquaresCentered };
+
+    daal_lom::PartialResult daal_partial;
+    for (std::int64_t i = 0; i <= partial_state<Float>::row_vector_count; ++i) {
+        auto arr = state.get(i);
+        daal_partial.set(ids[i],
+                         interop::convert_to_daal_homogen_table(arr, 1, i == 0 ? 1 : column_count));
+    }
+
+    // Partial result always contains all the statistics,
+    // so any set of result options can be requested on finalization
+    const daal_lom::Parameter daal_parameter{ daal_lom::estimatesAll };
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lom_online_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   &daal_partial,
+                                                                   &daal_parameter,
+                                                                   !is_empty));
+}
+
+/// Merges the statistics of another set of rows stored in the packed format
+/// into the accumulated ones
+template <typename Float>
+inline void merge_partial_state(std::int64_t column_count, const Float* other, Float* state) {
+    const Float other_n_rows = other[0];
+    if (other_n_rows == Float(0)) {
+        return;
+    }
+
+    const Float n_rows = state[0];
+    const Float* other_sums = other + 1 + 2 * column_count;
+    Float* sums = state + 1 + 2 * column_count;
+
+    if (n_rows == Float(0)) {
+        const std::int64_t packed_count = 1 + partial_state<Float>::row_vector_count * column_count;
+        for (std::int64_t i = 0; i < packed_count; ++i) {
+            state[i] = other[i];
+        }
+        return;
+    }
+
+    Float* min = state + 1;
+    Float* max = min + column_count;
+    Float* sum_squares = sums + column_count;
+    Float* sum_squares_centered = sum_squares + column_count;
+
+    const Float* other_min = other + 1;
+    const Float* other_max = other_min + column_count;
+    const Float* other_sum_squares = other_sums + column_count;
+    const Float* other_sum_squares_centered = other_sum_squares + column_count;
+
+    const Float inv_n_rows = Float(1) / n_rows;
+    const Float inv_other_n_rows = Float(1) / other_n_rows;
+    const Float inv_total_n_rows = Float(1) / (n_rows + other_n_rows);
+
+    for (std::int64_t i = 0; i < column_count; ++i) {
+        const Float total_sum = sums[i] + other_sums[i];
+        sum_squares_centered[i] += other_sum_squares_centered[i] +
+                                   sums[i] * sums[i] * inv_n_rows +
+                                   other_sums[i] * other_sums[i] * inv_other_n_rows -
+                                   total_sum * total_sum * inv_total_n_rows;
+        min[i] = std::min(min[i], other_min[i]);
+        max[i] = std::max(max[i], other_max[i]);
+        sums[i] = total_sum;
+        sum_squares[i] += other_sum_squares[i];
+    }
+
+    state[0] += other_n_rows;
+}
+
+/// Combines the statistics accumulated on all ranks. Partial results are
+/// merged in rank order, so all ranks get bitwise identical statistics.
+template <typename Float>
+inline void allreduce_partial_state(const bk::communicator& comm, partial_state<Float>& state) {
+    const std::int64_t packed_count = state.get_packed_count();
+    const std::int64_t rank_count = comm.get_rank_count();
+    dal::detail::check_mul_overflow(packed_count, rank_count);
+
+    auto gathered = array<Float>::empty(packed_count * rank_count);
+    comm.allgather(state.packed, gathered).wait();
+
+    auto merged = array<Float>::zeros(packed_count);
+    const Float* gathered_ptr = gathered.get_data();
+    Float* merged_ptr = merged.get_mutable_data();
+    for (std::int64_t rank = 0; rank < rank_count; ++rank) {
+        merge_partial_state(state.column_count, gathered_ptr + rank * packed_count, merged_ptr);
+    }
+
+    state.packed = merged;
+}
+
+/// Computes the requested statistics from the accumulated ones
+template <typename Float, typename Task>
+inline compute_result<Task> finalize_partial_state(const bk::context_cpu& ctx,
+                                                   const detail::descriptor_base<Task>& desc,
+                                                   const partial_state<Float>& state) {
+    const std::int64_t column_count = state.column_count;
+
+    auto arr_n_rows = state.get(0);
+    auto arr_min = state.get(1);
+    auto arr_max = state.get(2);
+    auto arr_sum = state.get(3);
+    auto arr_sum_squares = state.get(4);
+    auto arr_sum_squares_centered = state.get(5);
+    auto arr_mean = array<Float>::empty(column_count);
+    auto arr_sorm = array<Float>::empty(column_count);
+    auto arr_varc = array<Float>::empty(column_count);
+    auto arr_stdev = array<Float>::empty(column_count);
+    auto arr_vart = array<Float>::empty(column_count);
+
+    const auto wrap = [&](array<Float>& arr) {
+        return interop::convert_to_daal_homogen_table(arr, 1, arr.get_count());
+    };
+
+    const daal_lom::Parameter daal_parameter{ daal_lom::estimatesAll };
+    interop::status_to_exception(bk::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_lom_online_kernel_t<Float, interop::to_daal_cpu_type<decltype(cpu)>::value>()
+            .finalizeCompute(wrap(arr_n_rows).get(),
+                             wrap(arr_sum).get(),
+                             wrap(arr_sum_squares).get(),
+                             wrap(arr_sum_squares_centered).get(),
+                             wrap(arr_mean).get(),
+                             wrap(arr_sorm).get(),
+                             wrap(arr_varc).get(),
+                             wrap(arr_stdev).get(),
+                             wrap(arr_vart).get(),
+                             &daal_parameter);
+    }));
+
+    const auto res_op = desc.get_result_options();
+    auto result = compute_result<Task>{}.set_result_options(res_op);
+
+    if (res_op.test(result_options::min)) {
+        result.set_min(homogen_table::wrap(arr_min, 1, column_count));
+    }
+    if (res_op.test(result_options::max)) {
+        result.set_max(homogen_table::wrap(arr_max, 1, column_count));
+    }
+    if (res_op.test(result_options::sum)) {
+        result.set_sum(homogen_table::wrap(arr_sum, 1, column_count));
+    }
+    if (res_op.test(result_options::sum_squares)) {
+        result.set_sum_squares(homogen_table::wrap(arr_sum_squares, 1, column_count));
+    }
+    if (res_op.test(result_options::sum_squares_centered)) {
+        result.set_sum_squares_centered(
+            homogen_table::wrap(arr_sum_squares_centered, 1, column_count));
+    }
+    if (res_op.test(result_options::mean)) {
+        result.set_mean(homogen_table::wrap(arr_mean, 1, column_count));
+    }
+    if (res_op.test(result_options::second_order_raw_moment)) {
+        result.set_second_order_raw_moment(homogen_table::wrap(arr_sorm, 1, column_count));
+    }
+    if (res_op.test(result_options::variance)) {
+        result.set_variance(homogen_table::wrap(arr_varc, 1, column_count));
+    }
+    if (res_op.test(result_options::standard_deviation)) {
+        result.set_standard_deviation(homogen_table::wrap(arr_stdev, 1, column_count));
+    }
+    if (res_op.test(result_options::variation)) {
+        result.set_variation(homogen_table::wrap(arr_vart, 1, column_count));
+    }
+
+    return result;
+}
+
+} // namespace oneapi::dal::basic_statistics::backend
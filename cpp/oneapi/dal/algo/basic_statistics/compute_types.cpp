@@ -43,8 +43,35 @@ public:
     result_option_id options;
 };
 
+template <typename Task>
+class detail::v1::partial_compute_result_impl : public base {
+public:
+    table partial_n_rows;
+    table partial_min;
+    table partial_max;
+    table partial_sum;
+    table partial_sum_squares;
+    table partial_sum_squares_centered;
+};
+
+template <typename Task>
+class detail::v1::partial_compute_input_impl : public base {
+public:
+    partial_compute_input_impl(const table& data) : data(data) {}
+
+    partial_compute_input_impl(const partial_compute_result<Task>& prior_partial_result,
+                               const table& data)
+            : prior_partial_result(prior_partial_result),
+              data(data) {}
+
+    partial_compute_result<Task> prior_partial_result;
+    table data;
+};
+
 using detail::v1::compute_input_impl;
 using detail::v1::compute_result_impl;
+using detail::v1::partial_compute_input_impl;
+using detail::v1::partial_compute_result_impl;
 
 namespace v1 {
 
@@ -236,8 +263,125 @@ void compute_result<Task>::set_result_options_impl(const result_option_id& value
     impl_->options = value;
 }
 
+template <typename Task>
+partial_compute_result<Task>::partial_compute_result()
+        : impl_(new partial_compute_result_impl<Task>{}) {}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_n_rows() const {
+    return impl_->partial_n_rows;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_n_rows_impl(const table& value) {
+    impl_->partial_n_rows = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_min() const {
+    return impl_->partial_min;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_min_impl(const table& value) {
+    impl_->partial_min = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_max() const {
+    return impl_->partial_max;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_max_impl(const table& value) {
+    impl_->partial_max = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum() const {
+    return impl_->partial_sum;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_impl(const table& value) {
+    impl_->partial_sum = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum_squares() const {
+    return impl_->partial_sum_squares;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_squares_impl(const table& value) {
+    impl_->partial_sum_squares = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum_squares_centered() const {
+    return impl_->partial_sum_squares_centered;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_squares_centered_impl(const table& value) {
+    impl_->partial_sum_squares_centered = value;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::serialize(dal::detail::output_archive& ar) const {
+    ar(impl_->partial_n_rows,
+       impl_->partial_min,
+       impl_->partial_max,
+       impl_->partial_sum,
+       impl_->partial_sum_squares,
+       impl_->partial_sum_squares_centered);
+}
+
+template <typename Task>
+void partial_compute_result<Task>::deserialize(dal::detail::input_archive& ar) {
+    ar(impl_->partial_n_rows,
+       impl_->partial_min,
+       impl_->partial_max,
+       impl_->partial_sum,
+       impl_->partial_sum_squares,
+       impl_->partial_sum_squares_centered);
+}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(const table& data)
+        : impl_(new partial_compute_input_impl<Task>(data)) {}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(
+    const partial_compute_result<Task>& prior_partial_result,
+    const table& data)
+        : impl_(new partial_compute_input_impl<Task>(prior_partial_result, data)) {}
+
+template <typename Task>
+const table& partial_compute_input<Task>::get_data() const {
+    return impl_->data;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+template <typename Task>
+const partial_compute_result<Task>& partial_compute_input<Task>::get_prior_partial_result() const {
+    return impl_->prior_partial_result;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_prior_partial_result_impl(
+    const partial_compute_result<Task>& value) {
+    impl_->prior_partial_result = value;
+}
+
 template class ONEDAL_EXPORT compute_input<task::compute>;
 template class ONEDAL_EXPORT compute_result<task::compute>;
+template class ONEDAL_EXPORT partial_compute_result<task::compute>;
+template class ONEDAL_EXPORT partial_compute_input<task::compute>;
 
 } // namespace v1
 } // namespace oneapi::dal::basic_statistics
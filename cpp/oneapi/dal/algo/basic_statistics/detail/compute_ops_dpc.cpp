@@ -36,11 +36,25 @@ struct compute_ops_dispatcher<data_parallel_policy, Float, Method, Task> {
     }
 };
 
+// Sparse method is implemented only for CPU
+template <typename Float, typename Task>
+struct compute_ops_dispatcher<data_parallel_policy, Float, method::sparse, Task> {
+    compute_result<Task> operator()(const data_parallel_policy& ctx,
+                                    const descriptor_base<Task>& params,
+                                    const compute_input<Task>& input) const {
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
+            KERNEL_SINGLE_NODE_CPU(backend::compute_kernel_cpu<Float, method::sparse, Task>)>;
+        return kernel_dispatcher_t{}(ctx, params, input);
+    }
+};
+
 #define INSTANTIATE(F, M, T) \
     template struct ONEDAL_EXPORT compute_ops_dispatcher<data_parallel_policy, F, M, T>;
 
 INSTANTIATE(float, method::dense, task::compute)
 INSTANTIATE(double, method::dense, task::compute)
+INSTANTIATE(float, method::sparse, task::compute)
+INSTANTIATE(double, method::sparse, task::compute)
 
 } // namespace v1
 } // namespace oneapi::dal::basic_statistics::detail
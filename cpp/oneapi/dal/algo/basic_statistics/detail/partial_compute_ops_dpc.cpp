@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/partial_compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/detail/partial_compute_ops.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::basic_statistics::detail {
+namespace v1 {
+
+using dal::detail::data_parallel_policy;
+using dal::detail::spmd_data_parallel_policy;
+
+template <typename Policy, typename Float, typename Method, typename Task>
+struct partial_compute_ops_dispatcher<Policy, Float, Method, Task> {
+    partial_compute_result<Task> operator()(const Policy& ctx,
+                                            const descriptor_base<Task>& params,
+                                            const partial_compute_input<Task>& input) const {
+        // Streaming computation is implemented only for CPU
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
+            KERNEL_UNIVERSAL_SPMD_CPU(backend::partial_compute_kernel_cpu<Float, Method, Task>)>;
+        return kernel_dispatcher_t{}(ctx, params, input);
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                           \
+    template struct ONEDAL_EXPORT                                      \
+        partial_compute_ops_dispatcher<data_parallel_policy, F, M, T>; \
+    template struct ONEDAL_EXPORT                                      \
+        partial_compute_ops_dispatcher<spmd_data_parallel_policy, F, M, T>;
+
+INSTANTIATE(float, method::dense, task::compute)
+INSTANTIATE(double, method::dense, task::compute)
+
+} // namespace v1
+} // namespace oneapi::dal::basic_statistics::detail
@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/compute.hpp"
+#include "oneapi/dal/algo/basic_statistics/partial_compute.hpp"
+#include "oneapi/dal/algo/basic_statistics/finalize_compute.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/serialization.hpp"
+#include "oneapi/dal/test/engine/spmd.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+#include "oneapi/dal/test/engine/thread_communicator.hpp"
+
+namespace oneapi::dal::basic_statistics::test {
+
+namespace te = dal::test::engine;
+namespace bs = oneapi::dal::basic_statistics;
+
+constexpr inline std::uint64_t mask_full = 0xffffffffffffffff;
+
+template <typename TestType>
+class basic_statistics_online_test : public te::algo_fixture {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using descriptor_t = bs::descriptor<Float, Method>;
+    using partial_result_t = bs::partial_compute_result<>;
+    using result_t = bs::compute_result<>;
+
+    te::table_id get_homogen_table_id() const {
+        return te::table_id::homogen<Float>();
+    }
+
+    partial_result_t partial_compute_by_blocks(const descriptor_t& desc,
+                                               const std::vector<table>& blocks,
+                                               bool serialize_between_blocks) {
+        partial_result_t partial_result;
+        for (const auto& block : blocks) {
+            partial_result = this->partial_compute(desc, partial_result, block);
+            if (serialize_between_blocks) {
+                partial_result = te::serialize_deserialize(partial_result);
+            }
+        }
+        return partial_result;
+    }
+
+    void check_if_tables_close(const table& actual, const table& reference) {
+        const double tol = te::get_tolerance<Float>(1e-3, 1e-9);
+        const double diff = te::rel_error(reference, actual, tol);
+        CHECK(diff < tol);
+    }
+
+    void check_results_equal(bs::result_option_id compute_mode,
+                             const result_t& actual,
+                             const result_t& reference) {
+        if (compute_mode.test(result_options::min)) {
+            te::check_if_tables_equal<Float>(actual.get_min(), reference.get_min());
+        }
+        if (compute_mode.test(result_options::max)) {
+            te::check_if_tables_equal<Float>(actual.get_max(), reference.get_max());
+        }
+        if (compute_mode.test(result_options::sum)) {
+            check_if_tables_close(actual.get_sum(), reference.get_sum());
+        }
+        if (compute_mode.test(result_options::sum_squares)) {
+            check_if_tables_close(actual.get_sum_squares(), reference.get_sum_squares());
+        }
+        if (compute_mode.test(result_options::sum_squares_centered)) {
+            check_if_tables_close(actual.get_sum_squares_centered(),
+                                  reference.get_sum_squares_centered());
+        }
+        if (compute_mode.test(result_options::mean)) {
+            check_if_tables_close(actual.get_mean(), reference.get_mean());
+        }
+        if (compute_mode.test(result_options::second_order_raw_moment)) {
+            check_if_tables_close(actual.get_second_order_raw_moment(),
+                                  reference.get_second_order_raw_moment());
+        }
+        if (compute_mode.test(result_options::variance)) {
+            check_if_tables_close(actual.get_variance(), reference.get_variance());
+        }
+        if (compute_mode.test(result_options::standard_deviation)) {
+            check_if_tables_close(actual.get_standard_deviation(),
+                                  reference.get_standard_deviation());
+        }
+        if (compute_mode.test(result_options::variation)) {
+            check_if_tables_close(actual.get_variation(), reference.get_variation());
+        }
+    }
+
+    void check_against_batch(const te::dataframe& data_fr,
+                             bs::result_option_id compute_mode,
+                             const te::table_id& data_table_id,
+                             std::int64_t block_count) {
+        CAPTURE(compute_mode, block_count);
+        const table data = data_fr.get_table(this->get_policy(), data_table_id);
+        const auto desc = descriptor_t{}.set_result_options(compute_mode);
+
+        INFO("run batch compute")
+        const auto batch_result = this->compute(desc, data);
+
+        const auto blocks = te::split_table_by_rows<Float>(this->get_policy(), data, block_count);
+
+        INFO("run partial compute over blocks")
+        const auto partial_result = partial_compute_by_blocks(desc, blocks, false);
+        REQUIRE(partial_result.get_partial_n_rows().get_row_count() == 1);
+        REQUIRE(partial_result.get_partial_n_rows().get_column_count() == 1);
+        REQUIRE(partial_result.get_partial_sum().get_column_count() == data.get_column_count());
+
+        INFO("run finalize compute")
+        check_results_equal(compute_mode,
+                            this->finalize_compute(desc, partial_result),
+                            batch_result);
+
+        INFO("run partial compute with serialization between blocks")
+        const auto restored_result = partial_compute_by_blocks(desc, blocks, true);
+        check_results_equal(compute_mode,
+                            this->finalize_compute(desc, restored_result),
+                            batch_result);
+    }
+
+    void check_spmd_against_batch(const te::dataframe& data_fr,
+                                  bs::result_option_id compute_mode,
+                                  const te::table_id& data_table_id,
+                                  std::int64_t rank_count) {
+        CAPTURE(compute_mode, rank_count);
+        const table data = data_fr.get_table(this->get_policy(), data_table_id);
+        const auto desc = descriptor_t{}.set_result_options(compute_mode);
+
+        INFO("run batch compute")
+        const auto batch_result = this->compute(desc, data);
+
+        INFO("run partial compute on every rank and merge in finalize compute")
+        const auto data_per_rank =
+            te::split_table_by_rows<Float>(this->get_policy(), data, rank_count);
+        te::thread_communicator comm{ rank_count };
+        const auto results = comm.map([&](std::int64_t rank) {
+            const auto partial_result = this->partial_compute(desc, data_per_rank[rank]);
+            return te::spmd_finalize_compute(this->get_policy(), comm, desc, partial_result);
+        });
+
+        REQUIRE(results.size() == std::size_t(rank_count));
+        for (const auto& result : results) {
+            check_results_equal(compute_mode, result, batch_result);
+        }
+    }
+};
+
+using basic_statistics_types = COMBINE_TYPES((float, double), (basic_statistics::method::dense));
+
+TEMPLATE_LIST_TEST_M(basic_statistics_online_test,
+                     "basic_statistics online results match batch ones",
+                     "[basic_statistics][integration][online]",
+                     basic_statistics_types) {
+    // Streaming computation is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_normal(-30, 30, 7777),
+                           te::dataframe_builder{ 500, 250 }.fill_normal(0, 1, 7777));
+
+    bs::result_option_id res_min_max = result_options::min | result_options::max;
+    bs::result_option_id res_mean_varc = result_options::mean | result_options::variance;
+    bs::result_option_id res_all = bs::result_option_id(dal::result_option_id_base(mask_full));
+
+    const bs::result_option_id compute_mode = GENERATE_COPY(res_min_max, res_mean_varc, res_all);
+    const std::int64_t block_count = GENERATE(1, 3, 10);
+
+    const auto data_table_id = this->get_homogen_table_id();
+    this->check_against_batch(data, compute_mode, data_table_id, block_count);
+}
+
+TEMPLATE_LIST_TEST_M(basic_statistics_online_test,
+                     "basic_statistics finalize compute merges partial results in spmd mode",
+                     "[basic_statistics][integration][online][spmd]",
+                     basic_statistics_types) {
+    // Streaming computation is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_normal(-30, 30, 7777));
+
+    const bs::result_option_id res_all =
+        bs::result_option_id(dal::result_option_id_base(mask_full));
+    const std::int64_t rank_count = GENERATE(2, 4);
+
+    const auto data_table_id = this->get_homogen_table_id();
+    this->check_spmd_against_batch(data, res_all, data_table_id, rank_count);
+}
+
+} // namespace oneapi::dal::basic_statistics::test
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/compute.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::basic_statistics::test {
+
+namespace te = dal::test::engine;
+namespace bs = oneapi::dal::basic_statistics;
+
+constexpr inline std::uint64_t mask_full = 0xffffffffffffffff;
+
+template <typename TestType>
+class basic_statistics_sparse_test : public te::float_algo_fixture<TestType> {
+public:
+    using Float = TestType;
+    using dense_descriptor_t = bs::descriptor<Float, bs::method::dense>;
+    using sparse_descriptor_t = bs::descriptor<Float, bs::method::sparse>;
+
+    void check_against_dense(const table& dense_data) {
+        const auto res_all = bs::result_option_id(dal::result_option_id_base(mask_full));
+        const auto sparse_data = te::convert_to_csr_table<Float>(dense_data);
+
+        INFO("run compute on dense data")
+        const auto dense_result =
+            this->compute(dense_descriptor_t{}.set_result_options(res_all), dense_data);
+
+        INFO("run compute on sparse data")
+        const auto sparse_result =
+            this->compute(sparse_descriptor_t{}.set_result_options(res_all), sparse_data);
+
+        check_table(dense_result.get_min(), sparse_result.get_min(), "min");
+        check_table(dense_result.get_max(), sparse_result.get_max(), "max");
+        check_table(dense_result.get_sum(), sparse_result.get_sum(), "sum");
+        check_table(dense_result.get_sum_squares(),
+                    sparse_result.get_sum_squares(),
+                    "sum squares");
+        check_table(dense_result.get_sum_squares_centered(),
+                    sparse_result.get_sum_squares_centered(),
+                    "sum squares centered");
+        check_table(dense_result.get_mean(), sparse_result.get_mean(), "mean");
+        check_table(dense_result.get_second_order_raw_moment(),
+                    sparse_result.get_second_order_raw_moment(),
+                    "second order raw moment");
+        check_table(dense_result.get_variance(), sparse_result.get_variance(), "variance");
+        check_table(dense_result.get_standard_deviation(),
+                    sparse_result.get_standard_deviation(),
+                    "standard deviation");
+        check_table(dense_result.get_variation(), sparse_result.get_variation(), "variation");
+    }
+
+    void check_table(const table& ref, const table& res, const std::string& name) const {
+        CAPTURE(name);
+        REQUIRE(ref.get_column_count() == res.get_column_count());
+        const double tol = te::get_tolerance<Float>(1e-3, 1e-9);
+        CHECK(te::rel_error(ref, res, tol) < tol);
+    }
+};
+
+using basic_statistics_sparse_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_M(basic_statistics_sparse_test,
+                     "basic_statistics sparse results match dense ones",
+                     "[basic_statistics][integration][sparse]",
+                     basic_statistics_sparse_types) {
+    // Sparse method is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = TestType;
+    const std::int64_t row_count = GENERATE(100, 1000);
+    const std::int64_t column_count = GENERATE(10, 200);
+    const double nonzero_ratio = GENERATE(0.05, 0.5);
+
+    const auto data = te::generate_sparse_homogen_table<Float>(row_count,
+                                                               column_count,
+                                                               nonzero_ratio,
+                                                               1.0,
+                                                               10.0,
+                                                               7777);
+    this->check_against_dense(data);
+}
+
+TEMPLATE_LIST_TEST_M(basic_statistics_sparse_test,
+                     "basic_statistics sparse method throws if data is not a csr table",
+                     "[basic_statistics][sparse][badarg]",
+                     basic_statistics_sparse_types) {
+    SKIP_IF(!this->get_policy().is_cpu());
+
+    using Float = TestType;
+    const auto data = te::generate_sparse_homogen_table<Float>(10, 4, 0.5, -1.0, 1.0, 7777);
+    const auto desc = bs::descriptor<Float, bs::method::sparse>{};
+
+    REQUIRE_THROWS_AS(this->compute(desc, data), invalid_argument);
+}
+
+} // namespace oneapi::dal::basic_statistics::test
@@ -15,21 +15,181 @@
 *******************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+
 #include "oneapi/dal/algo/connected_components/common.hpp"
 #include "oneapi/dal/algo/connected_components/vertex_partitioning_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
 #include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
-#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
 
 namespace oneapi::dal::preview::connected_components::backend {
+using namespace oneapi::dal::preview::detail;
+using namespace oneapi::dal::preview::backend;
+
+/// Number of the first neighbors of every vertex linked before the largest
+/// intermediate component is found
+constexpr std::int32_t afforest_neighbor_round_count = 2;
+
+/// Number of vertices sampled to find the largest intermediate component
+constexpr std::int64_t afforest_sample_count = 1024;
+
+/// Lock-free union-find over the parent array. Trees are hooked from the higher
+/// root to the lower one, so there are no cycles and every component ends up with
+/// the minimal vertex as the root.
+class disjoint_set {
+public:
+    explicit disjoint_set(std::atomic<std::int32_t>* parents) : parents_(parents) {}
+
+    std::int32_t get_parent(std::int32_t u) const {
+        return parents_[u].load(std::memory_order_relaxed);
+    }
+
+    void link(std::int32_t u, std::int32_t v) {
+        std::int32_t p1 = get_parent(u);
+        std::int32_t p2 = get_parent(v);
+        while (p1 != p2) {
+            const std::int32_t high = std::max(p1, p2);
+            const std::int32_t low = std::min(p1, p2);
+            std::int32_t p_high = get_parent(high);
+            if (p_high == low) {
+                break;
+            }
+            if (p_high == high &&
+                parents_[high].compare_exchange_strong(p_high, low, std::memory_order_relaxed)) {
+                break;
+            }
+            p1 = get_parent(get_parent(high));
+            p2 = get_parent(low);
+        }
+    }
+
+    /// Makes every vertex point to the root of its tree
+    void compress(std::int32_t u) {
+        std::int32_t parent = get_parent(u);
+        std::int32_t grandparent = get_parent(parent);
+        while (parent != grandparent) {
+            parents_[u].store(grandparent, std::memory_order_relaxed);
+            parent = grandparent;
+            grandparent = get_parent(parent);
+        }
+    }
+
+private:
+    std::atomic<std::int32_t>* parents_;
+};
+
+/// Returns the most frequent root among the sampled vertices. Vertices are
+/// sampled with the fixed seed, so the result does not depend on the run.
+inline std::int32_t find_largest_component(const disjoint_set& components,
+                                           std::int64_t vertex_count,
+                                           inner_alloc<std::int32_t>& allocator) {
+    const std::int64_t sample_count = std::min(vertex_count, afforest_sample_count);
+    auto samples_mem = allocator.make_shared_memory(sample_count);
+    std::int32_t* samples = samples_mem.get();
+
+    std::uint64_t state = 0x2545F4914F6CDD1Dull;
+    for (std::int64_t i = 0; i < sample_count; ++i) {
+        // xorshift64 generator
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const auto u = static_cast<std::int32_t>(state % static_cast<std::uint64_t>(vertex_count));
+        samples[i] = components.get_parent(u);
+    }
+    std::sort(samples, samples + sample_count);
+
+    std::int32_t largest = samples[0];
+    std::int64_t largest_size = 0;
+    for (std::int64_t begin = 0; begin < sample_count;) {
+        std::int64_t end = begin + 1;
+        while (end < sample_count && samples[end] == samples[begin]) {
+            ++end;
+        }
+        if (end - begin > largest_size) {
+            largest = samples[begin];
+            largest_size = end - begin;
+        }
+        begin = end;
+    }
+    return largest;
+}
 
 template <typename Cpu>
 struct afforest {
     vertex_partitioning_result<task::vertex_partitioning> operator()(
         const detail::descriptor_base<task::vertex_partitioning>& desc,
-        const dal::preview::detail::topology<std::int32_t>& t) {
-        throw unimplemented(oneapi::dal::detail::error_messages::method_not_implemented());
+        const dal::preview::detail::topology<std::int32_t>& t,
+        byte_alloc_iface* alloc_ptr) {
+        const std::int64_t vertex_count = t.get_vertex_count();
+        if (vertex_count == 0) {
+            return vertex_partitioning_result<task::vertex_partitioning>()
+                .set_labels(table{})
+                .set_component_count(0);
+        }
+
+        inner_alloc<std::atomic<std::int32_t>> parent_allocator(alloc_ptr);
+        inner_alloc<std::int32_t> vertex_allocator(alloc_ptr);
+
+        auto parents_mem = parent_allocator.make_shared_memory(vertex_count);
+        std::atomic<std::int32_t>* parents = parents_mem.get();
+        disjoint_set components(parents);
+
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            parents[u].store(u, std::memory_order_relaxed);
+        });
+
+        // Link the first neighbors of every vertex, the intermediate components
+        // already cover the most part of the graph
+        for (std::int32_t round = 0; round < afforest_neighbor_round_count; ++round) {
+            dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+                if (round < t.get_vertex_degree(u)) {
+                    components.link(u, t.get_vertex_neighbors_begin(u)[round]);
+                }
+            });
+            dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+                components.compress(u);
+            });
+        }
+
+        // Vertices of the largest intermediate component are skipped. The graph is
+        // undirected, so their remaining edges are linked from the other side.
+        const std::int32_t largest = find_largest_component(components,
+                                                            vertex_count,
+                                                            vertex_allocator);
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            if (components.get_parent(u) == largest ||
+                t.get_vertex_degree(u) <= afforest_neighbor_round_count) {
+                return;
+            }
+            const auto neighbors_end = t.get_vertex_neighbors_end(u);
+            for (auto v = t.get_vertex_neighbors_begin(u) + afforest_neighbor_round_count;
+                 v < neighbors_end;
+                 ++v) {
+                components.link(u, *v);
+            }
+        });
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            components.compress(u);
+        });
+
+        // Roots are the minimal vertices of components, so the labels are assigned
+        // in the order of the first vertex of every component
+        auto labels_arr = array<std::int32_t>::empty(vertex_count);
+        std::int32_t* labels = labels_arr.get_mutable_data();
+        std::int64_t component_count = 0;
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            const std::int32_t root = components.get_parent(u);
+            labels[u] = (root == u) ? static_cast<std::int32_t>(component_count++) : labels[root];
+        }
+
+        return vertex_partitioning_result<task::vertex_partitioning>()
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(labels_arr, vertex_count, 1).build())
+            .set_component_count(component_count);
     }
 };
 
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "oneapi/dal/algo/connected_components.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::connected_components::test {
+
+namespace dal = oneapi::dal;
+
+using edge_t = std::pair<std::int32_t, std::int32_t>;
+
+class connected_components_test {
+public:
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+
+    /// Builds the undirected graph from the list of edges, every edge is listed once
+    graph_t create_graph(std::int64_t vertex_count, const std::vector<edge_t> &edges) {
+        graph_t g;
+        auto &graph_impl = oneapi::dal::detail::get_impl(g);
+        auto &vertex_allocator = graph_impl._vertex_allocator;
+        auto &edge_allocator = graph_impl._edge_allocator;
+
+        const std::int64_t edge_count = edges.size();
+        const std::int64_t cols_count = edge_count * 2;
+        const std::int64_t rows_count = vertex_count + 1;
+
+        std::int32_t *degrees =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
+        std::int32_t *cols = oneapi::dal::preview::detail::allocate(vertex_allocator, cols_count);
+        std::int64_t *rows = oneapi::dal::preview::detail::allocate(edge_allocator, rows_count);
+        std::int32_t *rows_vertex =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, rows_count);
+
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            degrees[u] = 0;
+        }
+        for (const auto &[u, v] : edges) {
+            degrees[u]++;
+            degrees[v]++;
+        }
+        rows[0] = 0;
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            rows[u + 1] = rows[u] + degrees[u];
+        }
+        for (std::int64_t i = 0; i < rows_count; ++i) {
+            rows_vertex[i] = static_cast<std::int32_t>(rows[i]);
+        }
+
+        std::vector<std::int64_t> offsets(rows, rows + vertex_count);
+        for (const auto &[u, v] : edges) {
+            cols[offsets[u]++] = v;
+            cols[offsets[v]++] = u;
+        }
+
+        graph_impl.set_topology(vertex_count, edge_count, rows, cols, cols_count, degrees);
+        graph_impl.get_topology()._rows_vertex =
+            oneapi::dal::preview::detail::container<std::int32_t>::wrap(rows_vertex, rows_count);
+        return g;
+    }
+
+    /// Generates the random edges inside the groups of consecutive vertices,
+    /// so every group is a component with high probability
+    std::vector<edge_t> get_random_edges(std::int32_t group_count,
+                                         std::int32_t group_size,
+                                         std::int64_t edges_per_group) {
+        std::mt19937 rng(7777);
+        std::uniform_int_distribution<std::int32_t> distr(0, group_size - 1);
+        std::vector<edge_t> edges;
+        for (std::int32_t g = 0; g < group_count; ++g) {
+            const std::int32_t first = g * group_size;
+            for (std::int64_t i = 0; i < edges_per_group; ++i) {
+                const std::int32_t u = first + distr(rng);
+                const std::int32_t v = first + distr(rng);
+                if (u != v) {
+                    edges.emplace_back(u, v);
+                }
+            }
+        }
+        return edges;
+    }
+
+    /// Computes the components by the sequential breadth-first search. Labels are
+    /// assigned in the order of the first vertex of every component.
+    std::vector<std::int32_t> get_reference_labels(std::int64_t vertex_count,
+                                                   const std::vector<edge_t> &edges) {
+        std::vector<std::vector<std::int32_t>> adjacency(vertex_count);
+        for (const auto &[u, v] : edges) {
+            adjacency[u].push_back(v);
+            adjacency[v].push_back(u);
+        }
+
+        std::vector<std::int32_t> labels(vertex_count, -1);
+        std::int32_t component_count = 0;
+        for (std::int64_t s = 0; s < vertex_count; ++s) {
+            if (labels[s] >= 0) {
+                continue;
+            }
+            std::vector<std::int64_t> queue = { s };
+            labels[s] = component_count;
+            for (std::size_t i = 0; i < queue.size(); ++i) {
+                for (const auto v : adjacency[queue[i]]) {
+                    if (labels[v] < 0) {
+                        labels[v] = component_count;
+                        queue.push_back(v);
+                    }
+                }
+            }
+            ++component_count;
+        }
+        return labels;
+    }
+
+    std::vector<std::int32_t> get_labels(const dal::table &labels_table) {
+        const auto labels_arr = dal::row_accessor<const std::int32_t>(labels_table).pull();
+        return std::vector<std::int32_t>(labels_arr.get_data(),
+                                         labels_arr.get_data() + labels_arr.get_count());
+    }
+
+    void check_against_reference(std::int64_t vertex_count, const std::vector<edge_t> &edges) {
+        const auto graph = create_graph(vertex_count, edges);
+        const auto result =
+            dal::preview::vertex_partitioning(dal::preview::connected_components::descriptor<>(),
+                                              graph);
+
+        const auto reference = get_reference_labels(vertex_count, edges);
+        const auto labels = get_labels(result.get_labels());
+        const std::int64_t component_count =
+            vertex_count > 0 ? *std::max_element(reference.begin(), reference.end()) + 1 : 0;
+
+        REQUIRE(result.get_component_count() == component_count);
+        REQUIRE(labels == reference);
+    }
+};
+
+#define CONNECTED_COMPONENTS_TEST(name) \
+    TEST_M(connected_components_test, name, "[connected_components]")
+
+CONNECTED_COMPONENTS_TEST("Cliques, paths and isolated vertices") {
+    const std::vector<edge_t> edges = { // Clique 0-2-4
+                                        { 0, 2 },
+                                        { 2, 4 },
+                                        { 4, 0 },
+                                        // Path 1-3-5-6
+                                        { 5, 3 },
+                                        { 1, 3 },
+                                        { 6, 5 },
+                                        // Self-loop on 8, vertex 7 is isolated
+                                        { 8, 8 },
+                                        // Star with the center 12
+                                        { 12, 9 },
+                                        { 12, 10 },
+                                        { 12, 11 }
+    };
+    this->check_against_reference(13, edges);
+}
+
+CONNECTED_COMPONENTS_TEST("Large component is skipped after sampling") {
+    // The first group is much larger than the others
+    auto edges = get_random_edges(1, 20000, 100000);
+    const auto small_edges = get_random_edges(100, 50, 200);
+    for (const auto &[u, v] : small_edges) {
+        edges.emplace_back(u + 20000, v + 20000);
+    }
+    this->check_against_reference(25000, edges);
+}
+
+CONNECTED_COMPONENTS_TEST("Many sparse components") {
+    const auto edges = get_random_edges(500, 40, 30);
+    this->check_against_reference(20000, edges);
+}
+
+CONNECTED_COMPONENTS_TEST("Graph without edges") {
+    this->check_against_reference(5, {});
+}
+
+} // namespace oneapi::dal::algo::connected_components::test
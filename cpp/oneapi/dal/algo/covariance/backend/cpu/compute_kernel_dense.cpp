@@ -17,6 +17,7 @@
 #include "daal/src/algorithms/covariance/covariance_kernel.h"
 
 #include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_state.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -106,10 +107,25 @@ static compute_result<Task> call_daal_kernel(const context_cpu& ctx,
     return result;
 }
 
+template <typename Float, typename Task>
+static compute_result<Task> call_daal_spmd_kernel(const context_cpu& ctx,
+                                                  const descriptor_t& desc,
+                                                  const table& data) {
+    auto state = make_empty_partial_state<Float>(data.get_column_count());
+    if (data.get_row_count() > 0) {
+        update_partial_state(ctx, data, state);
+    }
+    allreduce_partial_state(ctx.get_communicator(), state);
+    return finalize_partial_state(ctx, desc, state);
+}
+
 template <typename Float, typename Task>
 static compute_result<Task> compute(const context_cpu& ctx,
                                     const descriptor_t& desc,
                                     const compute_input<Task>& input) {
+    if (ctx.get_communicator().get_rank_count() > 1) {
+        return call_daal_spmd_kernel<Float, Task>(ctx, desc, input.get_data());
+    }
     return call_daal_kernel<Float, Task>(ctx, desc, input.get_data());
 }
 
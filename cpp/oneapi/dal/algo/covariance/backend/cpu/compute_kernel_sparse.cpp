@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_state.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::compute>;
+
+template <typename Float, typename Task>
+static compute_result<Task> compute(const context_cpu& ctx,
+                                    const descriptor_t& desc,
+                                    const compute_input<Task>& input) {
+    const auto& data = input.get_data();
+
+    // Cross-product of the CSR data is accumulated by the sparse DAAL kernel,
+    // so the data is never converted to the dense format
+    auto state = make_empty_partial_state<Float>(data.get_column_count());
+    if (data.get_row_count() > 0) {
+        update_partial_state(ctx, data, state);
+    }
+    if (ctx.get_communicator().get_rank_count() > 1) {
+        allreduce_partial_state(ctx.get_communicator(), state);
+    }
+    return finalize_partial_state(ctx, desc, state);
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::sparse, task::compute> {
+    compute_result<task::compute> operator()(const context_cpu& ctx,
+                                             const descriptor_t& desc,
+                                             const compute_input<task::compute>& input) const {
+        return compute<Float, task::compute>(ctx, desc, input);
+    }
+};
+
+template struct compute_kernel_cpu<float, method::sparse, task::compute>;
+template struct compute_kernel_cpu<double, method::sparse, task::compute>;
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_compute_kernel.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_state.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using dal::backend::context_cpu;
+using input_t = partial_compute_input<task::compute>;
+using result_t = partial_compute_result<task::compute>;
+using descriptor_t = detail::descriptor_base<task::compute>;
+
+template <typename Float>
+static result_t partial_compute(const context_cpu& ctx,
+                                const descriptor_t& desc,
+                                const input_t& input) {
+    const auto& data = input.get_data();
+    const auto& prior = input.get_prior_partial_result();
+
+    auto state = prior.get_partial_n_rows().has_data()
+                     ? make_partial_state<Float>(prior)
+                     : make_empty_partial_state<Float>(data.get_column_count());
+    update_partial_state(ctx, data, state);
+
+    return make_partial_result<Float, task::compute>(state);
+}
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method::by_default, task::compute> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return partial_compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct partial_compute_kernel_cpu<float, method::dense, task::compute>;
+template struct partial_compute_kernel_cpu<double, method::dense, task::compute>;
+
+} // namespace oneapi::dal::covariance::backend
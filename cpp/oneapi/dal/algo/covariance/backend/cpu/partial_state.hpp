@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "daal/src/algorithms/covariance/covariance_kernel.h"
+
+#include "oneapi/dal/algo/covariance/compute_types.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+namespace bk = dal::backend;
+namespace daal_covariance = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_covariance_online_kernel_t = daal_covariance::internal::
+    CovarianceDenseOnlineKernel<Float, daal_covariance::Method::defaultDense, Cpu>;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_covariance_csr_online_kernel_t = daal_covariance::internal::
+    CovarianceCSROnlineKernel<Float, daal_covariance::Method::fastCSR, Cpu>;
+
+/// Statistics accumulated over the processed rows: the number of rows,
+/// the column sums and the cross-product of the centered rows
+template <typename Float>
+struct partial_state {
+    std::int64_t column_count = 0;
+    array<Float> n_rows;
+    array<Float> sums;
+    array<Float> crossproduct;
+};
+
+template <typename Float>
+inline partial_state<Float> make_empty_partial_state(std::int64_t column_count) {
+    dal::detail::check_mul_overflow(column_count, column_count);
+
+    partial_state<Float> state;
+    state.column_count = column_count;
+    state.n_rows = array<Float>::zeros(1);
+    state.sums = array<Float>::zeros(column_count);
+    state.crossproduct = array<Float>::zeros(column_count * column_count);
+    return state;
+}
+
+template <typename Float>
+inline array<Float> pull_mutable_copy(const table& t) {
+    const auto rows = row_accessor<const Float>{ t }.pull();
+    auto copy = array<Float>::empty(rows.get_count());
+    bk::copy(copy.get_mutable_data(), rows.get_data(), rows.get_count());
+    return copy;
+}
+
+template <typename Float, typename Task>
+inline partial_state<Float> make_partial_state(const partial_compute_result<Task>& partial) {
+    partial_state<Float> state;
+    state.column_count = partial.get_partial_sum().get_column_count();
+    state.n_rows = pull_mutable_copy<Float>(partial.get_partial_n_rows());
+    state.sums = pull_mutable_copy<Float>(partial.get_partial_sum());
+    state.crossproduct = pull_mutable_copy<Float>(partial.get_partial_crossproduct());
+    return state;
+}
+
+template <typename Float, typename Task>
+inline partial_compute_result<Task> make_partial_result(const partial_state<Float>& state) {
+    const std::int64_t column_count = state.column_count;
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(state.n_rows, 1, 1))
+        .set_partial_sum(homogen_table::wrap(state.sums, 1, column_count))
+        .set_partial_crossproduct(
+            homogen_table::wrap(state.crossproduct, column_count, column_count));
+}
+
+/// Adds the rows of `data` to the accumulated statistics
+template <typename Float>
+inline void update_partial_state(const bk::context_cpu& ctx,
+                                 const table& data,
+                                 partial_state<Float>& state) {
+    ONEDAL_ASSERT(data.get_column_count() == state.column_count);
+    const std::int64_t column_count = state.column_count;
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(state.n_rows, 1, 1);
+    const auto daal_sums = interop::convert_to_daal_homogen_table(state.sums, 1, column_count);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(state.crossproduct, column_count, column_count);
+
+    daal_covariance::Parameter daal_parameter;
+
+    // CSR data is processed by the sparse kernel without conversion to the dense format
+    if (data.get_kind() == dal::detail::csr_table::kind()) {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_covariance_csr_online_kernel_t>(
+                ctx,
+                daal_data.get(),
+                daal_n_rows.get(),
+                daal_crossproduct.get(),
+                daal_sums.get(),
+                &daal_parameter));
+    }
+    else {
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_covariance_online_kernel_t>(
+                ctx,
+                daal_data.get(),
+                daal_n_rows.get(),
+                daal_crossproduct.get(),
+                daal_sums.get(),
+                &daal_parameter));
+    }
+}
+
+/// Merges the statistics of another set of rows stored as
+/// [n_rows, sums, crossproduct] into the accumulated ones
+template <typename Float>
+inline void merge_partial_state(std::int64_t column_count, const Float* other, Float* state) {
+    const Float other_n_rows = other[0];
+    if (other_n_rows == Float(0)) {
+        return;
+    }
+
+    const Float* other_sums = other + 1;
+    const Float* other_cp = other_sums + column_count;
+
+    Float& n_rows = state[0];
+    Float* sums = state + 1;
+    Float* cp = sums + column_count;
+
+    if (n_rows == Float(0)) {
+        for (std::int64_t i = 0; i < column_count * column_count; ++i) {
+            cp[i] = other_cp[i];
+        }
+    }
+    else {
+        const Float inv_n_rows = Float(1) / n_rows;
+        const Float inv_other_n_rows = Float(1) / other_n_rows;
+        const Float inv_total_n_rows = Float(1) / (n_rows + other_n_rows);
+        for (std::int64_t i = 0; i < column_count; ++i) {
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                cp[i * column_count + j] += other_cp[i * column_count + j] +
+                                            sums[i] * sums[j] * inv_n_rows +
+                                            other_sums[i] * other_sums[j] * inv_other_n_rows -
+                                            (sums[i] + other_sums[i]) *
+                                                (sums[j] + other_sums[j]) * inv_total_n_rows;
+            }
+        }
+    }
+
+    n_rows += other_n_rows;
+    for (std::int64_t i = 0; i < column_count; ++i) {
+        sums[i] += other_sums[i];
+    }
+}
+
+/// Combines the statistics accumulated on all ranks. Partial results are
+/// merged in rank order, so all ranks get bitwise identical statistics.
+template <typename Float>
+inline void allreduce_partial_state(const bk::communicator& comm, partial_state<Float>& state) {
+    const std::int64_t column_count = state.column_count;
+    const std::int64_t rank_count = comm.get_rank_count();
+    const std::int64_t cp_count = column_count * column_count;
+    const std::int64_t packed_count =
+        dal::detail::check_sum_overflow(cp_count, column_count + 1);
+    dal::detail::check_mul_overflow(packed_count, rank_count);
+
+    auto local = array<Float>::empty(packed_count);
+    {
+        Float* local_ptr = local.get_mutable_data();
+        local_ptr[0] = state.n_rows.get_data()[0];
+        bk::copy(local_ptr + 1, state.sums.get_data(), column_count);
+        bk::copy(local_ptr + 1 + column_count, state.crossproduct.get_data(), cp_count);
+    }
+
+    auto gathered = array<Float>::empty(packed_count * rank_count);
+    comm.allgather(local, gathered).wait();
+
+    auto merged = array<Float>::zeros(packed_count);
+    const Float* gathered_ptr = gathered.get_data();
+    Float* merged_ptr = merged.get_mutable_data();
+    for (std::int64_t rank = 0; rank < rank_count; ++rank) {
+        merge_partial_state(column_count, gathered_ptr + rank * packed_count, merged_ptr);
+    }
+
+    state.n_rows.get_mutable_data()[0] = merged_ptr[0];
+    bk::copy(state.sums.get_mutable_data(), merged_ptr + 1, column_count);
+    bk::copy(state.crossproduct.get_mutable_data(), merged_ptr + 1 + column_count, cp_count);
+}
+
+/// Computes the requested statistics from the accumulated ones
+template <typename Float, typename Task>
+inline compute_result<Task> finalize_partial_state(const bk::context_cpu& ctx,
+                                                   const detail::descriptor_base<Task>& desc,
+                                                   partial_state<Float>& state) {
+    const std::int64_t column_count = state.column_count;
+    const std::int64_t cp_count = column_count * column_count;
+
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(state.n_rows, 1, 1);
+    const auto daal_sums = interop::convert_to_daal_homogen_table(state.sums, 1, column_count);
+    const auto daal_crossproduct =
+        interop::convert_to_daal_homogen_table(state.crossproduct, column_count, column_count);
+
+    auto arr_means = array<Float>::empty(column_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, column_count);
+
+    const auto finalize = [&](array<Float>& arr_matrix, daal_covariance::OutputMatrixType type) {
+        const auto daal_matrix =
+            interop::convert_to_daal_homogen_table(arr_matrix, column_count, column_count);
+        daal_covariance::Parameter daal_parameter;
+        daal_parameter.outputMatrixType = type;
+        interop::status_to_exception(bk::dispatch_by_cpu(ctx, [&](auto cpu) {
+            return daal_covariance_online_kernel_t<
+                       Float,
+                       interop::to_daal_cpu_type<decltype(cpu)>::value>()
+                .finalizeCompute(daal_n_rows.get(),
+                                 daal_crossproduct.get(),
+                                 daal_sums.get(),
+                                 daal_matrix.get(),
+                                 daal_means.get(),
+                                 &daal_parameter);
+        }));
+    };
+
+    auto result = compute_result<Task>{}.set_result_options(desc.get_result_options());
+
+    bool is_mean_computed = false;
+    if (desc.get_result_options().test(result_options::cov_matrix)) {
+        auto arr_cov_matrix = array<Float>::empty(cp_count);
+        finalize(arr_cov_matrix, daal_covariance::covarianceMatrix);
+        is_mean_computed = true;
+        result.set_cov_matrix(homogen_table::wrap(arr_cov_matrix, column_count, column_count));
+    }
+    if (desc.get_result_options().test(result_options::cor_matrix)) {
+        auto arr_cor_matrix = array<Float>::empty(cp_count);
+        finalize(arr_cor_matrix, daal_covariance::correlationMatrix);
+        is_mean_computed = true;
+        result.set_cor_matrix(homogen_table::wrap(arr_cor_matrix, column_count, column_count));
+    }
+    if (desc.get_result_options().test(result_options::means)) {
+        if (!is_mean_computed) {
+            auto arr_cov_matrix = array<Float>::empty(cp_count);
+            finalize(arr_cov_matrix, daal_covariance::covarianceMatrix);
+        }
+        result.set_means(homogen_table::wrap(arr_means, 1, column_count));
+    }
+    return result;
+}
+
+} // namespace oneapi::dal::covariance::backend
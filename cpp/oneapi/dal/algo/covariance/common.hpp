@@ -42,11 +42,16 @@ namespace method {
 namespace v1 {
 
 struct dense {};
+
+/// Tag-type that denotes sparse computational method for the data in the CSR format.
+struct sparse {};
+
 /// Alias tag-type for the dense method.
 using by_default = dense;
 } // namespace v1
 
 using v1::dense;
+using v1::sparse;
 using v1::by_default;
 
 } // namespace method
@@ -89,7 +94,8 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method, method::dense>;
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method, method::dense, method::sparse>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::compute>;
@@ -133,7 +139,7 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::dense`.
+///                be :expr:`method::dense` or :expr:`method::sparse`.
 /// @tparam Task   Tag-type that specifies the type of the problem to solve. Can
 ///                be :expr:`task::compute`.
 template <typename Float = float,
@@ -27,10 +27,18 @@ class compute_input_impl;
 
 template <typename Task>
 class compute_result_impl;
+
+template <typename Task>
+class partial_compute_input_impl;
+
+template <typename Task>
+class partial_compute_result_impl;
 } // namespace v1
 
 using v1::compute_input_impl;
 using v1::compute_result_impl;
+using v1::partial_compute_input_impl;
+using v1::partial_compute_result_impl;
 
 } // namespace detail
 
@@ -122,9 +130,112 @@ private:
     dal::detail::pimpl<detail::compute_result_impl<Task>> impl_;
 };
 
+/// Accumulated statistics of the rows processed so far by :expr:`partial_compute`.
+/// Partial result can be serialized, so the computation can be continued later
+/// or finalized on another node.
+///
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::compute`.
+template <typename Task = task::by_default>
+class partial_compute_result : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+    friend dal::detail::serialization_accessor;
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the default property values.
+    partial_compute_result();
+
+    /// The $1 \\times 1$ table with the number of rows processed so far.
+    /// @remark default = table{}
+    const table& get_partial_n_rows() const;
+
+    auto& set_partial_n_rows(const table& value) {
+        set_partial_n_rows_impl(value);
+        return *this;
+    }
+
+    /// The $p \\times p$ table with the cross-product of the centered rows
+    /// processed so far.
+    /// @remark default = table{}
+    const table& get_partial_crossproduct() const;
+
+    auto& set_partial_crossproduct(const table& value) {
+        set_partial_crossproduct_impl(value);
+        return *this;
+    }
+
+    /// The $1 \\times p$ table with the column sums of the rows processed so far.
+    /// @remark default = table{}
+    const table& get_partial_sum() const;
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_partial_n_rows_impl(const table&);
+    void set_partial_crossproduct_impl(const table&);
+    void set_partial_sum_impl(const table&);
+
+private:
+    void serialize(dal::detail::output_archive& ar) const;
+    void deserialize(dal::detail::input_archive& ar);
+
+    dal::detail::pimpl<detail::partial_compute_result_impl<Task>> impl_;
+};
+
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::compute`.
+template <typename Task = task::by_default>
+class partial_compute_input : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the given :literal:`data`
+    /// that starts the accumulation
+    partial_compute_input(const table& data);
+
+    /// Creates a new instance of the class with the given :literal:`data`
+    /// that continues the accumulation of :literal:`prior_partial_result`
+    partial_compute_input(const partial_compute_result<Task>& prior_partial_result,
+                          const table& data);
+
+    /// The next block of rows of the dataset $X$
+    /// @remark default = table{}
+    const table& get_data() const;
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+    /// The partial result of the previously processed blocks
+    /// @remark default = partial_compute_result<Task>{}
+    const partial_compute_result<Task>& get_prior_partial_result() const;
+
+    auto& set_prior_partial_result(const partial_compute_result<Task>& value) {
+        set_prior_partial_result_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_data_impl(const table& value);
+    void set_prior_partial_result_impl(const partial_compute_result<Task>& value);
+
+private:
+    dal::detail::pimpl<detail::partial_compute_input_impl<Task>> impl_;
+};
+
 } // namespace v1
 
 using v1::compute_input;
 using v1::compute_result;
+using v1::partial_compute_result;
+using v1::partial_compute_input;
 
 } // namespace oneapi::dal::covariance
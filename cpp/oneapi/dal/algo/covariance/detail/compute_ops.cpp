@@ -22,23 +22,27 @@ namespace oneapi::dal::covariance::detail {
 namespace v1 {
 
 using dal::detail::host_policy;
+using dal::detail::spmd_host_policy;
 
-template <typename Float, typename Method, typename Task>
-struct compute_ops_dispatcher<host_policy, Float, Method, Task> {
-    compute_result<Task> operator()(const host_policy& ctx,
+template <typename Policy, typename Float, typename Method, typename Task>
+struct compute_ops_dispatcher<Policy, Float, Method, Task> {
+    compute_result<Task> operator()(const Policy& ctx,
                                     const descriptor_base<Task>& desc,
                                     const compute_input<Task>& input) const {
         using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
-            KERNEL_SINGLE_NODE_CPU(backend::compute_kernel_cpu<Float, Method, Task>)>;
+            KERNEL_UNIVERSAL_SPMD_CPU(backend::compute_kernel_cpu<Float, Method, Task>)>;
         return kernel_dispatcher_t()(ctx, desc, input);
     }
 };
 
-#define INSTANTIATE(F, M, T) \
-    template struct ONEDAL_EXPORT compute_ops_dispatcher<host_policy, F, M, T>;
+#define INSTANTIATE(F, M, T)                                                        \
+    template struct ONEDAL_EXPORT compute_ops_dispatcher<host_policy, F, M, T>; \
+    template struct ONEDAL_EXPORT compute_ops_dispatcher<spmd_host_policy, F, M, T>;
 
 INSTANTIATE(float, method::dense, task::compute)
 INSTANTIATE(double, method::dense, task::compute)
+INSTANTIATE(float, method::sparse, task::compute)
+INSTANTIATE(double, method::sparse, task::compute)
 
 } // namespace v1
 } // namespace oneapi::dal::covariance::detail
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/covariance/compute_types.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 
 namespace oneapi::dal::covariance::detail {
 namespace v1 {
@@ -44,6 +45,11 @@ struct compute_ops {
         if (!input.get_data().has_data()) {
             throw domain_error(msg::input_data_is_empty());
         }
+        if constexpr (std::is_same_v<method_t, method::sparse>) {
+            if (input.get_data().get_kind() != dal::detail::csr_table::kind()) {
+                throw invalid_argument(msg::input_data_is_not_csr_table());
+            }
+        }
     }
 
     void check_postconditions(const Descriptor& params,
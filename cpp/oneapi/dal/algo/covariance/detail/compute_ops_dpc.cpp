@@ -23,24 +23,40 @@ namespace oneapi::dal::covariance::detail {
 namespace v1 {
 
 using dal::detail::data_parallel_policy;
+using dal::detail::spmd_data_parallel_policy;
 
-template <typename Float, typename Method, typename Task>
-struct compute_ops_dispatcher<data_parallel_policy, Float, Method, Task> {
-    compute_result<Task> operator()(const data_parallel_policy& ctx,
+template <typename Policy, typename Float, typename Method, typename Task>
+struct compute_ops_dispatcher<Policy, Float, Method, Task> {
+    compute_result<Task> operator()(const Policy& ctx,
                                     const descriptor_base<Task>& params,
                                     const compute_input<Task>& input) const {
         using kernel_dispatcher_t = dal::backend::kernel_dispatcher<
-            KERNEL_SINGLE_NODE_CPU(backend::compute_kernel_cpu<Float, Method, Task>),
+            KERNEL_UNIVERSAL_SPMD_CPU(backend::compute_kernel_cpu<Float, Method, Task>),
             KERNEL_SINGLE_NODE_GPU(backend::compute_kernel_gpu<Float, Method, Task>)>;
         return kernel_dispatcher_t{}(ctx, params, input);
     }
 };
 
-#define INSTANTIATE(F, M, T) \
-    template struct ONEDAL_EXPORT compute_ops_dispatcher<data_parallel_policy, F, M, T>;
+template <typename Policy, typename Float, typename Task>
+struct compute_ops_dispatcher<Policy, Float, method::sparse, Task> {
+    compute_result<Task> operator()(const Policy& ctx,
+                                    const descriptor_base<Task>& params,
+                                    const compute_input<Task>& input) const {
+        // Sparse method is implemented only for CPU
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
+            KERNEL_UNIVERSAL_SPMD_CPU(backend::compute_kernel_cpu<Float, method::sparse, Task>)>;
+        return kernel_dispatcher_t{}(ctx, params, input);
+    }
+};
+
+#define INSTANTIATE(F, M, T)                                                                 \
+    template struct ONEDAL_EXPORT compute_ops_dispatcher<data_parallel_policy, F, M, T>; \
+    template struct ONEDAL_EXPORT compute_ops_dispatcher<spmd_data_parallel_policy, F, M, T>;
 
 INSTANTIATE(float, method::dense, task::compute)
 INSTANTIATE(double, method::dense, task::compute)
+INSTANTIATE(float, method::sparse, task::compute)
+INSTANTIATE(double, method::sparse, task::compute)
 
 } // namespace v1
 } // namespace oneapi::dal::covariance::detail
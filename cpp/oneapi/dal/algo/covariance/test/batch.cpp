@@ -29,6 +29,8 @@
 #include "oneapi/dal/test/engine/fixtures.hpp"
 #include "oneapi/dal/test/engine/math.hpp"
 
+#include <daal/include/services/env_detect.h>
+
 namespace oneapi::dal::covariance::test {
 
 namespace te = dal::test::engine;
@@ -212,6 +214,16 @@ public:
 
 using covariance_types = COMBINE_TYPES((float, double), (covariance::method::dense));
 
+class numa_first_touch_guard {
+public:
+    numa_first_touch_guard() {
+        daal::services::Environment::getInstance()->enableNumaFirstTouch(true);
+    }
+    ~numa_first_touch_guard() {
+        daal::services::Environment::getInstance()->enableNumaFirstTouch(false);
+    }
+};
+
 TEMPLATE_LIST_TEST_M(covariance_batch_test,
                      "covariance  fill_normal common flow",
                      "[covariance][integration][batch]",
@@ -262,6 +274,23 @@ TEMPLATE_LIST_TEST_M(covariance_batch_test,
     this->general_checks(input, input_data_table_id);
 }
 
+TEMPLATE_LIST_TEST_M(covariance_batch_test,
+                     "covariance on data placed by NUMA first-touch",
+                     "[covariance][integration][batch]",
+                     covariance_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->get_policy().is_gpu());
+
+    // Tables of at least 16MB are distributed among NUMA nodes on multi-node systems
+    const numa_first_touch_guard first_touch;
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 250000, 20 }.fill_uniform(-30, 30, 7777));
+
+    // Homogen floating point type is the same as algorithm's floating point type
+    const auto input_data_table_id = this->get_homogen_table_id();
+    this->general_checks(input, input_data_table_id);
+}
+
 TEMPLATE_LIST_TEST_M(covariance_batch_test,
                      "covariance fill_uniform nightly common flow",
                      "[covariance][integration][batch][nightly]",
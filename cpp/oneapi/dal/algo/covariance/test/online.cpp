@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/compute.hpp"
+#include "oneapi/dal/algo/covariance/partial_compute.hpp"
+#include "oneapi/dal/algo/covariance/finalize_compute.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/serialization.hpp"
+#include "oneapi/dal/test/engine/spmd.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+#include "oneapi/dal/test/engine/thread_communicator.hpp"
+
+namespace oneapi::dal::covariance::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class covariance_online_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using descriptor_t = covariance::descriptor<Float, Method, covariance::task::compute>;
+    using partial_result_t = covariance::partial_compute_result<>;
+    using result_t = covariance::compute_result<>;
+
+    descriptor_t get_descriptor() const {
+        return descriptor_t{}.set_result_options(result_options::cov_matrix |
+                                                 result_options::cor_matrix |
+                                                 result_options::means);
+    }
+
+    partial_result_t partial_compute_by_blocks(const descriptor_t& desc,
+                                               const std::vector<table>& blocks,
+                                               bool serialize_between_blocks) {
+        partial_result_t partial_result;
+        for (const auto& block : blocks) {
+            partial_result = this->partial_compute(desc, partial_result, block);
+            if (serialize_between_blocks) {
+                partial_result = te::serialize_deserialize(partial_result);
+            }
+        }
+        return partial_result;
+    }
+
+    void check_results_equal(const result_t& actual, const result_t& reference) {
+        const double tol = te::get_tolerance<Float>(1e-4, 1e-9);
+        te::check_if_tables_equal_approx<Float>(actual.get_cov_matrix(),
+                                                reference.get_cov_matrix(),
+                                                tol);
+        te::check_if_tables_equal_approx<Float>(actual.get_cor_matrix(),
+                                                reference.get_cor_matrix(),
+                                                tol);
+        te::check_if_tables_equal_approx<Float>(actual.get_means(), reference.get_means(), tol);
+    }
+
+    void check_against_batch(const te::dataframe& input,
+                             const te::table_id& input_table_id,
+                             std::int64_t block_count) {
+        const table data = input.get_table(this->get_policy(), input_table_id);
+        const auto desc = get_descriptor();
+
+        INFO("run batch compute")
+        const auto batch_result = this->compute(desc, data);
+
+        const auto blocks = te::split_table_by_rows<Float>(this->get_policy(), data, block_count);
+
+        INFO("run partial compute over blocks")
+        const auto partial_result = partial_compute_by_blocks(desc, blocks, false);
+        REQUIRE(partial_result.get_partial_n_rows().get_row_count() == 1);
+        REQUIRE(partial_result.get_partial_n_rows().get_column_count() == 1);
+        REQUIRE(partial_result.get_partial_sum().get_column_count() == data.get_column_count());
+        REQUIRE(partial_result.get_partial_crossproduct().get_row_count() ==
+                data.get_column_count());
+
+        INFO("run finalize compute")
+        check_results_equal(this->finalize_compute(desc, partial_result), batch_result);
+
+        INFO("run partial compute with serialization between blocks")
+        const auto restored_result = partial_compute_by_blocks(desc, blocks, true);
+        check_results_equal(this->finalize_compute(desc, restored_result), batch_result);
+    }
+
+    void check_spmd_against_batch(const te::dataframe& input,
+                                  const te::table_id& input_table_id,
+                                  std::int64_t rank_count) {
+        const table data = input.get_table(this->get_policy(), input_table_id);
+        const auto desc = get_descriptor();
+
+        INFO("run batch compute")
+        const auto batch_result = this->compute(desc, data);
+
+        INFO("run partial compute on every rank and merge in finalize compute")
+        const auto data_per_rank =
+            te::split_table_by_rows<Float>(this->get_policy(), data, rank_count);
+        te::thread_communicator comm{ rank_count };
+        const auto results = comm.map([&](std::int64_t rank) {
+            const auto partial_result = this->partial_compute(desc, data_per_rank[rank]);
+            return te::spmd_finalize_compute(this->get_policy(), comm, desc, partial_result);
+        });
+
+        REQUIRE(results.size() == std::size_t(rank_count));
+        for (const auto& result : results) {
+            check_results_equal(result, batch_result);
+        }
+    }
+};
+
+using covariance_types = COMBINE_TYPES((float, double), (covariance::method::dense));
+
+TEMPLATE_LIST_TEST_M(covariance_online_test,
+                     "covariance online results match batch ones",
+                     "[covariance][integration][online]",
+                     covariance_types) {
+    // Streaming computation is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_uniform(-10, 10, 7777),
+                           te::dataframe_builder{ 500, 40 }.fill_normal(0, 1, 7777));
+
+    const std::int64_t block_count = GENERATE(1, 3, 10);
+
+    const auto input_data_table_id = this->get_homogen_table_id();
+    this->check_against_batch(input, input_data_table_id, block_count);
+}
+
+TEMPLATE_LIST_TEST_M(covariance_online_test,
+                     "covariance finalize compute merges partial results in spmd mode",
+                     "[covariance][integration][online][spmd]",
+                     covariance_types) {
+    // Streaming computation is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_uniform(-10, 10, 7777));
+
+    const std::int64_t rank_count = GENERATE(2, 4);
+
+    const auto input_data_table_id = this->get_homogen_table_id();
+    this->check_spmd_against_batch(input, input_data_table_id, rank_count);
+}
+
+} // namespace oneapi::dal::covariance::test
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/compute.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::covariance::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class covariance_sparse_test : public te::float_algo_fixture<TestType> {
+public:
+    using Float = TestType;
+    using dense_descriptor_t = covariance::descriptor<Float, method::dense>;
+    using sparse_descriptor_t = covariance::descriptor<Float, method::sparse>;
+
+    template <typename Descriptor>
+    Descriptor get_descriptor() const {
+        return Descriptor{}.set_result_options(result_options::cov_matrix |
+                                               result_options::cor_matrix |
+                                               result_options::means);
+    }
+
+    void check_against_dense(const table& dense_data) {
+        const auto sparse_data = te::convert_to_csr_table<Float>(dense_data);
+
+        INFO("run compute on dense data")
+        const auto dense_result =
+            this->compute(get_descriptor<dense_descriptor_t>(), dense_data);
+
+        INFO("run compute on sparse data")
+        const auto sparse_result =
+            this->compute(get_descriptor<sparse_descriptor_t>(), sparse_data);
+
+        const double tol = te::get_tolerance<Float>(1e-2, 1e-9);
+        CHECK(te::abs_error(dense_result.get_cov_matrix(), sparse_result.get_cov_matrix()) < tol);
+        CHECK(te::abs_error(dense_result.get_cor_matrix(), sparse_result.get_cor_matrix()) < tol);
+        CHECK(te::abs_error(dense_result.get_means(), sparse_result.get_means()) < tol);
+    }
+};
+
+using covariance_sparse_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_M(covariance_sparse_test,
+                     "covariance sparse results match dense ones",
+                     "[covariance][integration][sparse]",
+                     covariance_sparse_types) {
+    // Sparse method is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = TestType;
+    const std::int64_t row_count = GENERATE(100, 1000);
+    const std::int64_t column_count = GENERATE(10, 200);
+    const double nonzero_ratio = GENERATE(0.05, 0.5);
+
+    const auto data = te::generate_sparse_homogen_table<Float>(row_count,
+                                                               column_count,
+                                                               nonzero_ratio,
+                                                               -10.0,
+                                                               10.0,
+                                                               7777);
+    this->check_against_dense(data);
+}
+
+TEMPLATE_LIST_TEST_M(covariance_sparse_test,
+                     "covariance sparse method throws if data is not a csr table",
+                     "[covariance][sparse][badarg]",
+                     covariance_sparse_types) {
+    SKIP_IF(!this->get_policy().is_cpu());
+
+    using Float = TestType;
+    const auto data = te::generate_sparse_homogen_table<Float>(10, 4, 0.5, -1.0, 1.0, 7777);
+    const auto desc = covariance::descriptor<Float, method::sparse>{};
+
+    REQUIRE_THROWS_AS(this->compute(desc, data), invalid_argument);
+}
+
+} // namespace oneapi::dal::covariance::test
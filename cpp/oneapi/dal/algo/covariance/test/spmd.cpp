@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/compute.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/spmd.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+#include "oneapi/dal/test/engine/thread_communicator.hpp"
+
+namespace oneapi::dal::covariance::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class covariance_spmd_test : public te::float_algo_fixture<std::tuple_element_t<0, TestType>> {
+public:
+    using Float = std::tuple_element_t<0, TestType>;
+    using Method = std::tuple_element_t<1, TestType>;
+    using descriptor_t = covariance::descriptor<Float, Method, covariance::task::compute>;
+    using result_t = covariance::compute_result<>;
+
+    void set_rank_count(std::int64_t rank_count) {
+        rank_count_ = rank_count;
+    }
+
+    std::vector<result_t> compute_via_spmd_threads(const descriptor_t& desc, const table& data) {
+        te::thread_communicator comm{ rank_count_ };
+        const auto data_per_rank =
+            te::split_table_by_rows<Float>(this->get_policy(), data, rank_count_);
+
+        return comm.map([&](std::int64_t rank) {
+            return te::spmd_compute(this->get_policy(), comm, desc, data_per_rank[rank]);
+        });
+    }
+
+    void check_against_batch(const te::dataframe& input, const te::table_id& input_table_id) {
+        const table data = input.get_table(this->get_policy(), input_table_id);
+
+        INFO("create descriptor cov cor means")
+        const auto desc = descriptor_t{}.set_result_options(result_options::cov_matrix |
+                                                            result_options::cor_matrix |
+                                                            result_options::means);
+
+        INFO("run batch compute")
+        const auto batch_result = this->compute(desc, data);
+
+        INFO("run spmd compute")
+        const auto spmd_results = compute_via_spmd_threads(desc, data);
+        REQUIRE(spmd_results.size() == std::size_t(rank_count_));
+
+        const double tol = te::get_tolerance<Float>(1e-4, 1e-9);
+        for (const auto& result : spmd_results) {
+            INFO("check if results are bitwise equal on all ranks")
+            te::check_if_tables_equal<Float>(result.get_cov_matrix(),
+                                             spmd_results.front().get_cov_matrix());
+            te::check_if_tables_equal<Float>(result.get_cor_matrix(),
+                                             spmd_results.front().get_cor_matrix());
+            te::check_if_tables_equal<Float>(result.get_means(),
+                                             spmd_results.front().get_means());
+
+            INFO("check if results match the batch ones")
+            te::check_if_tables_equal_approx<Float>(result.get_cov_matrix(),
+                                                    batch_result.get_cov_matrix(),
+                                                    tol);
+            te::check_if_tables_equal_approx<Float>(result.get_cor_matrix(),
+                                                    batch_result.get_cor_matrix(),
+                                                    tol);
+            te::check_if_tables_equal_approx<Float>(result.get_means(),
+                                                    batch_result.get_means(),
+                                                    tol);
+        }
+    }
+
+private:
+    std::int64_t rank_count_ = 1;
+};
+
+using covariance_types = COMBINE_TYPES((float, double), (covariance::method::dense));
+
+TEMPLATE_LIST_TEST_M(covariance_spmd_test,
+                     "covariance spmd results match batch ones",
+                     "[covariance][spmd]",
+                     covariance_types) {
+    // SPMD mode is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_uniform(-10, 10, 7777),
+                           te::dataframe_builder{ 500, 40 }.fill_normal(0, 1, 7777));
+
+    this->set_rank_count(GENERATE(1, 2, 4));
+
+    const auto input_data_table_id = this->get_homogen_table_id();
+    this->check_against_batch(input, input_data_table_id);
+}
+
+} // namespace oneapi::dal::covariance::test
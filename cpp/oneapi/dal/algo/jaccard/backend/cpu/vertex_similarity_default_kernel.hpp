@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include "oneapi/dal/algo/jaccard/common.hpp"
 #include "oneapi/dal/algo/jaccard/vertex_similarity_types.hpp"
@@ -30,6 +31,114 @@
 
 namespace oneapi::dal::preview::jaccard::backend {
 
+/// Collects the vertex pairs of one row of the graph block which pass the output
+/// filter of the descriptor. The pairs with the coefficients lower than the threshold
+/// are dropped. If top_k is set, the pairs are kept in a bounded min-heap placed
+/// directly in the result buffer, so only top_k pairs per row are ever stored.
+template <typename Cpu>
+class row_filter {
+public:
+    row_filter(std::int64_t top_k, float threshold) : top_k_(top_k), threshold_(threshold) {}
+
+    /// Returns true if all the pairs with non-zero coefficients are kept
+    bool is_pass_through() const {
+        return top_k_ == 0 && threshold_ <= 0.0f;
+    }
+
+    /// Starts a new row, the kept pairs are stored starting from the given positions
+    void start_row(std::int32_t *vertices, float *coeffs) {
+        vertices_ = vertices;
+        coeffs_ = coeffs;
+        count_ = 0;
+    }
+
+    void add(std::int32_t j,
+             std::int32_t intersection,
+             std::int32_t i_degree,
+             std::int32_t j_degree) {
+        add(j, float(intersection) / float(i_degree + j_degree - intersection));
+    }
+
+    void add(std::int32_t j, float coeff) {
+        if (coeff < threshold_) {
+            return;
+        }
+        if (top_k_ == 0) {
+            vertices_[count_] = j;
+            coeffs_[count_] = coeff;
+            ++count_;
+        }
+        else if (count_ < top_k_) {
+            vertices_[count_] = j;
+            coeffs_[count_] = coeff;
+            sift_up(count_++);
+        }
+        else if (is_better(j, coeff, 0)) {
+            vertices_[0] = j;
+            coeffs_[0] = coeff;
+            sift_down(0, count_);
+        }
+    }
+
+    /// Finishes the row and returns the number of the kept pairs. If top_k is set,
+    /// the pairs are sorted in descending order of the coefficients
+    std::int64_t finish_row() {
+        if (top_k_ > 0) {
+            for (std::int64_t size = count_ - 1; size > 0; --size) {
+                swap(0, size);
+                sift_down(0, size);
+            }
+        }
+        return count_;
+    }
+
+private:
+    // The pair is better if it has the larger coefficient or the same coefficient
+    // and the smaller vertex index. The root of the heap is the worst kept pair.
+    bool is_better(std::int32_t j, float coeff, std::int64_t other) const {
+        return coeff > coeffs_[other] || (coeff == coeffs_[other] && j < vertices_[other]);
+    }
+
+    bool is_better(std::int64_t first, std::int64_t second) const {
+        return is_better(vertices_[first], coeffs_[first], second);
+    }
+
+    void swap(std::int64_t first, std::int64_t second) {
+        std::swap(vertices_[first], vertices_[second]);
+        std::swap(coeffs_[first], coeffs_[second]);
+    }
+
+    void sift_up(std::int64_t pos) {
+        while (pos > 0) {
+            const std::int64_t parent = (pos - 1) / 2;
+            if (!is_better(parent, pos)) {
+                break;
+            }
+            swap(parent, pos);
+            pos = parent;
+        }
+    }
+
+    void sift_down(std::int64_t pos, std::int64_t size) {
+        for (std::int64_t child = 2 * pos + 1; child < size; child = 2 * pos + 1) {
+            if (child + 1 < size && is_better(child, child + 1)) {
+                ++child;
+            }
+            if (!is_better(pos, child)) {
+                break;
+            }
+            swap(pos, child);
+            pos = child;
+        }
+    }
+
+    std::int64_t top_k_;
+    float threshold_;
+    std::int32_t *vertices_ = nullptr;
+    float *coeffs_ = nullptr;
+    std::int64_t count_ = 0;
+};
+
 template <typename Cpu>
 vertex_similarity_result<task::all_vertex_pairs> jaccard(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
@@ -40,16 +149,17 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
     const auto column_begin =
         dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
     const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
-    const auto number_elements_in_block =
-        detail::compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
+    const auto number_elements_in_block = detail::compute_number_elements_in_result(desc);
     int *first_vertices = reinterpret_cast<int *>(result_ptr);
     int *second_vertices = first_vertices + number_elements_in_block;
     float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_block);
+    row_filter<Cpu> filter(desc.get_top_k(), static_cast<float>(desc.get_similarity_threshold()));
     std::int64_t nnz = 0;
     for (std::int32_t i = row_begin; i < row_end; ++i) {
         const std::int32_t i_neighbor_size = t.get_vertex_degree(i);
         const auto i_neigbhors = t.get_vertex_neighbors_begin(i);
         const auto diagonal = detail::min(i, column_end);
+        filter.start_row(second_vertices + nnz, jaccard + nnz);
         for (std::int32_t j = column_begin; j < diagonal; j++) {
             const std::int32_t j_neighbor_size = t.get_vertex_degree(j);
             const auto j_neigbhors = t.get_vertex_neighbors_begin(j);
@@ -61,22 +171,13 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
                                                         i_neighbor_size,
                                                         j_neighbor_size);
                 if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
-                    first_vertices[nnz] = i;
-                    second_vertices[nnz] = j;
-                    nnz++;
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
                 }
             }
         }
 
         if (diagonal >= column_begin && diagonal < column_end) {
-            jaccard[nnz] = 1.0;
-            first_vertices[nnz] = i;
-            second_vertices[nnz] = diagonal;
-            nnz++;
-            ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+            filter.add(diagonal, 1.0f);
         }
 
         for (std::int32_t j = detail::max(column_begin, diagonal + 1); j < column_end; j++) {
@@ -90,15 +191,17 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard(
                                                         i_neighbor_size,
                                                         j_neighbor_size);
                 if (intersection_value) {
-                    jaccard[nnz] = float(intersection_value) /
-                                   float(i_neighbor_size + j_neighbor_size - intersection_value);
-                    first_vertices[nnz] = i;
-                    second_vertices[nnz] = j;
-                    nnz++;
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
                 }
             }
         }
+
+        const std::int64_t row_nnz = filter.finish_row();
+        for (std::int64_t k = 0; k < row_nnz; ++k) {
+            first_vertices[nnz + k] = i;
+        }
+        nnz += row_nnz;
+        ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
     }
     vertex_similarity_result res(
         homogen_table::wrap(first_vertices, number_elements_in_block, 2, data_layout::column_major),
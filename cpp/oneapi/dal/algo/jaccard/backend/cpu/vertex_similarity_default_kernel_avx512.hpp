@@ -51,12 +51,16 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
     const auto column_begin =
         dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
     const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
-    const auto number_elements_in_block =
-        detail::compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
+    const auto number_elements_in_block = detail::compute_number_elements_in_result(desc);
     std::int32_t *first_vertices = reinterpret_cast<std::int32_t *>(result_ptr);
     std::int32_t *second_vertices = first_vertices + number_elements_in_block;
     float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_block);
 
+    // The pairs go through the filter only if top-k or threshold output is requested,
+    // otherwise all the non-zero coefficients are written directly
+    row_filter<Cpu> filter(desc.get_top_k(), static_cast<float>(desc.get_similarity_threshold()));
+    const bool filtered = !filter.is_pass_through();
+
     std::int64_t nnz = 0;
     std::int32_t j = column_begin;
 #if defined(__INTEL_COMPILER)
@@ -71,6 +75,9 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
         const auto i_neighbor_size = degrees[i];
         const auto i_neigbhors = cols + rows_vertex[i];
         const auto diagonal = detail::min(i, column_end);
+        if (filtered) {
+            filter.start_row(second_vertices + nnz, jaccard + nnz);
+        }
 
 #if defined(__INTEL_COMPILER)
         __m512i n_i_start_v = _mm512_set1_epi32(i_neigbhors[0]);
@@ -127,22 +134,36 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                 i_neighbor_size,
                                                                 j_neighbor_size);
                     }
-                    __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
-                    j_vertices = _mm512_load_epi32(stack16_j_vertex);
-
-                    __mmask16 non_zero_coefficients =
-                        _mm512_test_epi32_mask(intersections_v, intersections_v);
-                    _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
-                                                     non_zero_coefficients,
-                                                     i_vertex);
-                    _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
-                                                     non_zero_coefficients,
-                                                     j_vertices);
-                    __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
-                    _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
-
-                    nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    if (filtered) {
+                        for (std::int32_t s = 0; s < ones_num; s++) {
+                            if (stack16_intersections[s]) {
+                                filter.add(stack16_j_vertex[s],
+                                           stack16_intersections[s],
+                                           i_neighbor_size,
+                                           degrees[stack16_j_vertex[s]]);
+                            }
+                        }
+                    }
+                    else {
+                        __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
+                        j_vertices = _mm512_load_epi32(stack16_j_vertex);
+
+                        __mmask16 non_zero_coefficients =
+                            _mm512_test_epi32_mask(intersections_v, intersections_v);
+                        _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
+                                                         non_zero_coefficients,
+                                                         i_vertex);
+                        _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
+                                                         non_zero_coefficients,
+                                                         j_vertices);
+                        __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
+                        _mm512_mask_compressstoreu_ps((jaccard + nnz),
+                                                      non_zero_coefficients,
+                                                      tmp_v);
+
+                        nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
+                        ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    }
                 }
 
                 j += 16;
@@ -176,21 +197,33 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                    i_neighbor_size,
                                                                                    j_neighbor_size);
                 }
-                __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
-                j_vertices = _mm512_load_epi32(stack16_j_vertex);
-                __mmask16 non_zero_coefficients =
-                    _mm512_test_epi32_mask(intersections_v, intersections_v);
-                _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
-                                                 non_zero_coefficients,
-                                                 i_vertex);
-                _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
-                                                 non_zero_coefficients,
-                                                 j_vertices);
-                __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
-                _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
+                if (filtered) {
+                    for (std::int32_t s = 0; s < ones_num; s++) {
+                        if (stack16_intersections[s]) {
+                            filter.add(stack16_j_vertex[s],
+                                       stack16_intersections[s],
+                                       i_neighbor_size,
+                                       degrees[stack16_j_vertex[s]]);
+                        }
+                    }
+                }
+                else {
+                    __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
+                    j_vertices = _mm512_load_epi32(stack16_j_vertex);
+                    __mmask16 non_zero_coefficients =
+                        _mm512_test_epi32_mask(intersections_v, intersections_v);
+                    _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
+                                                     non_zero_coefficients,
+                                                     i_vertex);
+                    _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
+                                                     non_zero_coefficients,
+                                                     j_vertices);
+                    __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
+                    _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
 
-                nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
-                ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
+                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                }
             }
 
             j += 16;
@@ -204,7 +237,10 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                   j_neigbhors,
                                                                                   i_neighbor_size,
                                                                                   j_neighbor_size);
-                    if (intersection_value) {
+                    if (intersection_value && filtered) {
+                        filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
+                    }
+                    else if (intersection_value) {
                         jaccard[nnz] = static_cast<float>(intersection_value);
                         first_vertices[nnz] = i;
                         second_vertices[nnz] = j;
@@ -225,7 +261,10 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                   j_neigbhors,
                                                                                   i_neighbor_size,
                                                                                   j_neighbor_size);
-                    if (intersection_value) {
+                    if (intersection_value && filtered) {
+                        filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
+                    }
+                    else if (intersection_value) {
                         jaccard[nnz] = static_cast<float>(intersection_value);
                         first_vertices[nnz] = i;
                         second_vertices[nnz] = j;
@@ -240,11 +279,16 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
 
         std::int32_t tmp_idx = column_begin;
         if (diagonal >= column_begin) {
-            jaccard[nnz] = 1.0;
-            first_vertices[nnz] = i;
-            second_vertices[nnz] = diagonal;
-            nnz++;
-            ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+            if (diagonal < column_end && filtered) {
+                filter.add(diagonal, 1.0f);
+            }
+            else if (diagonal < column_end) {
+                jaccard[nnz] = 1.0;
+                first_vertices[nnz] = i;
+                second_vertices[nnz] = diagonal;
+                nnz++;
+                ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+            }
             tmp_idx = diagonal + 1;
         }
         j = tmp_idx;
@@ -300,22 +344,36 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                 i_neighbor_size,
                                                                 j_neighbor_size);
                     }
-                    __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
-                    j_vertices = _mm512_load_epi32(stack16_j_vertex);
-
-                    __mmask16 non_zero_coefficients =
-                        _mm512_test_epi32_mask(intersections_v, intersections_v);
-                    _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
-                                                     non_zero_coefficients,
-                                                     i_vertex);
-                    _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
-                                                     non_zero_coefficients,
-                                                     j_vertices);
-                    __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
-                    _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
-
-                    nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
-                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    if (filtered) {
+                        for (std::int32_t s = 0; s < ones_num; s++) {
+                            if (stack16_intersections[s]) {
+                                filter.add(stack16_j_vertex[s],
+                                           stack16_intersections[s],
+                                           i_neighbor_size,
+                                           degrees[stack16_j_vertex[s]]);
+                            }
+                        }
+                    }
+                    else {
+                        __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
+                        j_vertices = _mm512_load_epi32(stack16_j_vertex);
+
+                        __mmask16 non_zero_coefficients =
+                            _mm512_test_epi32_mask(intersections_v, intersections_v);
+                        _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
+                                                         non_zero_coefficients,
+                                                         i_vertex);
+                        _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
+                                                         non_zero_coefficients,
+                                                         j_vertices);
+                        __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
+                        _mm512_mask_compressstoreu_ps((jaccard + nnz),
+                                                      non_zero_coefficients,
+                                                      tmp_v);
+
+                        nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
+                        ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    }
                 }
 
                 j += 16;
@@ -349,21 +407,33 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                    i_neighbor_size,
                                                                                    j_neighbor_size);
                 }
-                __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
-                j_vertices = _mm512_load_epi32(stack16_j_vertex);
-                __mmask16 non_zero_coefficients =
-                    _mm512_test_epi32_mask(intersections_v, intersections_v);
-                _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
-                                                 non_zero_coefficients,
-                                                 i_vertex);
-                _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
-                                                 non_zero_coefficients,
-                                                 j_vertices);
-                __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
-                _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
+                if (filtered) {
+                    for (std::int32_t s = 0; s < ones_num; s++) {
+                        if (stack16_intersections[s]) {
+                            filter.add(stack16_j_vertex[s],
+                                       stack16_intersections[s],
+                                       i_neighbor_size,
+                                       degrees[stack16_j_vertex[s]]);
+                        }
+                    }
+                }
+                else {
+                    __m512i intersections_v = _mm512_load_epi32(stack16_intersections);
+                    j_vertices = _mm512_load_epi32(stack16_j_vertex);
+                    __mmask16 non_zero_coefficients =
+                        _mm512_test_epi32_mask(intersections_v, intersections_v);
+                    _mm512_mask_compressstoreu_epi32((first_vertices + nnz),
+                                                     non_zero_coefficients,
+                                                     i_vertex);
+                    _mm512_mask_compressstoreu_epi32((second_vertices + nnz),
+                                                     non_zero_coefficients,
+                                                     j_vertices);
+                    __m512 tmp_v = _mm512_cvtepi32_ps(intersections_v);
+                    _mm512_mask_compressstoreu_ps((jaccard + nnz), non_zero_coefficients, tmp_v);
 
-                nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
-                ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                    nnz += _popcnt32_redef(_cvtmask16_u32(non_zero_coefficients));
+                    ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+                }
             }
 
             j += 16;
@@ -377,7 +447,10 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                   j_neigbhors,
                                                                                   i_neighbor_size,
                                                                                   j_neighbor_size);
-                    if (intersection_value) {
+                    if (intersection_value && filtered) {
+                        filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
+                    }
+                    else if (intersection_value) {
                         jaccard[nnz] = static_cast<float>(intersection_value);
                         first_vertices[nnz] = i;
                         second_vertices[nnz] = j;
@@ -398,7 +471,10 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
                                                                                   j_neigbhors,
                                                                                   i_neighbor_size,
                                                                                   j_neighbor_size);
-                    if (intersection_value) {
+                    if (intersection_value && filtered) {
+                        filter.add(j, intersection_value, i_neighbor_size, j_neighbor_size);
+                    }
+                    else if (intersection_value) {
                         jaccard[nnz] = static_cast<float>(intersection_value);
                         first_vertices[nnz] = i;
                         second_vertices[nnz] = j;
@@ -410,13 +486,25 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard_avx512(
 #if defined(__INTEL_COMPILER)
         }
 #endif
+        if (filtered) {
+            const std::int64_t row_nnz = filter.finish_row();
+            for (std::int64_t k = 0; k < row_nnz; ++k) {
+                first_vertices[nnz + k] = i;
+            }
+            nnz += row_nnz;
+            ONEDAL_ASSERT(nnz >= 0, "Overflow found in sum of two values");
+        }
     }
 
-    PRAGMA_VECTOR_ALWAYS
-    for (int i = 0; i < nnz; i++) {
-        if (first_vertices[i] != second_vertices[i])
-            jaccard[i] = jaccard[i] / static_cast<float>(degrees[first_vertices[i]] +
-                                                         degrees[second_vertices[i]] - jaccard[i]);
+    // The filtered pairs already have the coefficients, others have the intersection sizes
+    if (!filtered) {
+        PRAGMA_VECTOR_ALWAYS
+        for (int i = 0; i < nnz; i++) {
+            if (first_vertices[i] != second_vertices[i])
+                jaccard[i] = jaccard[i] / static_cast<float>(degrees[first_vertices[i]] +
+                                                             degrees[second_vertices[i]] -
+                                                             jaccard[i]);
+        }
     }
 
     vertex_similarity_result res(
@@ -60,12 +60,16 @@ public:
     auto get_row_range_end() const -> std::int64_t;
     auto get_column_range_begin() const -> std::int64_t;
     auto get_column_range_end() const -> std::int64_t;
+    auto get_top_k() const -> std::int64_t;
+    auto get_similarity_threshold() const -> double;
 
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_top_k_impl(std::int64_t top_k);
+    void set_similarity_threshold_impl(double threshold);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -141,6 +145,37 @@ public:
         base_t::set_block_impl(row_range, column_range);
         return *this;
     }
+
+    /// Returns the maximum number of the vertex pairs with the largest Jaccard
+    /// similarity coefficients kept for each row of the graph block
+    std::int64_t get_top_k() const {
+        return base_t::get_top_k();
+    }
+
+    /// Sets the maximum number of the vertex pairs with the largest Jaccard similarity
+    /// coefficients kept for each row of the graph block. The pairs of the row are
+    /// returned in descending order of the coefficients. If top_k is zero, all
+    /// the vertex pairs of the row are kept.
+    ///
+    /// @param [in] top_k  The number of the pairs kept for each row, should be >= 0
+    auto& set_top_k(std::int64_t top_k) {
+        base_t::set_top_k_impl(top_k);
+        return *this;
+    }
+
+    /// Returns the minimum Jaccard similarity coefficient of the returned vertex pairs
+    double get_similarity_threshold() const {
+        return base_t::get_similarity_threshold();
+    }
+
+    /// Sets the minimum Jaccard similarity coefficient of the returned vertex pairs.
+    /// The pairs with the lower coefficients are not returned.
+    ///
+    /// @param [in] threshold  The minimum coefficient, should be in the range [0, 1]
+    auto& set_similarity_threshold(double threshold) {
+        base_t::set_similarity_threshold_impl(threshold);
+        return *this;
+    }
 };
 
 /// Structure for the caching builder
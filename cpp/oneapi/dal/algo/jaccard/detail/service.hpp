@@ -44,6 +44,21 @@ ONEDAL_FORCEINLINE std::int64_t compute_number_elements_in_block(
     return vertex_pairs_count;
 }
 
+template <typename Task>
+ONEDAL_FORCEINLINE std::int64_t compute_number_elements_in_result(
+    const descriptor_base<Task> &desc) {
+    const std::int64_t row_begin = desc.get_row_range_begin();
+    const std::int64_t row_end = desc.get_row_range_end();
+    const std::int64_t column_begin = desc.get_column_range_begin();
+    const std::int64_t column_end = desc.get_column_range_end();
+    const std::int64_t top_k = desc.get_top_k();
+    // only top_k vertex pairs are kept for each row of the block
+    if (top_k > 0 && top_k < column_end - column_begin) {
+        return compute_number_elements_in_block(row_begin, row_end, 0, top_k);
+    }
+    return compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
+}
+
 template <typename Float, typename Index>
 ONEDAL_FORCEINLINE std::int64_t compute_max_block_size(const std::int64_t &vertex_pairs_count) {
     const std::int64_t vertex_pair_element_count = 2; // 2 elements in the vertex pair
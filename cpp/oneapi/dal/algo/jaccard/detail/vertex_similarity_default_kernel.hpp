@@ -57,12 +57,7 @@ struct vertex_similarity_kernel_cpu<float, method::fast, task::all_vertex_pairs,
         const detail::descriptor_base<task::all_vertex_pairs>& desc,
         const Topology& t,
         caching_builder& result_builder) const {
-        const std::int64_t row_begin = desc.get_row_range_begin();
-        const std::int64_t row_end = desc.get_row_range_end();
-        const std::int64_t column_begin = desc.get_column_range_begin();
-        const std::int64_t column_end = desc.get_column_range_end();
-        const std::int64_t number_elements_in_block =
-            compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
+        const std::int64_t number_elements_in_block = compute_number_elements_in_result(desc);
         if (number_elements_in_block == 0) {
             return vertex_similarity_result<task::all_vertex_pairs>();
         }
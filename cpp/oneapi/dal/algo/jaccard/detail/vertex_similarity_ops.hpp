@@ -76,6 +76,13 @@ struct vertex_similarity_ops {
             column_end >= dal::detail::limits<std::int32_t>::max()) {
             throw invalid_argument(msg::range_idx_gt_max_int32());
         }
+        if (param.get_top_k() < 0) {
+            throw invalid_argument(msg::top_k_lt_zero());
+        }
+        const double threshold = param.get_similarity_threshold();
+        if (!(threshold >= 0.0 && threshold <= 1.0)) {
+            throw invalid_argument(msg::similarity_threshold_is_out_of_range());
+        }
     }
 
     template <typename Policy>
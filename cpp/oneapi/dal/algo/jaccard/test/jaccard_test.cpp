@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <tuple>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
 #include "oneapi/dal/table/homogen.hpp"
@@ -135,6 +138,19 @@ public:
                                           24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 };
 
+class small_graph_type : public graph_base_data {
+public:
+    small_graph_type() {
+        vertex_count = 7;
+        edge_count = 8;
+        cols_count = edge_count * 2;
+        rows_count = vertex_count + 1;
+    }
+    std::array<std::int32_t, 7> degrees = { 1, 3, 4, 2, 3, 1, 2 };
+    std::array<std::int32_t, 16> cols = { 1, 0, 2, 4, 1, 3, 4, 5, 2, 6, 1, 2, 6, 2, 3, 4 };
+    std::array<std::int64_t, 8> rows = { 0, 1, 4, 8, 10, 13, 14, 16 };
+};
+
 class jaccard_test {
 public:
     template <typename GraphType>
@@ -217,6 +233,89 @@ public:
         REQUIRE(correct_coeff_count == nonzero_coeff_count);
     }
 
+    template <typename GraphType>
+    auto compute_filtered_reference(std::int64_t row_begin,
+                                    std::int64_t row_end,
+                                    std::int64_t column_begin,
+                                    std::int64_t column_end,
+                                    std::int64_t top_k,
+                                    double threshold) {
+        GraphType graph_data;
+        std::vector<std::tuple<std::int32_t, std::int32_t, float>> reference;
+        for (std::int64_t i = row_begin; i < row_end; ++i) {
+            std::vector<std::pair<float, std::int32_t>> row;
+            for (std::int64_t j = column_begin; j < column_end; ++j) {
+                const auto i_begin = graph_data.cols.begin() + graph_data.rows[i];
+                const auto i_end = graph_data.cols.begin() + graph_data.rows[i + 1];
+                const auto j_begin = graph_data.cols.begin() + graph_data.rows[j];
+                const auto j_end = graph_data.cols.begin() + graph_data.rows[j + 1];
+                std::vector<std::int32_t> intersection;
+                std::set_intersection(i_begin,
+                                      i_end,
+                                      j_begin,
+                                      j_end,
+                                      std::back_inserter(intersection));
+                const std::int64_t intersection_size = intersection.size();
+                const std::int64_t union_size =
+                    graph_data.degrees[i] + graph_data.degrees[j] - intersection_size;
+                const float coeff =
+                    (i == j) ? 1.0f : float(intersection_size) / float(union_size);
+                if (coeff > 0.0f && coeff >= float(threshold)) {
+                    row.emplace_back(coeff, j);
+                }
+            }
+            if (top_k > 0) {
+                std::sort(row.begin(), row.end(), [](const auto &a, const auto &b) {
+                    return a.first > b.first || (a.first == b.first && a.second < b.second);
+                });
+                row.resize(std::min<std::int64_t>(row.size(), top_k));
+            }
+            for (const auto &[coeff, j] : row) {
+                reference.emplace_back(i, j, coeff);
+            }
+        }
+        return reference;
+    }
+
+    template <typename GraphType>
+    void check_jaccard_filtered(std::int64_t row_begin,
+                                std::int64_t row_end,
+                                std::int64_t column_begin,
+                                std::int64_t column_end,
+                                std::int64_t top_k,
+                                double threshold) {
+        const auto desc = dal::preview::jaccard::descriptor<>()
+                              .set_block({ row_begin, row_end }, { column_begin, column_end })
+                              .set_top_k(top_k)
+                              .set_similarity_threshold(threshold);
+        const auto g = create_graph<GraphType>();
+        dal::preview::jaccard::caching_builder builder;
+        const auto result = dal::preview::vertex_similarity(desc, g, builder);
+
+        const auto reference = compute_filtered_reference<GraphType>(row_begin,
+                                                                     row_end,
+                                                                     column_begin,
+                                                                     column_end,
+                                                                     top_k,
+                                                                     threshold);
+        const std::int64_t nonzero_coeff_count = result.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count == static_cast<std::int64_t>(reference.size()));
+
+        auto vertex_pairs_table = result.get_vertex_pairs();
+        homogen_table &vertex_pairs = static_cast<homogen_table &>(vertex_pairs_table);
+        const auto vertex_pairs_data = vertex_pairs.get_data<int>();
+        const std::int64_t element_count = vertex_pairs.get_row_count();
+        auto coeffs_table = result.get_coeffs();
+        homogen_table &coeffs = static_cast<homogen_table &>(coeffs_table);
+        const auto coeffs_data = coeffs.get_data<float>();
+        for (std::int64_t i = 0; i < nonzero_coeff_count; ++i) {
+            const auto &[first, second, coeff] = reference[i];
+            REQUIRE(vertex_pairs_data[i] == first);
+            REQUIRE(vertex_pairs_data[i + element_count] == second);
+            REQUIRE(Approx(coeffs_data[i]) == coeff);
+        }
+    }
+
     template <typename Graph, typename Task>
     void check_jaccard_zero_coeffs_only(
         const oneapi::dal::preview::jaccard::detail::descriptor_base<Task> &desc,
@@ -420,6 +519,25 @@ TEST_M(jaccard_test, "Zero jaccard coeffs graph, row of 32 elements, right of th
     this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
 }
 
+TEST_M(jaccard_test, "Top-k output keeps the largest coefficients of each row") {
+    this->check_jaccard_filtered<small_graph_type>(0, 7, 0, 7, 2, 0.0);
+    this->check_jaccard_filtered<small_graph_type>(1, 5, 2, 7, 1, 0.0);
+}
+
+TEST_M(jaccard_test, "Top-k greater than column count keeps all pairs") {
+    this->check_jaccard_filtered<small_graph_type>(0, 7, 0, 7, 10, 0.0);
+}
+
+TEST_M(jaccard_test, "Threshold output drops the smaller coefficients") {
+    this->check_jaccard_filtered<small_graph_type>(0, 7, 0, 7, 0, 0.3);
+    this->check_jaccard_filtered<small_graph_type>(0, 7, 0, 7, 0, 1.0);
+}
+
+TEST_M(jaccard_test, "Top-k and threshold output") {
+    this->check_jaccard_filtered<small_graph_type>(0, 7, 0, 7, 2, 0.2);
+    this->check_jaccard_filtered<small_graph_type>(2, 6, 0, 4, 3, 0.25);
+}
+
 TEST_M(jaccard_test, "Null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block({ 0, 0 }, { 0, 0 });
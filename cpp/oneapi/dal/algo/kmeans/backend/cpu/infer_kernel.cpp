@@ -18,6 +18,7 @@
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
 #include "oneapi/dal/algo/kmeans/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/kmeans/backend/to_daal_method.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -30,14 +31,13 @@ using std::int64_t;
 using dal::backend::context_cpu;
 using descriptor_t = detail::descriptor_base<task::clustering>;
 
-namespace daal_kmeans = daal::algorithms::kmeans;
 namespace interop = dal::backend::interop;
 
-template <typename Float, daal::CpuType Cpu>
-using daal_kmeans_lloyd_dense_kernel_t =
-    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
+template <typename Float, daal::CpuType Cpu, typename Method>
+using daal_kmeans_lloyd_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<to_daal_method<Method>::value, Float, Cpu>;
 
-template <typename Float, typename Task>
+template <typename Float, typename Method, typename Task>
 static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_t& desc,
                                            const model<Task>& trained_model,
@@ -72,11 +72,12 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return daal_kmeans_lloyd_kernel_t<Float,
+                                          interop::to_daal_cpu_type<decltype(cpu)>::value,
+                                          Method>()
+            .compute(input, output, &par);
+    }));
 
     return infer_result<Task>()
         .set_responses(
@@ -84,23 +85,25 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
         .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]));
 }
 
-template <typename Float, typename Task>
+template <typename Float, typename Method, typename Task>
 static infer_result<Task> infer(const context_cpu& ctx,
                                 const descriptor_t& desc,
                                 const infer_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx, desc, input.get_model(), input.get_data());
+    return call_daal_kernel<Float, Method, Task>(ctx, desc, input.get_model(), input.get_data());
 }
 
-template <typename Float>
-struct infer_kernel_cpu<Float, method::by_default, task::clustering> {
+template <typename Float, typename Method>
+struct infer_kernel_cpu<Float, Method, task::clustering> {
     infer_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_t& desc,
                                               const infer_input<task::clustering>& input) const {
-        return infer<Float, task::clustering>(ctx, desc, input);
+        return infer<Float, Method, task::clustering>(ctx, desc, input);
     }
 };
 
-template struct infer_kernel_cpu<float, method::by_default, task::clustering>;
-template struct infer_kernel_cpu<double, method::by_default, task::clustering>;
+template struct infer_kernel_cpu<float, method::lloyd_dense, task::clustering>;
+template struct infer_kernel_cpu<double, method::lloyd_dense, task::clustering>;
+template struct infer_kernel_cpu<float, method::lloyd_sparse, task::clustering>;
+template struct infer_kernel_cpu<double, method::lloyd_sparse, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
@@ -18,6 +18,7 @@
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
 #include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/kmeans/backend/to_daal_method.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
@@ -31,19 +32,21 @@ using std::int64_t;
 using dal::backend::context_cpu;
 using descriptor_t = detail::descriptor_base<task::clustering>;
 
-namespace daal_kmeans = daal::algorithms::kmeans;
-namespace daal_kmeans_init = daal::algorithms::kmeans::init;
 namespace interop = dal::backend::interop;
 
-template <typename Float, daal::CpuType Cpu>
-using daal_kmeans_lloyd_dense_kernel_t =
-    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
+template <typename Float, daal::CpuType Cpu, typename Method>
+using daal_kmeans_lloyd_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<to_daal_method<Method>::value, Float, Cpu>;
 
 template <typename Float, daal::CpuType Cpu>
-using daal_kmeans_init_plus_plus_dense_kernel_t =
-    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
+using daal_kmeans_hamerly_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::hamerlyDense, Float, Cpu>;
+
+template <typename Float, daal::CpuType Cpu, typename Method>
+using daal_kmeans_init_plus_plus_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<to_daal_init_method<Method>::value, Float, Cpu>;
 
-template <typename Float>
+template <typename Float, typename Method>
 static daal::data_management::NumericTablePtr get_initial_centroids(
     const context_cpu& ctx,
     const descriptor_t& desc,
@@ -67,15 +70,18 @@ static daal::data_management::NumericTablePtr get_initial_centroids(
             daal_initial_centroids.get()
         };
 
-        interop::status_to_exception(
-            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
-                ctx,
-                init_len_input,
-                init_input,
-                init_len_output,
-                init_output,
-                &par,
-                *(par.engine)));
+        interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+            return daal_kmeans_init_plus_plus_kernel_t<
+                       Float,
+                       interop::to_daal_cpu_type<decltype(cpu)>::value,
+                       Method>()
+                .compute(init_len_input,
+                         init_input,
+                         init_len_output,
+                         init_output,
+                         &par,
+                         *(par.engine));
+        }));
     }
     else {
         daal_initial_centroids = interop::convert_to_daal_table<Float>(initial_centroids);
@@ -83,7 +89,17 @@ static daal::data_management::NumericTablePtr get_initial_centroids(
     return daal_initial_centroids;
 }
 
-template <typename Float, typename Task>
+/// Hamerly's bounds follow the Lloyd iterations up to ties and rounding and let most of
+/// the distance computations be skipped once the assignments settle. The bounds cost two
+/// extra values per observation, which only pays off for many clusters and iterations.
+template <typename Method>
+static bool use_hamerly_bounds(int64_t cluster_count, int64_t max_iteration_count) {
+    constexpr int64_t min_cluster_count = 64;
+    return std::is_same_v<Method, method::lloyd_dense> && cluster_count >= min_cluster_count &&
+           max_iteration_count > 1;
+}
+
+template <typename Float, typename Method, typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const descriptor_t& desc,
                                            const table& data,
@@ -99,7 +115,8 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                dal::detail::integral_cast<std::size_t>(max_iteration_count));
     par.accuracyThreshold = accuracy_threshold;
 
-    auto daal_initial_centroids = get_initial_centroids<Float>(ctx, desc, data, initial_centroids);
+    auto daal_initial_centroids =
+        get_initial_centroids<Float, Method>(ctx, desc, data, initial_centroids);
 
     const auto daal_data = interop::convert_to_daal_table<Float>(data);
 
@@ -125,11 +142,14 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                                        daal_objective_function_value.get(),
                                                        daal_iteration_count.get() };
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
-                                                                           input,
-                                                                           output,
-                                                                           &par));
+    const bool use_hamerly = use_hamerly_bounds<Method>(cluster_count, max_iteration_count);
+    interop::status_to_exception(dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = interop::to_daal_cpu_type<decltype(cpu)>::value;
+        if (use_hamerly) {
+            return daal_kmeans_hamerly_kernel_t<Float, daal_cpu>().compute(input, output, &par);
+        }
+        return daal_kmeans_lloyd_kernel_t<Float, daal_cpu, Method>().compute(input, output, &par);
+    }));
 
     return train_result<Task>()
         .set_responses(
@@ -142,26 +162,28 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                             .build()));
 }
 
-template <typename Float, typename Task>
+template <typename Float, typename Method, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const descriptor_t& desc,
                                 const train_input<Task>& input) {
-    return call_daal_kernel<Float, Task>(ctx,
-                                         desc,
-                                         input.get_data(),
-                                         input.get_initial_centroids());
+    return call_daal_kernel<Float, Method, Task>(ctx,
+                                                 desc,
+                                                 input.get_data(),
+                                                 input.get_initial_centroids());
 }
 
-template <typename Float>
-struct train_kernel_cpu<Float, method::lloyd_dense, task::clustering> {
+template <typename Float, typename Method>
+struct train_kernel_cpu<Float, Method, task::clustering> {
     train_result<task::clustering> operator()(const context_cpu& ctx,
                                               const descriptor_t& desc,
                                               const train_input<task::clustering>& input) const {
-        return train<Float, task::clustering>(ctx, desc, input);
+        return train<Float, Method, task::clustering>(ctx, desc, input);
     }
 };
 
 template struct train_kernel_cpu<float, method::lloyd_dense, task::clustering>;
 template struct train_kernel_cpu<double, method::lloyd_dense, task::clustering>;
+template struct train_kernel_cpu<float, method::lloyd_sparse, task::clustering>;
+template struct train_kernel_cpu<double, method::lloyd_sparse, task::clustering>;
 
 } // namespace oneapi::dal::kmeans::backend
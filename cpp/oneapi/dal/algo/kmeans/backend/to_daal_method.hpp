@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/algorithms/kmeans/kmeans_types.h>
+#include <daal/include/algorithms/kmeans/kmeans_init_types.h>
+
+#include "oneapi/dal/algo/kmeans/common.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+namespace daal_kmeans = daal::algorithms::kmeans;
+namespace daal_kmeans_init = daal::algorithms::kmeans::init;
+
+template <daal_kmeans::Method Value>
+using daal_method_constant = std::integral_constant<daal_kmeans::Method, Value>;
+
+template <daal_kmeans_init::Method Value>
+using daal_init_method_constant = std::integral_constant<daal_kmeans_init::Method, Value>;
+
+template <typename Method>
+struct to_daal_method;
+
+template <>
+struct to_daal_method<method::lloyd_dense> : daal_method_constant<daal_kmeans::lloydDense> {};
+
+template <>
+struct to_daal_method<method::lloyd_sparse> : daal_method_constant<daal_kmeans::lloydCSR> {};
+
+/// The method of centroids initialization used if initial centroids are not provided
+template <typename Method>
+struct to_daal_init_method;
+
+template <>
+struct to_daal_init_method<method::lloyd_dense>
+        : daal_init_method_constant<daal_kmeans_init::plusPlusDense> {};
+
+template <>
+struct to_daal_init_method<method::lloyd_sparse>
+        : daal_init_method_constant<daal_kmeans_init::plusPlusCSR> {};
+
+} // namespace oneapi::dal::kmeans::backend
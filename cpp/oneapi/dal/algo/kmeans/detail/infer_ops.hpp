@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/kmeans/infer_types.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 namespace v1 {
@@ -32,7 +33,7 @@ struct infer_ops_dispatcher {
 template <typename Descriptor>
 struct infer_ops {
     using float_t = typename Descriptor::float_t;
-    using method_t = method::by_default;
+    using method_t = typename Descriptor::method_t;
     using task_t = typename Descriptor::task_t;
     using input_t = infer_input<task_t>;
     using result_t = infer_result<task_t>;
@@ -44,6 +45,11 @@ struct infer_ops {
         if (!input.get_data().has_data()) {
             throw domain_error(msg::input_data_is_empty());
         }
+        if constexpr (std::is_same_v<method_t, method::lloyd_sparse>) {
+            if (input.get_data().get_kind() != dal::detail::csr_table::kind()) {
+                throw invalid_argument(msg::input_data_is_not_csr_table());
+            }
+        }
         if (!input.get_model().get_centroids().has_data()) {
             throw domain_error(msg::input_model_centroids_are_empty());
         }
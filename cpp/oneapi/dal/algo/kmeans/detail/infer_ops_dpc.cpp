@@ -36,11 +36,26 @@ struct infer_ops_dispatcher<data_parallel_policy, Float, Method, Task> {
     }
 };
 
+template <typename Float, typename Task>
+struct infer_ops_dispatcher<data_parallel_policy, Float, method::lloyd_sparse, Task> {
+    infer_result<Task> operator()(const data_parallel_policy& ctx,
+                                  const descriptor_base<Task>& params,
+                                  const infer_input<Task>& input) const {
+        // Sparse method is implemented only for CPU
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
+            KERNEL_SINGLE_NODE_CPU(
+                backend::infer_kernel_cpu<Float, method::lloyd_sparse, Task>)>;
+        return kernel_dispatcher_t{}(ctx, params, input);
+    }
+};
+
 #define INSTANTIATE(F, M, T) \
     template struct ONEDAL_EXPORT infer_ops_dispatcher<data_parallel_policy, F, M, T>;
 
-INSTANTIATE(float, method::by_default, task::clustering)
-INSTANTIATE(double, method::by_default, task::clustering)
+INSTANTIATE(float, method::lloyd_dense, task::clustering)
+INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_sparse, task::clustering)
+INSTANTIATE(double, method::lloyd_sparse, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
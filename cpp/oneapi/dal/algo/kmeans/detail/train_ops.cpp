@@ -38,6 +38,8 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_sparse, task::clustering)
+INSTANTIATE(double, method::lloyd_sparse, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/algo/kmeans/train_types.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 
 namespace oneapi::dal::kmeans::detail {
 namespace v1 {
@@ -44,6 +45,11 @@ struct train_ops {
         if (!(input.get_data().has_data())) {
             throw domain_error(msg::input_data_is_empty());
         }
+        if constexpr (std::is_same_v<method_t, method::lloyd_sparse>) {
+            if (input.get_data().get_kind() != dal::detail::csr_table::kind()) {
+                throw invalid_argument(msg::input_data_is_not_csr_table());
+            }
+        }
         if (input.get_data().get_row_count() > dal::detail::limits<std::int32_t>::max()) {
             throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
         }
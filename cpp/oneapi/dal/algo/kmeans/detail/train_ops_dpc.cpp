@@ -36,6 +36,19 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
     }
 };
 
+template <typename Policy, typename Float, typename Task>
+struct train_ops_dispatcher<Policy, Float, method::lloyd_sparse, Task> {
+    train_result<Task> operator()(const Policy& policy,
+                                  const descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        // Sparse method is implemented only for CPU
+        using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
+            KERNEL_SINGLE_NODE_CPU(
+                backend::train_kernel_cpu<Float, method::lloyd_sparse, Task>)>;
+        return kernel_dispatcher_t{}(policy, desc, input);
+    }
+};
+
 #define INSTANTIATE(F, M, T)                                              \
     template struct ONEDAL_EXPORT                                         \
         train_ops_dispatcher<dal::detail::data_parallel_policy, F, M, T>; \
@@ -45,6 +58,8 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::lloyd_sparse, task::clustering)
+INSTANTIATE(double, method::lloyd_sparse, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
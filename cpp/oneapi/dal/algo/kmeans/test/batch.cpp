@@ -93,6 +93,23 @@ TEMPLATE_LIST_TEST_M(kmeans_batch_test,
     this->check_on_gold_data();
 }
 
+TEMPLATE_LIST_TEST_M(kmeans_batch_test,
+                     "kmeans train/infer on many separated clusters",
+                     "[kmeans][batch]",
+                     kmeans_types) {
+    SKIP_IF(this->not_float64_friendly());
+    this->check_on_many_separated_clusters();
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_batch_test,
+                     "kmeans train with Hamerly's bounds on overlapping data",
+                     "[kmeans][batch]",
+                     kmeans_double_types) {
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->get_policy().is_gpu());
+    this->check_hamerly_bounds_on_overlapping_data();
+}
+
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans block test",
                      "[kmeans][batch][nightly][block]",
@@ -35,6 +35,7 @@ namespace te = dal::test::engine;
 namespace la = dal::test::engine::linalg;
 
 using kmeans_types = COMBINE_TYPES((float, double), (kmeans::method::lloyd_dense));
+using kmeans_double_types = COMBINE_TYPES((double), (kmeans::method::lloyd_dense));
 
 template <typename TestType, typename Derived>
 class kmeans_test : public te::crtp_algo_fixture<TestType, Derived> {
@@ -229,6 +230,109 @@ public:
         this->infer_checks(x, model, y, expected_obj_function);
     }
 
+    void check_on_many_separated_clusters() {
+        // Large enough cluster count for the CPU kernel to skip distance computations
+        // with the triangle inequality; the result must match plain Lloyd iterations
+        constexpr std::int64_t grid_size = 16;
+        constexpr std::int64_t cluster_count = grid_size * grid_size;
+        constexpr std::int64_t points_per_cluster = 4;
+        constexpr std::int64_t row_count = cluster_count * points_per_cluster;
+        constexpr std::int64_t column_count = 2;
+        constexpr float_t spacing = 10.0;
+
+        const float_t offsets[points_per_cluster][column_count] = { { -1.0, -1.0 },
+                                                                    { -1.0, 1.0 },
+                                                                    { 1.0, -1.0 },
+                                                                    { 1.0, 1.0 } };
+
+        auto data = array<float_t>::empty(row_count * column_count);
+        auto initial_centroids = array<float_t>::empty(cluster_count * column_count);
+        auto final_centroids = array<float_t>::empty(cluster_count * column_count);
+        auto responses = array<float_t>::empty(row_count);
+
+        auto data_ptr = data.get_mutable_data();
+        auto initial_centroids_ptr = initial_centroids.get_mutable_data();
+        auto final_centroids_ptr = final_centroids.get_mutable_data();
+        auto responses_ptr = responses.get_mutable_data();
+
+        for (std::int64_t c = 0; c < cluster_count; ++c) {
+            const float_t center[column_count] = { spacing * (c / grid_size),
+                                                   spacing * (c % grid_size) };
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                final_centroids_ptr[c * column_count + j] = center[j];
+                initial_centroids_ptr[c * column_count + j] = center[j] + 0.5 * (j + 1);
+            }
+            for (std::int64_t i = 0; i < points_per_cluster; ++i) {
+                const std::int64_t row = c * points_per_cluster + i;
+                for (std::int64_t j = 0; j < column_count; ++j) {
+                    data_ptr[row * column_count + j] = center[j] + offsets[i][j];
+                }
+                responses_ptr[row] = float_t(c);
+            }
+        }
+
+        const auto x = homogen_table::wrap(data, row_count, column_count);
+        const auto c_init = homogen_table::wrap(initial_centroids, cluster_count, column_count);
+        const auto c_final = homogen_table::wrap(final_centroids, cluster_count, column_count);
+        const auto y = homogen_table::wrap(responses, row_count, 1);
+
+        const float_t expected_obj_function = float_t(row_count * column_count);
+        this->exact_checks(x, c_init, c_final, y, cluster_count, 10, 0.0, expected_obj_function);
+    }
+
+    void check_hamerly_bounds_on_overlapping_data() {
+        // The CPU kernel uses Hamerly's bounds for many clusters and more than one iteration,
+        // and plain Lloyd iterations otherwise. Lloyd iterations do not depend on the previous
+        // ones, so chained single-iteration runs give the reference for the multi-iteration run
+        constexpr std::int64_t row_count = 5000;
+        constexpr std::int64_t column_count = 4;
+        constexpr std::int64_t cluster_count = 64;
+        constexpr std::int64_t max_iteration_count = 10;
+
+        const auto x_dataframe = GENERATE_DATAFRAME(
+            te::dataframe_builder{ row_count, column_count }.fill_normal(0, 1, 7777));
+        const table x = x_dataframe.get_table(this->get_policy(), this->get_homogen_table_id());
+
+        const auto first_rows = row_accessor<const float_t>(x).pull({ 0, cluster_count });
+        const auto c_init = homogen_table::wrap(first_rows, cluster_count, column_count);
+
+        INFO("run training with Hamerly's bounds");
+        const auto hamerly_result =
+            this->train(get_descriptor(cluster_count, max_iteration_count, 0.0), x, c_init);
+
+        INFO("run chained single-iteration Lloyd training");
+        const auto lloyd_desc = get_descriptor(cluster_count, 1, 0.0);
+        auto lloyd_result = this->train(lloyd_desc, x, c_init);
+        for (std::int64_t i = 1; i < max_iteration_count; ++i) {
+            lloyd_result = this->train(lloyd_desc, x, lloyd_result.get_model().get_centroids());
+        }
+
+        INFO("check if assignments match up to ties and rounding");
+        const auto hamerly_responses =
+            row_accessor<const float_t>(hamerly_result.get_responses()).pull();
+        const auto lloyd_responses =
+            row_accessor<const float_t>(lloyd_result.get_responses()).pull();
+        std::int64_t mismatch_count = 0;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            mismatch_count += (hamerly_responses[i] != lloyd_responses[i]);
+        }
+        CAPTURE(mismatch_count);
+        REQUIRE(mismatch_count <= row_count / 1000);
+
+        INFO("check if centroids and objective function match");
+        const double tol = 1e-6;
+        const double centroids_error = te::rel_error(lloyd_result.get_model().get_centroids(),
+                                                     hamerly_result.get_model().get_centroids(),
+                                                     tol);
+        CAPTURE(centroids_error);
+        REQUIRE(centroids_error < tol);
+
+        const double lloyd_objective = lloyd_result.get_objective_function_value();
+        const double hamerly_objective = hamerly_result.get_objective_function_value();
+        CAPTURE(lloyd_objective, hamerly_objective);
+        REQUIRE(std::abs(hamerly_objective - lloyd_objective) <= tol * std::abs(lloyd_objective));
+    }
+
     void check_on_large_data_with_one_cluster() {
         constexpr std::int64_t row_count = 1024 * 1024;
         constexpr std::int64_t column_count = 1024 / sizeof(float_t);
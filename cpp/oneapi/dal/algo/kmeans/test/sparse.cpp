@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/infer.hpp"
+#include "oneapi/dal/algo/kmeans/train.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class kmeans_sparse_test : public te::float_algo_fixture<TestType> {
+public:
+    using Float = TestType;
+    using task_t = kmeans::task::clustering;
+    using dense_descriptor_t = kmeans::descriptor<Float, kmeans::method::lloyd_dense, task_t>;
+    using sparse_descriptor_t = kmeans::descriptor<Float, kmeans::method::lloyd_sparse, task_t>;
+
+    template <typename Descriptor>
+    Descriptor get_descriptor(std::int64_t cluster_count) const {
+        return Descriptor{}
+            .set_cluster_count(cluster_count)
+            .set_max_iteration_count(3)
+            .set_accuracy_threshold(0.0);
+    }
+
+    table get_initial_centroids(const table& data, std::int64_t cluster_count) const {
+        const auto rows = row_accessor<const Float>{ data }.pull({ 0, cluster_count });
+        return homogen_table::wrap(rows, cluster_count, data.get_column_count());
+    }
+
+    void check_against_dense(const table& dense_data, std::int64_t cluster_count) {
+        const auto sparse_data = te::convert_to_csr_table<Float>(dense_data);
+        const auto initial_centroids = get_initial_centroids(dense_data, cluster_count);
+
+        const auto dense_desc = get_descriptor<dense_descriptor_t>(cluster_count);
+        const auto sparse_desc = get_descriptor<sparse_descriptor_t>(cluster_count);
+        const double tol = te::get_tolerance<Float>(1e-3, 1e-9);
+
+        INFO("run training")
+        const auto dense_train_result = this->train(dense_desc, dense_data, initial_centroids);
+        const auto sparse_train_result = this->train(sparse_desc, sparse_data, initial_centroids);
+
+        CHECK(te::abs_error(dense_train_result.get_model().get_centroids(),
+                            sparse_train_result.get_model().get_centroids()) < tol);
+        te::check_if_tables_equal<std::int32_t>(sparse_train_result.get_responses(),
+                                                dense_train_result.get_responses());
+        REQUIRE(sparse_train_result.get_iteration_count() ==
+                dense_train_result.get_iteration_count());
+
+        INFO("run inference")
+        const auto dense_infer_result =
+            this->infer(dense_desc, dense_train_result.get_model(), dense_data);
+        const auto sparse_infer_result =
+            this->infer(sparse_desc, sparse_train_result.get_model(), sparse_data);
+
+        te::check_if_tables_equal<std::int32_t>(sparse_infer_result.get_responses(),
+                                                dense_infer_result.get_responses());
+        const double dense_objective = dense_infer_result.get_objective_function_value();
+        const double sparse_objective = sparse_infer_result.get_objective_function_value();
+        REQUIRE(std::abs(sparse_objective - dense_objective) <=
+                tol * std::max(1.0, std::abs(dense_objective)));
+    }
+};
+
+using kmeans_sparse_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_M(kmeans_sparse_test,
+                     "kmeans sparse results match dense ones",
+                     "[kmeans][integration][sparse]",
+                     kmeans_sparse_types) {
+    // Sparse method is implemented only for CPU
+    SKIP_IF(!this->get_policy().is_cpu());
+    SKIP_IF(this->not_float64_friendly());
+
+    using Float = TestType;
+    const std::int64_t row_count = GENERATE(100, 1000);
+    const std::int64_t column_count = GENERATE(20, 300);
+    // About 6 non-zero values per row
+    const double nonzero_ratio = 6.0 / column_count;
+    const std::int64_t cluster_count = 5;
+
+    const auto data = te::generate_sparse_homogen_table<Float>(row_count,
+                                                               column_count,
+                                                               nonzero_ratio,
+                                                               -10.0,
+                                                               10.0,
+                                                               7777);
+    this->check_against_dense(data, cluster_count);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_sparse_test,
+                     "kmeans sparse method throws if data is not a csr table",
+                     "[kmeans][sparse][badarg]",
+                     kmeans_sparse_types) {
+    SKIP_IF(!this->get_policy().is_cpu());
+
+    using Float = TestType;
+    const auto data = te::generate_sparse_homogen_table<Float>(10, 4, 0.5, -1.0, 1.0, 7777);
+    const auto desc = kmeans::descriptor<Float, kmeans::method::lloyd_sparse>{ 2 };
+
+    REQUIRE_THROWS_AS(this->train(desc, data), invalid_argument);
+}
+
+} // namespace oneapi::dal::kmeans::test
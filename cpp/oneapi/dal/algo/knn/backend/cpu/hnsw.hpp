@@ -0,0 +1,699 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+#include "oneapi/dal/algo/knn/backend/distance_impl.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+enum class hnsw_distance_kind { minkowski, chebyshev, cosine };
+
+struct hnsw_distance_params {
+    hnsw_distance_kind kind = hnsw_distance_kind::minkowski;
+    double degree = 2.0;
+};
+
+template <typename Task>
+inline hnsw_distance_params get_hnsw_distance_params(const detail::descriptor_base<Task>& desc) {
+    const auto distance_impl = detail::get_distance_impl(desc);
+    if (!distance_impl) {
+        throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+
+    hnsw_distance_params params;
+    switch (distance_impl->get_daal_distance_type()) {
+        case detail::daal_distance_t::minkowski:
+            params.kind = hnsw_distance_kind::minkowski;
+            params.degree = distance_impl->get_degree();
+            break;
+        case detail::daal_distance_t::euclidean:
+            params.kind = hnsw_distance_kind::minkowski;
+            params.degree = 2.0;
+            break;
+        case detail::daal_distance_t::chebyshev:
+            params.kind = hnsw_distance_kind::chebyshev;
+            break;
+        case detail::daal_distance_t::cosine:
+            params.kind = hnsw_distance_kind::cosine;
+            break;
+        default: throw internal_error{ dal::detail::error_messages::unknown_distance_type() };
+    }
+    return params;
+}
+
+/// Distances used by the graph operate on a monotonic transform of the actual
+/// distance (e.g. the squared Euclidean distance) that is cheaper to compute.
+/// The :expr:`finalize` method converts it back.
+template <typename Cpu, typename Float>
+struct hnsw_euclidean_distance {
+    Float operator()(const Float* x, const Float* y) const {
+        Float sum = 0;
+        for (std::int64_t i = 0; i < column_count; ++i) {
+            const Float diff = x[i] - y[i];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    Float finalize(Float value) const {
+        return std::sqrt(value);
+    }
+
+    std::int64_t column_count;
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_minkowski_distance {
+    Float operator()(const Float* x, const Float* y) const {
+        Float sum = 0;
+        for (std::int64_t i = 0; i < column_count; ++i) {
+            sum += std::pow(std::abs(x[i] - y[i]), degree);
+        }
+        return sum;
+    }
+
+    Float finalize(Float value) const {
+        return std::pow(value, Float(1) / degree);
+    }
+
+    std::int64_t column_count;
+    Float degree;
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_chebyshev_distance {
+    Float operator()(const Float* x, const Float* y) const {
+        Float result = 0;
+        for (std::int64_t i = 0; i < column_count; ++i) {
+            result = std::max(result, std::abs(x[i] - y[i]));
+        }
+        return result;
+    }
+
+    Float finalize(Float value) const {
+        return value;
+    }
+
+    std::int64_t column_count;
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_cosine_distance {
+    Float operator()(const Float* x, const Float* y) const {
+        Float dot = 0;
+        Float x_norm = 0;
+        Float y_norm = 0;
+        for (std::int64_t i = 0; i < column_count; ++i) {
+            dot += x[i] * y[i];
+            x_norm += x[i] * x[i];
+            y_norm += y[i] * y[i];
+        }
+        const Float norm = std::sqrt(x_norm * y_norm);
+        return norm > 0 ? Float(1) - dot / norm : Float(1);
+    }
+
+    Float finalize(Float value) const {
+        return value;
+    }
+
+    std::int64_t column_count;
+};
+
+template <typename Cpu, typename Float, typename Body>
+inline auto dispatch_by_distance(const hnsw_distance_params& params,
+                                 std::int64_t column_count,
+                                 Body&& body) {
+    switch (params.kind) {
+        case hnsw_distance_kind::chebyshev:
+            return body(hnsw_chebyshev_distance<Cpu, Float>{ column_count });
+        case hnsw_distance_kind::cosine:
+            return body(hnsw_cosine_distance<Cpu, Float>{ column_count });
+        default:
+            if (params.degree == 2.0) {
+                return body(hnsw_euclidean_distance<Cpu, Float>{ column_count });
+            }
+            return body(
+                hnsw_minkowski_distance<Cpu, Float>{ column_count, Float(params.degree) });
+    }
+}
+
+/// Open-addressing set of the vertices visited by a single graph search.
+/// Clearing takes time proportional to the number of inserted vertices, so the
+/// set can be reused across searches regardless of the graph size.
+template <typename Cpu>
+class hnsw_visited_set {
+public:
+    hnsw_visited_set() {
+        reset_capacity(10);
+    }
+
+    bool insert(std::int32_t vertex) {
+        if (2 * (used_.size() + 1) > slots_.size()) {
+            grow();
+        }
+        return insert_unchecked(vertex);
+    }
+
+    void clear() {
+        for (const std::size_t slot : used_) {
+            slots_[slot] = empty;
+        }
+        used_.clear();
+    }
+
+private:
+    static constexpr std::int32_t empty = -1;
+
+    std::size_t get_slot(std::int32_t vertex) const {
+        const std::uint32_t hash = static_cast<std::uint32_t>(vertex) * 2654435761u;
+        return hash >> shift_;
+    }
+
+    bool insert_unchecked(std::int32_t vertex) {
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t slot = get_slot(vertex);
+        while (slots_[slot] != empty) {
+            if (slots_[slot] == vertex) {
+                return false;
+            }
+            slot = (slot + 1) & mask;
+        }
+        slots_[slot] = vertex;
+        used_.push_back(slot);
+        return true;
+    }
+
+    void reset_capacity(std::int32_t log_capacity) {
+        shift_ = 32 - log_capacity;
+        slots_.assign(std::size_t(1) << log_capacity, empty);
+        used_.clear();
+    }
+
+    void grow() {
+        std::vector<std::int32_t> vertices;
+        vertices.reserve(used_.size());
+        for (const std::size_t slot : used_) {
+            vertices.push_back(slots_[slot]);
+        }
+        reset_capacity(32 - shift_ + 1);
+        for (const std::int32_t vertex : vertices) {
+            insert_unchecked(vertex);
+        }
+    }
+
+    std::vector<std::int32_t> slots_;
+    std::vector<std::size_t> used_;
+    std::int32_t shift_ = 0;
+};
+
+template <typename Cpu, typename Float>
+struct hnsw_scratch {
+    using candidate_t = std::pair<Float, std::int32_t>;
+
+    hnsw_visited_set<Cpu> visited;
+    std::vector<candidate_t> candidates;
+    std::vector<candidate_t> results;
+    std::vector<candidate_t> entries;
+    std::vector<candidate_t> pruned;
+    std::vector<std::int32_t> selected;
+    std::vector<std::int32_t> links;
+    std::vector<std::int32_t> neighbors;
+};
+
+/// Operations over the HNSW graph shared by the construction and the search.
+/// During construction the adjacency lists are modified concurrently, so every
+/// list is copied under its vertex lock before it is traversed.
+template <typename Cpu, typename Float, typename Distance>
+class hnsw_index {
+public:
+    using candidate_t = std::pair<Float, std::int32_t>;
+    using scratch_t = hnsw_scratch<Cpu, Float>;
+
+    hnsw_index(const Float* data,
+               std::int64_t column_count,
+               const Distance& distance,
+               std::int64_t degree,
+               std::int32_t* base_neighbors,
+               const std::int64_t* upper_offsets,
+               std::int32_t* upper_neighbors,
+               std::atomic<bool>* locks = nullptr)
+            : data_(data),
+              column_count_(column_count),
+              distance_(distance),
+              degree_(degree),
+              base_neighbors_(base_neighbors),
+              upper_offsets_(upper_offsets),
+              upper_neighbors_(upper_neighbors),
+              locks_(locks) {}
+
+    const Float* get_row(std::int32_t vertex) const {
+        return data_ + vertex * column_count_;
+    }
+
+    Float get_distance(const Float* x, std::int32_t vertex) const {
+        return distance_(x, get_row(vertex));
+    }
+
+    Float finalize(Float value) const {
+        return distance_.finalize(value);
+    }
+
+    std::int64_t get_max_degree(std::int64_t level) const {
+        return level == 0 ? 2 * degree_ : degree_;
+    }
+
+    std::int32_t* get_neighbors(std::int32_t vertex, std::int64_t level) const {
+        if (level == 0) {
+            return base_neighbors_ + vertex * (2 * degree_ + 1);
+        }
+        return upper_neighbors_ + upper_offsets_[vertex] + (level - 1) * (degree_ + 1);
+    }
+
+    void lock(std::int32_t vertex) const {
+        if (locks_) {
+            while (locks_[vertex].exchange(true, std::memory_order_acquire)) {
+                while (locks_[vertex].load(std::memory_order_relaxed)) {
+                }
+            }
+        }
+    }
+
+    void unlock(std::int32_t vertex) const {
+        if (locks_) {
+            locks_[vertex].store(false, std::memory_order_release);
+        }
+    }
+
+    void copy_neighbors(std::int32_t vertex,
+                        std::int64_t level,
+                        std::vector<std::int32_t>& neighbors) const {
+        lock(vertex);
+        const std::int32_t* list = get_neighbors(vertex, level);
+        neighbors.assign(list + 1, list + 1 + list[0]);
+        unlock(vertex);
+    }
+
+    /// Moves greedily towards the query on a single layer
+    candidate_t search_greedy(const Float* x,
+                              candidate_t entry,
+                              std::int64_t level,
+                              scratch_t& scratch) const {
+        bool is_changed = true;
+        while (is_changed) {
+            is_changed = false;
+            copy_neighbors(entry.second, level, scratch.neighbors);
+            for (const std::int32_t neighbor : scratch.neighbors) {
+                const Float dist = get_distance(x, neighbor);
+                if (dist < entry.first) {
+                    entry = { dist, neighbor };
+                    is_changed = true;
+                }
+            }
+        }
+        return entry;
+    }
+
+    /// Collects up to :expr:`candidate_count` vertices closest to the query on a
+    /// single layer starting from :expr:`scratch.entries`. The result is stored
+    /// in :expr:`scratch.results` in ascending order of the distance.
+    void search_layer(const Float* x,
+                      std::int64_t candidate_count,
+                      std::int64_t level,
+                      scratch_t& scratch) const {
+        auto& candidates = scratch.candidates;
+        auto& results = scratch.results;
+        const auto closest_first = std::greater<candidate_t>{};
+
+        scratch.visited.clear();
+        candidates.clear();
+        results.clear();
+
+        for (const auto& entry : scratch.entries) {
+            if (scratch.visited.insert(entry.second)) {
+                candidates.push_back(entry);
+                std::push_heap(candidates.begin(), candidates.end(), closest_first);
+                results.push_back(entry);
+                std::push_heap(results.begin(), results.end());
+            }
+        }
+        while (std::int64_t(results.size()) > candidate_count) {
+            std::pop_heap(results.begin(), results.end());
+            results.pop_back();
+        }
+
+        while (!candidates.empty()) {
+            const candidate_t current = candidates.front();
+            if (current.first > results.front().first &&
+                std::int64_t(results.size()) == candidate_count) {
+                break;
+            }
+            std::pop_heap(candidates.begin(), candidates.end(), closest_first);
+            candidates.pop_back();
+
+            copy_neighbors(current.second, level, scratch.neighbors);
+            for (const std::int32_t neighbor : scratch.neighbors) {
+                if (!scratch.visited.insert(neighbor)) {
+                    continue;
+                }
+                const Float dist = get_distance(x, neighbor);
+                if (std::int64_t(results.size()) < candidate_count ||
+                    dist < results.front().first) {
+                    candidates.push_back({ dist, neighbor });
+                    std::push_heap(candidates.begin(), candidates.end(), closest_first);
+                    results.push_back({ dist, neighbor });
+                    std::push_heap(results.begin(), results.end());
+                    if (std::int64_t(results.size()) > candidate_count) {
+                        std::pop_heap(results.begin(), results.end());
+                        results.pop_back();
+                    }
+                }
+            }
+        }
+
+        std::sort_heap(results.begin(), results.end());
+    }
+
+    /// Keeps the candidates that are closer to the base vertex than to any
+    /// already selected neighbor. This heuristic preserves links towards
+    /// distinct clusters. :expr:`candidates` must be sorted by the distance.
+    void select_neighbors(const std::vector<candidate_t>& candidates,
+                          std::int64_t max_count,
+                          std::vector<std::int32_t>& selected) const {
+        selected.clear();
+        for (const auto& candidate : candidates) {
+            if (std::int64_t(selected.size()) >= max_count) {
+                break;
+            }
+            const Float* row = get_row(candidate.second);
+            bool is_good = true;
+            for (const std::int32_t neighbor : selected) {
+                if (get_distance(row, neighbor) < candidate.first) {
+                    is_good = false;
+                    break;
+                }
+            }
+            if (is_good) {
+                selected.push_back(candidate.second);
+            }
+        }
+    }
+
+    /// Adds the edge from :expr:`vertex` to :expr:`new_neighbor` pruning the
+    /// adjacency list of :expr:`vertex` if it is full
+    void connect(std::int32_t vertex,
+                 std::int32_t new_neighbor,
+                 Float dist,
+                 std::int64_t level,
+                 scratch_t& scratch) const {
+        const std::int64_t max_degree = get_max_degree(level);
+
+        lock(vertex);
+        std::int32_t* list = get_neighbors(vertex, level);
+        const std::int32_t count = list[0];
+        if (count < max_degree) {
+            list[count + 1] = new_neighbor;
+            list[0] = count + 1;
+        }
+        else {
+            const Float* row = get_row(vertex);
+            auto& pruned = scratch.pruned;
+            pruned.clear();
+            pruned.push_back({ dist, new_neighbor });
+            for (std::int32_t i = 1; i <= count; ++i) {
+                pruned.push_back({ get_distance(row, list[i]), list[i] });
+            }
+            std::sort(pruned.begin(), pruned.end());
+
+            auto& selected = scratch.selected;
+            select_neighbors(pruned, max_degree, selected);
+            std::copy(selected.begin(), selected.end(), list + 1);
+            list[0] = std::int32_t(selected.size());
+        }
+        unlock(vertex);
+    }
+
+private:
+    const Float* data_;
+    std::int64_t column_count_;
+    Distance distance_;
+    std::int64_t degree_;
+    std::int32_t* base_neighbors_;
+    const std::int64_t* upper_offsets_;
+    std::int32_t* upper_neighbors_;
+    std::atomic<bool>* locks_;
+};
+
+/// Draws the top layer of every vertex from the geometric distribution with the
+/// normalization factor :expr:`1 / ln(degree)`. The level depends only on the
+/// vertex index, so the layout is reproducible regardless of the thread count.
+template <typename Cpu>
+inline std::int32_t get_hnsw_level(std::int64_t vertex, double level_factor) {
+    std::uint64_t z = std::uint64_t(vertex) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z = z ^ (z >> 31);
+    const double uniform = double((z >> 11) + 1) * 0x1.0p-53;
+    return std::int32_t(-std::log(uniform) * level_factor);
+}
+
+template <typename Cpu, typename Float>
+struct hnsw_kernel {
+    hnsw_graph build(const Float* data,
+                     std::int64_t row_count,
+                     std::int64_t column_count,
+                     const hnsw_distance_params& distance,
+                     std::int64_t degree,
+                     std::int64_t candidate_count) const {
+        return dispatch_by_distance<Cpu, Float>(distance, column_count, [&](auto dist) {
+            return build_impl(data, row_count, column_count, dist, degree, candidate_count);
+        });
+    }
+
+    void search(const hnsw_graph& graph,
+                const Float* data,
+                std::int64_t column_count,
+                const hnsw_distance_params& distance,
+                const Float* queries,
+                std::int64_t query_count,
+                std::int64_t neighbor_count,
+                std::int64_t candidate_count,
+                std::int64_t* indices,
+                Float* distances) const {
+        dispatch_by_distance<Cpu, Float>(distance, column_count, [&](auto dist) {
+            search_impl(graph,
+                        data,
+                        column_count,
+                        dist,
+                        queries,
+                        query_count,
+                        neighbor_count,
+                        candidate_count,
+                        indices,
+                        distances);
+        });
+    }
+
+private:
+    static constexpr std::int32_t block_size = 256;
+
+    template <typename Distance>
+    hnsw_graph build_impl(const Float* data,
+                          std::int64_t row_count,
+                          std::int64_t column_count,
+                          const Distance& distance,
+                          std::int64_t degree,
+                          std::int64_t candidate_count) const {
+        using index_t = hnsw_index<Cpu, Float, Distance>;
+        using scratch_t = typename index_t::scratch_t;
+
+        const std::int32_t vertex_count = dal::detail::integral_cast<std::int32_t>(row_count);
+        const double level_factor = 1.0 / std::log(double(degree));
+
+        hnsw_graph graph;
+        graph.degree = degree;
+
+        graph.levels = array<std::int32_t>::empty(vertex_count);
+        std::int32_t* levels = graph.levels.get_mutable_data();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t v) {
+            levels[v] = get_hnsw_level<Cpu>(v, level_factor);
+        });
+
+        graph.upper_offsets = array<std::int64_t>::empty(vertex_count);
+        std::int64_t* upper_offsets = graph.upper_offsets.get_mutable_data();
+        std::int64_t upper_size = 0;
+        for (std::int32_t v = 0; v < vertex_count; ++v) {
+            upper_offsets[v] = upper_size;
+            upper_size += levels[v] * (degree + 1);
+        }
+        graph.upper_neighbors = array<std::int32_t>::zeros(std::max<std::int64_t>(upper_size, 1));
+
+        const std::int64_t base_size =
+            dal::detail::check_mul_overflow<std::int64_t>(row_count, 2 * degree + 1);
+        graph.base_neighbors = array<std::int32_t>::zeros(base_size);
+
+        const auto locks = std::unique_ptr<std::atomic<bool>[]>(
+            new std::atomic<bool>[vertex_count] {});
+
+        const index_t index{ data,
+                             column_count,
+                             distance,
+                             degree,
+                             graph.base_neighbors.get_mutable_data(),
+                             upper_offsets,
+                             graph.upper_neighbors.get_mutable_data(),
+                             locks.get() };
+
+        std::int64_t entry_point = 0;
+        std::int64_t max_level = levels[0];
+        dal::detail::mutex entry_mutex;
+
+        const auto insert = [&](std::int32_t vertex, scratch_t& scratch) {
+            const Float* x = index.get_row(vertex);
+            const std::int64_t level = levels[vertex];
+
+            entry_mutex.lock();
+            const std::int32_t entry = std::int32_t(entry_point);
+            const std::int64_t top_level = max_level;
+            // The vertex that raises the top level keeps the lock until it is
+            // linked, so the other insertions never start from an isolated vertex
+            const bool is_new_top = level > top_level;
+            if (!is_new_top) {
+                entry_mutex.unlock();
+            }
+
+            auto closest = std::make_pair(index.get_distance(x, entry), entry);
+            for (std::int64_t l = top_level; l > level; --l) {
+                closest = index.search_greedy(x, closest, l, scratch);
+            }
+
+            scratch.entries.assign(1, closest);
+            for (std::int64_t l = std::min(level, top_level); l >= 0; --l) {
+                index.search_layer(x, candidate_count, l, scratch);
+                index.select_neighbors(scratch.results, degree, scratch.selected);
+
+                // The selection buffer is reused while the links are pruned
+                const auto& selected = scratch.links;
+                scratch.links.swap(scratch.selected);
+                index.lock(vertex);
+                std::int32_t* list = index.get_neighbors(vertex, l);
+                std::copy(selected.begin(), selected.end(), list + 1);
+                list[0] = std::int32_t(selected.size());
+                index.unlock(vertex);
+
+                for (const std::int32_t neighbor : selected) {
+                    const Float dist = index.get_distance(index.get_row(neighbor), vertex);
+                    index.connect(neighbor, vertex, dist, l, scratch);
+                }
+                scratch.entries.swap(scratch.results);
+            }
+
+            if (is_new_top) {
+                entry_point = vertex;
+                max_level = level;
+                entry_mutex.unlock();
+            }
+        };
+
+        const std::int32_t block_count = (vertex_count - 1 + block_size - 1) / block_size;
+        dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+            scratch_t scratch;
+            const std::int32_t first = 1 + block * block_size;
+            const std::int32_t last = std::min(vertex_count, first + block_size);
+            for (std::int32_t vertex = first; vertex < last; ++vertex) {
+                insert(vertex, scratch);
+            }
+        });
+
+        graph.entry_point = entry_point;
+        graph.max_level = max_level;
+        return graph;
+    }
+
+    template <typename Distance>
+    void search_impl(const hnsw_graph& graph,
+                     const Float* data,
+                     std::int64_t column_count,
+                     const Distance& distance,
+                     const Float* queries,
+                     std::int64_t query_count,
+                     std::int64_t neighbor_count,
+                     std::int64_t candidate_count,
+                     std::int64_t* indices,
+                     Float* distances) const {
+        using index_t = hnsw_index<Cpu, Float, Distance>;
+        using scratch_t = typename index_t::scratch_t;
+
+        // The search does not modify the graph
+        const index_t index{ data,
+                             column_count,
+                             distance,
+                             graph.degree,
+                             const_cast<std::int32_t*>(graph.base_neighbors.get_data()),
+                             graph.upper_offsets.get_data(),
+                             const_cast<std::int32_t*>(graph.upper_neighbors.get_data()) };
+
+        const std::int64_t effective_candidate_count = std::max(candidate_count, neighbor_count);
+        const std::int32_t entry = std::int32_t(graph.entry_point);
+
+        const std::int32_t block_count =
+            dal::detail::integral_cast<std::int32_t>((query_count + block_size - 1) / block_size);
+        dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+            scratch_t scratch;
+            const std::int64_t first = std::int64_t(block) * block_size;
+            const std::int64_t last = std::min(query_count, first + block_size);
+            for (std::int64_t i = first; i < last; ++i) {
+                const Float* x = queries + i * column_count;
+
+                auto closest = std::make_pair(index.get_distance(x, entry), entry);
+                for (std::int64_t l = graph.max_level; l > 0; --l) {
+                    closest = index.search_greedy(x, closest, l, scratch);
+                }
+
+                scratch.entries.assign(1, closest);
+                index.search_layer(x, effective_candidate_count, 0, scratch);
+
+                const std::int64_t found_count =
+                    std::min(neighbor_count, std::int64_t(scratch.results.size()));
+                for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                    const bool is_found = j < found_count;
+                    if (indices) {
+                        indices[i * neighbor_count + j] = is_found ? scratch.results[j].second : -1;
+                    }
+                    if (distances) {
+                        distances[i * neighbor_count + j] =
+                            is_found ? index.finalize(scratch.results[j].first)
+                                     : std::numeric_limits<Float>::max();
+                    }
+                }
+            }
+        });
+    }
+};
+
+} // namespace oneapi::dal::knn::backend
@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/algo/knn/backend/model_conversion.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+/// Assigns every query the class with the largest total weight among its
+/// neighbors. Ties are resolved in favor of the smaller class label.
+template <typename Float>
+static void vote(const detail::descriptor_base<task::classification>& desc,
+                 const Float* train_responses,
+                 const std::int64_t* indices,
+                 const Float* distances,
+                 std::int64_t row_count,
+                 Float* responses) {
+    const std::int64_t class_count = desc.get_class_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+    const bool is_distance_weighted = desc.get_voting_mode() == voting_mode::distance;
+    const Float epsilon = std::numeric_limits<Float>::epsilon();
+
+    const std::int32_t row_count_int32 = dal::detail::integral_cast<std::int32_t>(row_count);
+    dal::detail::threader_for(row_count_int32, row_count_int32, [&](std::int32_t i) {
+        const std::int64_t* row_indices = indices + i * neighbor_count;
+        const Float* row_distances = distances + i * neighbor_count;
+
+        // If some neighbors coincide with the query, only they vote
+        bool has_exact_match = false;
+        if (is_distance_weighted) {
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                has_exact_match |= row_indices[j] >= 0 && row_distances[j] < epsilon;
+            }
+        }
+
+        std::vector<Float> weights(class_count, Float(0));
+        for (std::int64_t j = 0; j < neighbor_count; ++j) {
+            if (row_indices[j] < 0) {
+                continue;
+            }
+            const auto label = static_cast<std::int64_t>(train_responses[row_indices[j]]);
+            if (label < 0 || label >= class_count) {
+                continue;
+            }
+            if (!is_distance_weighted) {
+                weights[label] += Float(1);
+            }
+            else if (has_exact_match) {
+                weights[label] += row_distances[j] < epsilon ? Float(1) : Float(0);
+            }
+            else {
+                weights[label] += Float(1) / row_distances[j];
+            }
+        }
+
+        const auto best = std::max_element(weights.begin(), weights.end());
+        responses[i] = Float(std::distance(weights.begin(), best));
+    });
+}
+
+template <typename Float, typename Task>
+static infer_result<Task> infer(const context_cpu& ctx,
+                                const detail::descriptor_base<Task>& desc,
+                                const infer_input<Task>& input) {
+    const auto trained_model =
+        dynamic_cast_to_knn_model<Task, hnsw_model_impl<Task>>(input.get_model());
+
+    const table train_data = trained_model->get_data();
+    const table data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t neighbor_count = desc.get_neighbor_count();
+
+    if (column_count != train_data.get_column_count()) {
+        throw invalid_argument{ dal::detail::error_messages::incompatible_knn_model() };
+    }
+
+    const auto result_options = desc.get_result_options();
+    const bool compute_responses = result_options.test(result_options::responses);
+
+    // Responses are derived from the neighbors, so they are searched anyway
+    dal::detail::check_mul_overflow(neighbor_count, row_count);
+    auto arr_indices = array<std::int64_t>::empty(neighbor_count * row_count);
+    auto arr_distances = array<Float>::empty(neighbor_count * row_count);
+
+    const auto distance = get_hnsw_distance_params(desc);
+    const auto train_arr = row_accessor<const Float>(train_data).pull();
+    const auto data_arr = row_accessor<const Float>(data).pull();
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        hnsw_kernel<decltype(cpu), Float>{}.search(trained_model->get_graph(),
+                                                   train_arr.get_data(),
+                                                   column_count,
+                                                   distance,
+                                                   data_arr.get_data(),
+                                                   row_count,
+                                                   neighbor_count,
+                                                   desc.get_search_candidate_count(),
+                                                   arr_indices.get_mutable_data(),
+                                                   arr_distances.get_mutable_data());
+    });
+
+    auto result = infer_result<Task>{}.set_result_options(result_options);
+
+    if constexpr (std::is_same_v<Task, task::classification>) {
+        if (compute_responses) {
+            const auto train_responses =
+                row_accessor<const Float>(trained_model->get_responses()).pull();
+            auto arr_responses = array<Float>::empty(row_count);
+            vote(desc,
+                 train_responses.get_data(),
+                 arr_indices.get_data(),
+                 arr_distances.get_data(),
+                 row_count,
+                 arr_responses.get_mutable_data());
+            result = result.set_responses(homogen_table::wrap(arr_responses, row_count, 1));
+        }
+    }
+
+    if (result_options.test(result_options::indices)) {
+        result = result.set_indices(homogen_table::wrap(arr_indices, row_count, neighbor_count));
+    }
+
+    if (result_options.test(result_options::distances)) {
+        result =
+            result.set_distances(homogen_table::wrap(arr_distances, row_count, neighbor_count));
+    }
+    return result;
+}
+
+template <typename Float, typename Task>
+struct infer_kernel_cpu<Float, method::hnsw, Task> {
+    infer_result<Task> operator()(const context_cpu& ctx,
+                                  const detail::descriptor_base<Task>& desc,
+                                  const infer_input<Task>& input) const {
+        return infer<Float, Task>(ctx, desc, input);
+    }
+};
+
+template struct infer_kernel_cpu<float, method::hnsw, task::classification>;
+template struct infer_kernel_cpu<double, method::hnsw, task::classification>;
+template struct infer_kernel_cpu<float, method::hnsw, task::search>;
+template struct infer_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
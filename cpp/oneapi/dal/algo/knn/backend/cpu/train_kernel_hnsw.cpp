@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/algo/knn/backend/cpu/hnsw.hpp"
+#include "oneapi/dal/algo/knn/backend/model_impl.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::knn::backend {
+
+using dal::backend::context_cpu;
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const detail::descriptor_base<Task>& desc,
+                                const train_input<Task>& input) {
+    using model_t = model<Task>;
+
+    const table data = input.get_data();
+    const table responses = input.get_responses();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    const auto distance = get_hnsw_distance_params(desc);
+    const auto data_arr = row_accessor<const Float>(data).pull();
+
+    const auto graph = dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        return hnsw_kernel<decltype(cpu), Float>{}.build(data_arr.get_data(),
+                                                         row_count,
+                                                         column_count,
+                                                         distance,
+                                                         desc.get_graph_degree(),
+                                                         desc.get_construction_candidate_count());
+    });
+
+    const auto model_impl = std::make_shared<hnsw_model_impl<Task>>(data, responses, graph);
+    return train_result<Task>().set_model(dal::detail::make_private<model_t>(model_impl));
+}
+
+template <typename Float, typename Task>
+struct train_kernel_cpu<Float, method::hnsw, Task> {
+    train_result<Task> operator()(const context_cpu& ctx,
+                                  const detail::descriptor_base<Task>& desc,
+                                  const train_input<Task>& input) const {
+        return train<Float, Task>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::hnsw, task::classification>;
+template struct train_kernel_cpu<double, method::hnsw, task::classification>;
+template struct train_kernel_cpu<float, method::hnsw, task::search>;
+template struct train_kernel_cpu<double, method::hnsw, task::search>;
+
+} // namespace oneapi::dal::knn::backend
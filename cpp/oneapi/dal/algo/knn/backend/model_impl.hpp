@@ -110,5 +110,67 @@ private:
     backend::model_interop* interop_;
 };
 
+/// Hierarchical navigable small world graph over the rows of the training set.
+/// Every vertex has a bottom-layer adjacency list of up to :expr:`2 * degree`
+/// neighbors. Vertices with :expr:`levels[v] > 0` additionally have one list of
+/// up to :expr:`degree` neighbors per upper layer, stored consecutively starting
+/// at :expr:`upper_offsets[v]`. Each list is prefixed with its length.
+struct hnsw_graph {
+    std::int64_t degree = 0;
+    std::int64_t entry_point = -1;
+    std::int64_t max_level = -1;
+    array<std::int32_t> levels;
+    array<std::int32_t> base_neighbors;
+    array<std::int64_t> upper_offsets;
+    array<std::int32_t> upper_neighbors;
+};
+
+template <typename Task>
+class hnsw_model_impl : public model_impl<Task>,
+                        public KNN_SERIALIZABLE(Task,
+                                                knn_hnsw_classification_model_impl_id,
+                                                knn_hnsw_search_model_impl_id) {
+public:
+    hnsw_model_impl() = default;
+
+    hnsw_model_impl(const table& data, const table& responses, const hnsw_graph& graph)
+            : data_(data),
+              responses_(responses),
+              graph_(graph) {}
+
+    backend::model_interop* get_interop() override {
+        return nullptr;
+    }
+
+    void serialize(dal::detail::output_archive& ar) const override {
+        ar(data_, responses_);
+        ar(graph_.degree, graph_.entry_point, graph_.max_level);
+        ar(graph_.levels, graph_.base_neighbors, graph_.upper_offsets, graph_.upper_neighbors);
+    }
+
+    void deserialize(dal::detail::input_archive& ar) override {
+        ar(data_, responses_);
+        ar(graph_.degree, graph_.entry_point, graph_.max_level);
+        ar(graph_.levels, graph_.base_neighbors, graph_.upper_offsets, graph_.upper_neighbors);
+    }
+
+    table get_data() {
+        return data_;
+    }
+
+    table get_responses() {
+        return responses_;
+    }
+
+    const hnsw_graph& get_graph() const {
+        return graph_;
+    }
+
+private:
+    table data_;
+    table responses_;
+    hnsw_graph graph_;
+};
+
 } // namespace backend
 } // namespace oneapi::dal::knn
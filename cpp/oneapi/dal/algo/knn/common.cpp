@@ -60,6 +60,9 @@ public:
     voting_mode voting_mode_value = voting_mode::uniform;
     detail::distance_ptr distance;
     result_option_id result_options = get_default_result_options<Task>();
+    std::int64_t graph_degree = 16;
+    std::int64_t construction_candidate_count = 100;
+    std::int64_t search_candidate_count = 64;
 };
 
 template <typename Task>
@@ -135,6 +138,45 @@ void descriptor_base<Task>::set_result_options_impl(const result_option_id& valu
     impl_->result_options = value;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_graph_degree() const {
+    return impl_->graph_degree;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_graph_degree_impl(std::int64_t value) {
+    if (value < 2) {
+        throw domain_error(dal::detail::error_messages::graph_degree_lt_two());
+    }
+    impl_->graph_degree = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_construction_candidate_count() const {
+    return impl_->construction_candidate_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_construction_candidate_count_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::construction_candidate_count_lt_one());
+    }
+    impl_->construction_candidate_count = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_search_candidate_count() const {
+    return impl_->search_candidate_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_search_candidate_count_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::search_candidate_count_lt_one());
+    }
+    impl_->search_candidate_count = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::classification>;
 template class ONEDAL_EXPORT descriptor_base<task::search>;
 
@@ -168,6 +210,8 @@ ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::classificatio
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::classification>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::brute_force_model_impl<task::search>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::kd_tree_model_impl<task::search>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::hnsw_model_impl<task::classification>)
+ONEDAL_REGISTER_SERIALIZABLE(backend::hnsw_model_impl<task::search>)
 ONEDAL_REGISTER_SERIALIZABLE(backend::model_interop)
 
 } // namespace v1
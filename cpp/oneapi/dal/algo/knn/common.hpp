@@ -66,6 +66,10 @@ struct kd_tree {};
 /// method.
 struct brute_force {};
 
+/// Tag-type that denotes approximate search over a hierarchical navigable
+/// small world (HNSW) graph built on the training set.
+struct hnsw {};
+
 /// Alias tag-type for :ref:`brute-force <knn_t_math_brute_force>` computational
 /// method.
 using by_default = brute_force;
@@ -73,6 +77,7 @@ using by_default = brute_force;
 
 using v1::kd_tree;
 using v1::brute_force;
+using v1::hnsw;
 using v1::by_default;
 
 } // namespace method
@@ -118,7 +123,7 @@ constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>
 
 template <typename Method>
 constexpr bool is_valid_method_v =
-    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force>;
+    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force, method::hnsw>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::classification, task::search>;
@@ -141,6 +146,13 @@ template <typename T>
 using enable_if_brute_force_t =
     std::enable_if_t<std::is_same_v<std::decay_t<T>, method::brute_force>>;
 
+template <typename T>
+using enable_if_hnsw_t = std::enable_if_t<std::is_same_v<std::decay_t<T>, method::hnsw>>;
+
+template <typename T>
+using enable_if_custom_distance_t =
+    std::enable_if_t<dal::detail::is_one_of_v<std::decay_t<T>, method::brute_force, method::hnsw>>;
+
 template <typename Task = task::by_default>
 class descriptor_base : public base {
     static_assert(is_valid_task_v<Task>);
@@ -159,6 +171,9 @@ public:
     std::int64_t get_neighbor_count() const;
     voting_mode get_voting_mode() const;
     result_option_id get_result_options() const;
+    std::int64_t get_graph_degree() const;
+    std::int64_t get_construction_candidate_count() const;
+    std::int64_t get_search_candidate_count() const;
 
 protected:
     explicit descriptor_base(const detail::distance_ptr& distance);
@@ -169,6 +184,9 @@ protected:
     void set_distance_impl(const detail::distance_ptr& distance);
     const detail::distance_ptr& get_distance_impl() const;
     void set_result_options_impl(const result_option_id& value);
+    void set_graph_degree_impl(std::int64_t value);
+    void set_construction_candidate_count_impl(std::int64_t value);
+    void set_search_candidate_count_impl(std::int64_t value);
 
 private:
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -188,6 +206,8 @@ using v1::is_valid_distance_v;
 using v1::enable_if_search_t;
 using v1::enable_if_classification_t;
 using v1::enable_if_brute_force_t;
+using v1::enable_if_hnsw_t;
+using v1::enable_if_custom_distance_t;
 
 } // namespace detail
 
@@ -197,7 +217,8 @@ namespace v1 {
 ///                     intermediate computations. Can be :expr:`float` or
 ///                     :expr:`double`.
 /// @tparam Method      Tag-type that specifies an implementation of algorithm. Can
-///                     be :expr:`method::brute_force` or :expr:`method::kd_tree`.
+///                     be :expr:`method::brute_force`, :expr:`method::kd_tree` or
+///                     :expr:`method::hnsw`.
 /// @tparam Task        Tag-type that specifies type of the problem to solve. Can
 ///                     be :expr:`task::classification`.
 /// @tparam Distance    The descriptor of the distance used for computations. Can be
@@ -233,8 +254,8 @@ public:
 
     /// Creates a new instance of the class with the given :literal:`class_count`,
     /// :literal:`neighbor_count` and :literal:`distance` property values.
-    /// Used with :expr:`method::brute_force` only.
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
+    /// Used with :expr:`method::brute_force` and :expr:`method::hnsw` only.
+    template <typename M = Method, typename = detail::enable_if_custom_distance_t<M>>
     explicit descriptor(std::int64_t class_count,
                         std::int64_t neighbor_count,
                         const distance_t& distance)
@@ -292,20 +313,68 @@ public:
         return *this;
     }
 
-    /// Choose distance type for calculations. Used with :expr:`method::brute_force` only.
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
+    /// Choose distance type for calculations. Used with :expr:`method::brute_force`
+    /// and :expr:`method::hnsw` only.
+    template <typename M = Method, typename = detail::enable_if_custom_distance_t<M>>
     const distance_t& get_distance() const {
         using dist_t = detail::distance<distance_t>;
         const auto dist = std::static_pointer_cast<dist_t>(base_t::get_distance_impl());
         return dist;
     }
 
-    template <typename M = Method, typename = detail::enable_if_brute_force_t<M>>
+    template <typename M = Method, typename = detail::enable_if_custom_distance_t<M>>
     auto& set_distance(const distance_t& dist) {
         base_t::set_distance_impl(std::make_shared<detail::distance<distance_t>>(dist));
         return *this;
     }
 
+    /// The maximum number of neighbors a vertex keeps on the upper layers of
+    /// the HNSW graph. The bottom layer keeps twice as many. Larger values
+    /// improve recall at the cost of memory and build time.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`graph_degree > 1`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_graph_degree() const {
+        return base_t::get_graph_degree();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_graph_degree(std::int64_t value) {
+        base_t::set_graph_degree_impl(value);
+        return *this;
+    }
+
+    /// The number of candidates tracked while searching for the neighbors of
+    /// a vertex inserted into the HNSW graph. Controls the build effort.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`construction_candidate_count > 0`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_construction_candidate_count() const {
+        return base_t::get_construction_candidate_count();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_construction_candidate_count(std::int64_t value) {
+        base_t::set_construction_candidate_count_impl(value);
+        return *this;
+    }
+
+    /// The number of candidates tracked while searching for the neighbors of
+    /// a query. Controls the search effort; values below
+    /// :literal:`neighbor_count` are raised to :literal:`neighbor_count`.
+    /// Used with :expr:`method::hnsw` only.
+    /// @invariant :expr:`search_candidate_count > 0`
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    std::int64_t get_search_candidate_count() const {
+        return base_t::get_search_candidate_count();
+    }
+
+    template <typename M = Method, typename = detail::enable_if_hnsw_t<M>>
+    auto& set_search_candidate_count(std::int64_t value) {
+        base_t::set_search_candidate_count_impl(value);
+        return *this;
+    }
+
     /// Choose which results should be computed and returned.
     result_option_id get_result_options() const {
         return base_t::get_result_options();
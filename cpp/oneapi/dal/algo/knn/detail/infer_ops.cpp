@@ -41,10 +41,14 @@ INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
+INSTANTIATE(float, method::hnsw, task::classification)
+INSTANTIATE(double, method::hnsw, task::classification)
 INSTANTIATE(float, method::kd_tree, task::search)
 INSTANTIATE(double, method::kd_tree, task::search)
 INSTANTIATE(float, method::brute_force, task::search)
 INSTANTIATE(double, method::brute_force, task::search)
+INSTANTIATE(float, method::hnsw, task::search)
+INSTANTIATE(double, method::hnsw, task::search)
 
 } // namespace v1
 } // namespace oneapi::dal::knn::detail
@@ -44,9 +44,10 @@ public:
 
     static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
     static constexpr bool is_brute_force = std::is_same_v<Method, knn::method::brute_force>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
 
     bool not_available_on_device() {
-        return (get_policy().is_gpu() && is_kd_tree);
+        return (get_policy().is_gpu() && (is_kd_tree || is_hnsw));
     }
 
     auto get_descriptor(std::int64_t override_class_count = class_count,
@@ -88,7 +89,8 @@ private:
                                                                             -2.0, -1.0 };
 };
 
-using knn_types = COMBINE_TYPES((float), (knn::method::brute_force, knn::method::kd_tree));
+using knn_types =
+    COMBINE_TYPES((float), (knn::method::brute_force, knn::method::kd_tree, knn::method::hnsw));
 
 #define KNN_BADARG_TEST(name) \
     TEMPLATE_LIST_TEST_M(knn_badarg_test, name, "[knn][badarg]", knn_types)
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/knn/train.hpp"
+#include "oneapi/dal/algo/knn/infer.hpp"
+
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+
+namespace oneapi::dal::knn::test {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+class knn_hnsw_test : public te::float_algo_fixture<TestType> {
+public:
+    using Float = TestType;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu();
+    }
+
+    template <typename Task = task::search, typename Distance = minkowski_distance::descriptor<>>
+    auto get_descriptor(std::int64_t neighbor_count, const Distance& distance = Distance{}) const {
+        return knn::descriptor<Float, knn::method::hnsw, Task, Distance>(2,
+                                                                         neighbor_count,
+                                                                         distance);
+    }
+
+    static array<Float> generate_uniform(std::int64_t row_count,
+                                         std::int64_t column_count,
+                                         std::uint32_t seed) {
+        auto arr = array<Float>::empty(row_count * column_count);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<Float> dist(-1.0, 1.0);
+        std::generate_n(arr.get_mutable_data(), arr.get_count(), [&]() {
+            return dist(rng);
+        });
+        return arr;
+    }
+
+    template <typename Metric>
+    static std::vector<std::int64_t> exact_search(const array<Float>& train,
+                                                  const array<Float>& queries,
+                                                  std::int64_t column_count,
+                                                  std::int64_t neighbor_count,
+                                                  Metric&& metric) {
+        const std::int64_t train_count = train.get_count() / column_count;
+        const std::int64_t query_count = queries.get_count() / column_count;
+
+        std::vector<std::int64_t> result(query_count * neighbor_count);
+        std::vector<double> distances(train_count);
+        std::vector<std::int64_t> order(train_count);
+        for (std::int64_t i = 0; i < query_count; ++i) {
+            const Float* x = queries.get_data() + i * column_count;
+            for (std::int64_t j = 0; j < train_count; ++j) {
+                distances[j] = metric(x, train.get_data() + j * column_count, column_count);
+            }
+            std::iota(order.begin(), order.end(), std::int64_t(0));
+            std::partial_sort(order.begin(),
+                              order.begin() + neighbor_count,
+                              order.end(),
+                              [&](std::int64_t a, std::int64_t b) {
+                                  return distances[a] < distances[b];
+                              });
+            std::copy_n(order.begin(), neighbor_count, result.begin() + i * neighbor_count);
+        }
+        return result;
+    }
+
+    static double squared_euclidean(const Float* x, const Float* y, std::int64_t column_count) {
+        double sum = 0.0;
+        for (std::int64_t k = 0; k < column_count; ++k) {
+            sum += double(x[k] - y[k]) * double(x[k] - y[k]);
+        }
+        return sum;
+    }
+
+    static double cosine(const Float* x, const Float* y, std::int64_t column_count) {
+        double dot = 0.0, x_norm = 0.0, y_norm = 0.0;
+        for (std::int64_t k = 0; k < column_count; ++k) {
+            dot += double(x[k]) * double(y[k]);
+            x_norm += double(x[k]) * double(x[k]);
+            y_norm += double(y[k]) * double(y[k]);
+        }
+        return 1.0 - dot / std::sqrt(x_norm * y_norm);
+    }
+
+    static double compute_recall(const table& indices, const std::vector<std::int64_t>& expected) {
+        const std::int64_t row_count = indices.get_row_count();
+        const std::int64_t neighbor_count = indices.get_column_count();
+        const auto actual = row_accessor<const std::int32_t>(indices).pull();
+
+        std::int64_t hit_count = 0;
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            const auto first = expected.begin() + i * neighbor_count;
+            for (std::int64_t j = 0; j < neighbor_count; ++j) {
+                const std::int64_t index = actual[i * neighbor_count + j];
+                hit_count += std::count(first, first + neighbor_count, index);
+            }
+        }
+        return double(hit_count) / double(row_count * neighbor_count);
+    }
+};
+
+using knn_hnsw_types = COMBINE_TYPES((float, double));
+
+#define KNN_HNSW_TEST(name) \
+    TEMPLATE_LIST_TEST_M(knn_hnsw_test, name, "[knn][hnsw][integration][batch]", knn_hnsw_types)
+
+KNN_HNSW_TEST("search recall on random uniform data with Euclidean distance") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 4000;
+    constexpr std::int64_t infer_row_count = 200;
+    constexpr std::int64_t column_count = 16;
+    constexpr std::int64_t neighbor_count = 10;
+
+    const auto x_train = this->generate_uniform(train_row_count, column_count, 7777);
+    const auto x_infer = this->generate_uniform(infer_row_count, column_count, 8888);
+
+    const auto knn_desc = this->get_descriptor(neighbor_count)
+                              .set_graph_degree(16)
+                              .set_construction_candidate_count(100)
+                              .set_search_candidate_count(100);
+
+    const auto x_train_table = homogen_table::wrap(x_train, train_row_count, column_count);
+    const auto train_result = this->train(knn_desc, x_train_table);
+    const auto infer_result =
+        this->infer(knn_desc,
+                    homogen_table::wrap(x_infer, infer_row_count, column_count),
+                    train_result.get_model());
+
+    const auto expected = this->exact_search(x_train,
+                                             x_infer,
+                                             column_count,
+                                             neighbor_count,
+                                             this->squared_euclidean);
+    const double recall = this->compute_recall(infer_result.get_indices(), expected);
+    CAPTURE(recall);
+    REQUIRE(recall >= 0.9);
+
+    const auto indices = row_accessor<const std::int32_t>(infer_result.get_indices()).pull();
+    const auto distances = row_accessor<const TestType>(infer_result.get_distances()).pull();
+    for (std::int64_t i = 0; i < infer_row_count; ++i) {
+        for (std::int64_t j = 0; j < neighbor_count; ++j) {
+            const TestType* x = x_infer.get_data() + i * column_count;
+            const TestType* y = x_train.get_data() + indices[i * neighbor_count + j] * column_count;
+            const double reference = std::sqrt(this->squared_euclidean(x, y, column_count));
+            REQUIRE(std::abs(distances[i * neighbor_count + j] - reference) < 1e-4);
+            if (j > 0) {
+                REQUIRE(distances[i * neighbor_count + j - 1] <= distances[i * neighbor_count + j]);
+            }
+        }
+    }
+}
+
+KNN_HNSW_TEST("search recall on random uniform data with cosine distance") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t train_row_count = 3000;
+    constexpr std::int64_t infer_row_count = 100;
+    constexpr std::int64_t column_count = 24;
+    constexpr std::int64_t neighbor_count = 5;
+
+    const auto x_train = this->generate_uniform(train_row_count, column_count, 1234);
+    const auto x_infer = this->generate_uniform(infer_row_count, column_count, 4321);
+
+    const auto knn_desc =
+        this->get_descriptor(neighbor_count, cosine_distance::descriptor<TestType>{});
+
+    const auto x_train_table = homogen_table::wrap(x_train, train_row_count, column_count);
+    const auto train_result = this->train(knn_desc, x_train_table);
+    const auto infer_result =
+        this->infer(knn_desc,
+                    homogen_table::wrap(x_infer, infer_row_count, column_count),
+                    train_result.get_model());
+
+    const auto expected =
+        this->exact_search(x_train, x_infer, column_count, neighbor_count, this->cosine);
+    const double recall = this->compute_recall(infer_result.get_indices(), expected);
+    CAPTURE(recall);
+    REQUIRE(recall >= 0.9);
+}
+
+KNN_HNSW_TEST("finds training points themselves") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t row_count = 2000;
+    constexpr std::int64_t column_count = 8;
+
+    const auto x_train = this->generate_uniform(row_count, column_count, 42);
+    const auto x_table = homogen_table::wrap(x_train, row_count, column_count);
+
+    const auto knn_desc = this->get_descriptor(1).set_graph_degree(8);
+    const auto train_result = this->train(knn_desc, x_table);
+    const auto infer_result = this->infer(knn_desc, x_table, train_result.get_model());
+
+    const auto indices = row_accessor<const std::int32_t>(infer_result.get_indices()).pull();
+    std::int64_t found_count = 0;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        found_count += (indices[i] == i);
+    }
+    CAPTURE(found_count);
+    REQUIRE(found_count >= row_count * 99 / 100);
+}
+
+KNN_HNSW_TEST("classifies well separated clusters") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t class_count = 3;
+    constexpr std::int64_t row_count_per_class = 300;
+    constexpr std::int64_t row_count = class_count * row_count_per_class;
+    constexpr std::int64_t column_count = 4;
+
+    auto x_train = this->generate_uniform(row_count, column_count, 2021);
+    auto y_train = array<TestType>::empty(row_count);
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        const std::int64_t label = i % class_count;
+        x_train.get_mutable_data()[i * column_count] += TestType(10 * label);
+        y_train.get_mutable_data()[i] = TestType(label);
+    }
+
+    auto x_infer = this->generate_uniform(class_count, column_count, 2022);
+    for (std::int64_t i = 0; i < class_count; ++i) {
+        x_infer.get_mutable_data()[i * column_count] += TestType(10 * i);
+    }
+
+    const auto voting = GENERATE(voting_mode::uniform, voting_mode::distance);
+    const auto knn_desc = this->template get_descriptor<task::classification>(5)
+                              .set_class_count(class_count)
+                              .set_voting_mode(voting);
+
+    const auto train_result = this->train(knn_desc,
+                                          homogen_table::wrap(x_train, row_count, column_count),
+                                          homogen_table::wrap(y_train, row_count, 1));
+    const auto infer_result =
+        this->infer(knn_desc,
+                    homogen_table::wrap(x_infer, class_count, column_count),
+                    train_result.get_model());
+
+    const auto responses = row_accessor<const TestType>(infer_result.get_responses()).pull();
+    for (std::int64_t i = 0; i < class_count; ++i) {
+        REQUIRE(responses[i] == TestType(i));
+    }
+}
+
+KNN_HNSW_TEST("fills missing neighbors if neighbor count exceeds train size") {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    constexpr std::int64_t row_count = 3;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t neighbor_count = 5;
+
+    const auto x_train = this->generate_uniform(row_count, column_count, 5);
+    const auto x_table = homogen_table::wrap(x_train, row_count, column_count);
+
+    const auto knn_desc = this->get_descriptor(neighbor_count);
+    const auto train_result = this->train(knn_desc, x_table);
+    const auto infer_result = this->infer(knn_desc, x_table, train_result.get_model());
+
+    const auto indices = row_accessor<const std::int32_t>(infer_result.get_indices()).pull();
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        REQUIRE(indices[i * neighbor_count] == i);
+        REQUIRE(indices[i * neighbor_count + row_count] == -1);
+    }
+}
+
+KNN_HNSW_TEST("throws if HNSW parameters are out of range") {
+    auto knn_desc = this->get_descriptor(1);
+    REQUIRE_THROWS_AS(knn_desc.set_graph_degree(1), domain_error);
+    REQUIRE_THROWS_AS(knn_desc.set_construction_candidate_count(0), domain_error);
+    REQUIRE_THROWS_AS(knn_desc.set_search_candidate_count(0), domain_error);
+    REQUIRE_NOTHROW(knn_desc.set_graph_degree(2));
+}
+
+} // namespace oneapi::dal::knn::test
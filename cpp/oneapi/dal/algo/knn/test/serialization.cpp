@@ -38,11 +38,12 @@ public:
 
     static constexpr bool is_kd_tree = std::is_same_v<method_t, knn::method::kd_tree>;
     static constexpr bool is_brute_force = std::is_same_v<method_t, knn::method::brute_force>;
+    static constexpr bool is_hnsw = std::is_same_v<method_t, knn::method::hnsw>;
     static constexpr bool is_classification = std::is_same_v<task_t, knn::task::classification>;
     static constexpr bool is_search = std::is_same_v<task_t, knn::task::search>;
 
     bool not_available_on_device() {
-        return (this->get_policy().is_gpu() && is_kd_tree);
+        return (this->get_policy().is_gpu() && (is_kd_tree || is_hnsw));
     }
 
     void set_class_count(std::int64_t class_count) {
@@ -166,7 +167,7 @@ private:
 };
 
 using knn_types = COMBINE_TYPES((float, double),
-                                (knn::method::kd_tree, knn::method::brute_force),
+                                (knn::method::kd_tree, knn::method::brute_force, knn::method::hnsw),
                                 (knn::task::classification, knn::task::search));
 
 TEMPLATE_LIST_TEST_M(knn_serialization_test,
@@ -16,17 +16,623 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+
 #include "oneapi/dal/algo/louvain/common.hpp"
 #include "oneapi/dal/algo/louvain/vertex_partitioning_types.hpp"
 #include "oneapi/dal/backend/common.hpp"
 #include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
 
 namespace oneapi::dal::preview::louvain::backend {
 using namespace oneapi::dal::preview::detail;
 using namespace oneapi::dal::preview::backend;
 
+/// Accumulates the weights of edges from a vertex (or a set of vertices) to the
+/// neighboring communities. Open addressing hash table that keeps the list of
+/// inserted communities, so it is iterated and cleared in time proportional to the
+/// number of communities. Memory is allocated on the first insertion and grows
+/// with the number of communities.
+class community_weight_map {
+public:
+    explicit community_weight_map(byte_alloc_iface* alloc_ptr)
+            : index_allocator_(alloc_ptr),
+              position_allocator_(alloc_ptr),
+              weight_allocator_(alloc_ptr) {}
+
+    community_weight_map(const community_weight_map&) = delete;
+    community_weight_map& operator=(const community_weight_map&) = delete;
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+    std::int32_t get_community(std::int64_t index) const {
+        return communities_[index];
+    }
+
+    double get_weight(std::int64_t index) const {
+        return weights_[index];
+    }
+
+    void add(std::int32_t community, double weight) {
+        if (2 * (size_ + 1) > capacity_) {
+            grow();
+        }
+        const std::int64_t slot = find_slot(slots_, capacity_, community);
+        if (slots_[slot] < 0) {
+            slots_[slot] = static_cast<std::int32_t>(size_);
+            positions_[size_] = slot;
+            communities_[size_] = community;
+            weights_[size_] = weight;
+            ++size_;
+        }
+        else {
+            weights_[slots_[slot]] += weight;
+        }
+    }
+
+    void clear() {
+        for (std::int64_t i = 0; i < size_; ++i) {
+            slots_[positions_[i]] = -1;
+        }
+        size_ = 0;
+    }
+
+private:
+    static constexpr std::int64_t initial_capacity = 64;
+
+    std::int64_t find_slot(const std::int32_t* slots,
+                           std::int64_t capacity,
+                           std::int32_t community) const {
+        // Fibonacci hashing, the capacity is a power of two
+        const std::uint64_t hash =
+            static_cast<std::uint64_t>(static_cast<std::uint32_t>(community)) *
+            0x9E3779B97F4A7C15ull;
+        std::int64_t slot = static_cast<std::int64_t>(hash >> 32) & (capacity - 1);
+        while (slots[slot] >= 0 && communities_[slots[slot]] != community) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        return slot;
+    }
+
+    void grow() {
+        const std::int64_t capacity = capacity_ > 0 ? 2 * capacity_ : initial_capacity;
+        const std::int64_t max_size = capacity / 2;
+
+        auto slots_mem = index_allocator_.make_shared_memory(capacity);
+        auto positions_mem = position_allocator_.make_shared_memory(max_size);
+        auto communities_mem = index_allocator_.make_shared_memory(max_size);
+        auto weights_mem = weight_allocator_.make_shared_memory(max_size);
+
+        std::int32_t* slots = slots_mem.get();
+        std::fill(slots, slots + capacity, -1);
+        std::copy(communities_, communities_ + size_, communities_mem.get());
+        std::copy(weights_, weights_ + size_, weights_mem.get());
+
+        communities_ = communities_mem.get();
+        for (std::int64_t i = 0; i < size_; ++i) {
+            const std::int64_t slot = find_slot(slots, capacity, communities_[i]);
+            slots[slot] = static_cast<std::int32_t>(i);
+            positions_mem.get()[i] = slot;
+        }
+
+        slots_mem_ = slots_mem;
+        positions_mem_ = positions_mem;
+        communities_mem_ = communities_mem;
+        weights_mem_ = weights_mem;
+        slots_ = slots;
+        positions_ = positions_mem.get();
+        weights_ = weights_mem.get();
+        capacity_ = capacity;
+    }
+
+    inner_alloc<std::int32_t> index_allocator_;
+    inner_alloc<std::int64_t> position_allocator_;
+    inner_alloc<double> weight_allocator_;
+
+    dal::detail::shared<std::int32_t> slots_mem_;
+    dal::detail::shared<std::int64_t> positions_mem_;
+    dal::detail::shared<std::int32_t> communities_mem_;
+    dal::detail::shared<double> weights_mem_;
+
+    std::int32_t* slots_ = nullptr;
+    std::int64_t* positions_ = nullptr;
+    std::int32_t* communities_ = nullptr;
+    double* weights_ = nullptr;
+
+    std::int64_t capacity_ = 0;
+    std::int64_t size_ = 0;
+};
+
+/// Set of maps, one per thread
+class community_weight_maps {
+public:
+    explicit community_weight_maps(byte_alloc_iface* alloc_ptr)
+            : allocator_(alloc_ptr),
+              count_(dal::detail::threader_get_max_threads()) {
+        maps_ = allocate(allocator_, count_);
+        for (std::int64_t i = 0; i < count_; ++i) {
+            new (maps_ + i) community_weight_map(alloc_ptr);
+        }
+    }
+
+    ~community_weight_maps() {
+        for (std::int64_t i = 0; i < count_; ++i) {
+            maps_[i].~community_weight_map();
+        }
+        deallocate(allocator_, maps_, count_);
+    }
+
+    community_weight_maps(const community_weight_maps&) = delete;
+    community_weight_maps& operator=(const community_weight_maps&) = delete;
+
+    community_weight_map& local() {
+        return maps_[dal::detail::threader_get_current_thread_index()];
+    }
+
+private:
+    inner_alloc<community_weight_map> allocator_;
+    std::int64_t count_;
+    community_weight_map* maps_;
+};
+
+/// CSR view of the graph processed on the level of the algorithm. The vertex
+/// adjacency is symmetric, the self-loop is stored once. Unweighted edges have
+/// the null pointer to weights.
+template <typename Weight>
+struct graph_view {
+    std::int64_t vertex_count;
+    const std::int64_t* rows;
+    const std::int32_t* cols;
+    const Weight* vals;
+
+    double get_weight(std::int64_t edge) const {
+        return vals ? static_cast<double>(vals[edge]) : 1.0;
+    }
+};
+
+/// Graph built by aggregation of communities into vertices. Edges inside the
+/// community are aggregated into the self-loop, so the weighted degree of the
+/// vertex equals the total weight of the community.
+struct aggregated_graph {
+    std::int64_t vertex_count = 0;
+    dal::detail::shared<std::int64_t> rows;
+    dal::detail::shared<std::int32_t> cols;
+    dal::detail::shared<double> vals;
+
+    graph_view<double> get_view() const {
+        return { vertex_count, rows.get(), cols.get(), vals.get() };
+    }
+};
+
+inline void atomic_add(std::atomic<double>& target, double value) {
+    double expected = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(expected,
+                                         expected + value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+constexpr std::int64_t louvain_block_size = 1 << 12;
+
+template <typename Body>
+inline void for_each_block(std::int64_t count, const Body& body) {
+    const std::int64_t block_count = (count + louvain_block_size - 1) / louvain_block_size;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * louvain_block_size;
+        const std::int64_t end = std::min(count, begin + louvain_block_size);
+        body(begin, end);
+    });
+}
+
+/// Sums `body(begin, end)` over the blocks of [0, count). Partial sums are added in
+/// the fixed order, so the result does not depend on the scheduling of threads.
+template <typename Body>
+inline double parallel_sum(std::int64_t count, inner_alloc<double>& allocator, const Body& body) {
+    const std::int64_t block_count = (count + louvain_block_size - 1) / louvain_block_size;
+    if (block_count == 0) {
+        return 0.0;
+    }
+
+    auto partial_sums_mem = allocator.make_shared_memory(block_count);
+    double* partial_sums = partial_sums_mem.get();
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * louvain_block_size;
+        const std::int64_t end = std::min(count, begin + louvain_block_size);
+        partial_sums[block] = body(begin, end);
+    });
+
+    double sum = 0.0;
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        sum += partial_sums[block];
+    }
+    return sum;
+}
+
+template <typename Cpu>
+class louvain_solver {
+public:
+    louvain_solver(std::int64_t vertex_count,
+                   double resolution,
+                   double accuracy_threshold,
+                   std::int64_t max_iteration_count,
+                   byte_alloc_iface* alloc_ptr)
+            : resolution_(resolution),
+              accuracy_threshold_(accuracy_threshold),
+              max_iteration_count_(max_iteration_count),
+              vertex_allocator_(alloc_ptr),
+              edge_allocator_(alloc_ptr),
+              key_allocator_(alloc_ptr),
+              value_allocator_(alloc_ptr),
+              atomic_value_allocator_(alloc_ptr),
+              atomic_size_allocator_(alloc_ptr),
+              maps_(alloc_ptr) {
+        communities_mem_ = vertex_allocator_.make_shared_memory(vertex_count);
+        new_ids_mem_ = vertex_allocator_.make_shared_memory(vertex_count);
+        vertex_weights_mem_ = value_allocator_.make_shared_memory(vertex_count);
+        community_weights_mem_ = atomic_value_allocator_.make_shared_memory(vertex_count);
+        community_sizes_mem_ = atomic_size_allocator_.make_shared_memory(vertex_count);
+
+        communities_ = communities_mem_.get();
+        new_ids_ = new_ids_mem_.get();
+        vertex_weights_ = vertex_weights_mem_.get();
+        community_weights_ = community_weights_mem_.get();
+        community_sizes_ = community_sizes_mem_.get();
+    }
+
+    /// Runs the local moving phase on the graph of the current level, assigns the
+    /// community labels of the input vertices and returns true if the next level
+    /// should be processed
+    template <typename Weight>
+    bool process_level(const graph_view<Weight>& g,
+                       const std::int32_t* init_partition,
+                       std::int32_t* labels,
+                       std::int64_t label_count,
+                       bool is_first_level) {
+        const std::int64_t vertex_count = g.vertex_count;
+        const double total_weight = compute_vertex_weights(g);
+
+        if (init_partition) {
+            init_communities(vertex_count, init_partition);
+        }
+        else {
+            init_singleton_communities(vertex_count);
+        }
+
+        const double initial_modularity = compute_modularity(g, total_weight);
+        double level_modularity = initial_modularity;
+        bool is_changed = false;
+        for (std::int64_t iteration = 0; iteration < max_iteration_count_; ++iteration) {
+            if (total_weight <= 0.0 || !move_vertices(g, total_weight)) {
+                break;
+            }
+            is_changed = true;
+
+            const double modularity = compute_modularity(g, total_weight);
+            const double gain = modularity - level_modularity;
+            level_modularity = modularity;
+            if (gain < accuracy_threshold_) {
+                break;
+            }
+        }
+
+        community_count_ = renumber_communities(vertex_count);
+        modularity_ = level_modularity;
+
+        dal::detail::threader_for(label_count, label_count, [&](std::int32_t v) {
+            labels[v] = is_first_level ? communities_[v] : communities_[labels[v]];
+        });
+
+        return is_changed && community_count_ < vertex_count &&
+               level_modularity - initial_modularity >= accuracy_threshold_;
+    }
+
+    /// Builds the graph with vertices that correspond to the communities of the
+    /// current level
+    template <typename Weight>
+    aggregated_graph aggregate(const graph_view<Weight>& g) {
+        const std::int64_t vertex_count = g.vertex_count;
+        const std::int64_t community_count = community_count_;
+
+        // Sort vertices by communities to get the list of vertices of every community
+        auto keys_mem = key_allocator_.make_shared_memory(vertex_count);
+        std::uint64_t* keys = keys_mem.get();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            keys[u] = (static_cast<std::uint64_t>(communities_[u]) << 32) |
+                      static_cast<std::uint32_t>(u);
+        });
+        dal::detail::parallel_sort(keys, keys + vertex_count);
+
+        auto offsets_mem = edge_allocator_.make_shared_memory(community_count + 1);
+        std::int64_t* offsets = offsets_mem.get();
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t i) {
+            const std::uint64_t community = keys[i] >> 32;
+            if (i == 0 || (keys[i - 1] >> 32) != community) {
+                offsets[community] = i;
+            }
+        });
+        offsets[community_count] = vertex_count;
+
+        const auto accumulate_neighbors = [&](std::int64_t community, community_weight_map& map) {
+            map.clear();
+            for (std::int64_t i = offsets[community]; i < offsets[community + 1]; ++i) {
+                const std::int32_t u = static_cast<std::int32_t>(keys[i] & 0xFFFFFFFFull);
+                for (std::int64_t e = g.rows[u]; e < g.rows[u + 1]; ++e) {
+                    map.add(communities_[g.cols[e]], g.get_weight(e));
+                }
+            }
+        };
+
+        aggregated_graph result;
+        result.vertex_count = community_count;
+        result.rows = edge_allocator_.make_shared_memory(community_count + 1);
+        std::int64_t* rows = result.rows.get();
+
+        rows[0] = 0;
+        dal::detail::threader_for(community_count, community_count, [&](std::int32_t c) {
+            auto& map = maps_.local();
+            accumulate_neighbors(c, map);
+            rows[c + 1] = map.get_size();
+        });
+        for (std::int64_t c = 0; c < community_count; ++c) {
+            rows[c + 1] += rows[c];
+        }
+
+        const std::int64_t edge_count = rows[community_count];
+        result.cols = vertex_allocator_.make_shared_memory(edge_count);
+        result.vals = value_allocator_.make_shared_memory(edge_count);
+        std::int32_t* cols = result.cols.get();
+        double* vals = result.vals.get();
+
+        dal::detail::threader_for(community_count, community_count, [&](std::int32_t c) {
+            auto& map = maps_.local();
+            accumulate_neighbors(c, map);
+            for (std::int64_t i = 0; i < map.get_size(); ++i) {
+                cols[rows[c] + i] = map.get_community(i);
+                vals[rows[c] + i] = map.get_weight(i);
+            }
+        });
+
+        return result;
+    }
+
+    std::int64_t get_community_count() const {
+        return community_count_;
+    }
+
+    double get_modularity() const {
+        return modularity_;
+    }
+
+private:
+    /// Computes the weighted degrees of vertices and returns the total weight
+    /// of the graph, that is, the doubled sum of the edge weights
+    template <typename Weight>
+    double compute_vertex_weights(const graph_view<Weight>& g) {
+        return parallel_sum(g.vertex_count,
+                            value_allocator_,
+                            [&](std::int64_t begin, std::int64_t end) {
+                                double sum = 0.0;
+                                for (std::int64_t u = begin; u < end; ++u) {
+                                    double weight = 0.0;
+                                    for (std::int64_t e = g.rows[u]; e < g.rows[u + 1]; ++e) {
+                                        weight += g.get_weight(e);
+                                    }
+                                    vertex_weights_[u] = weight;
+                                    sum += weight;
+                                }
+                                return sum;
+                            });
+    }
+
+    void init_singleton_communities(std::int64_t vertex_count) {
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            communities_[u] = u;
+            community_weights_[u].store(vertex_weights_[u], std::memory_order_relaxed);
+            community_sizes_[u].store(1, std::memory_order_relaxed);
+        });
+    }
+
+    /// Assigns the vertices to the communities of the initial partition. The labels
+    /// of the partition are arbitrary, they are mapped to [0, community_count).
+    void init_communities(std::int64_t vertex_count, const std::int32_t* init_partition) {
+        std::int32_t* sorted_labels = new_ids_;
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            sorted_labels[u] = init_partition[u];
+        });
+        dal::detail::parallel_sort(sorted_labels, sorted_labels + vertex_count);
+        std::int32_t* sorted_labels_end =
+            std::unique(sorted_labels, sorted_labels + vertex_count);
+
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            communities_[u] = static_cast<std::int32_t>(
+                std::lower_bound(sorted_labels, sorted_labels_end, init_partition[u]) -
+                sorted_labels);
+            community_weights_[u].store(0.0, std::memory_order_relaxed);
+            community_sizes_[u].store(0, std::memory_order_relaxed);
+        });
+
+        // Accumulate locally to avoid contention on the atomics of large communities
+        for_each_block(vertex_count, [&](std::int64_t begin, std::int64_t end) {
+            auto& map = maps_.local();
+            map.clear();
+            for (std::int64_t u = begin; u < end; ++u) {
+                map.add(communities_[u], vertex_weights_[u]);
+            }
+            for (std::int64_t i = 0; i < map.get_size(); ++i) {
+                atomic_add(community_weights_[map.get_community(i)], map.get_weight(i));
+            }
+
+            map.clear();
+            for (std::int64_t u = begin; u < end; ++u) {
+                map.add(communities_[u], 1.0);
+            }
+            for (std::int64_t i = 0; i < map.get_size(); ++i) {
+                community_sizes_[map.get_community(i)].fetch_add(
+                    static_cast<std::int32_t>(map.get_weight(i)),
+                    std::memory_order_relaxed);
+            }
+        });
+    }
+
+    /// Moves every vertex to the neighboring community with the maximal modularity
+    /// gain. Vertices are processed in parallel and the community weights are
+    /// updated atomically right after the move, so the next vertices see the
+    /// up-to-date state. Returns true if any vertex is moved.
+    template <typename Weight>
+    bool move_vertices(const graph_view<Weight>& g, double total_weight) {
+        std::atomic<bool> is_moved = false;
+        const std::int64_t vertex_count = g.vertex_count;
+
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            const double vertex_weight = vertex_weights_[u];
+            if (vertex_weight <= 0.0) {
+                return;
+            }
+
+            auto& map = maps_.local();
+            map.clear();
+            const std::int32_t current = communities_[u];
+            double current_weight = 0.0;
+            for (std::int64_t e = g.rows[u]; e < g.rows[u + 1]; ++e) {
+                const std::int32_t v = g.cols[e];
+                if (v == u) {
+                    continue;
+                }
+                const std::int32_t community = communities_[v];
+                if (community == current) {
+                    current_weight += g.get_weight(e);
+                }
+                else {
+                    map.add(community, g.get_weight(e));
+                }
+            }
+
+            // Gain of modularity is proportional to
+            // k_u,c - resolution * k_u * tot_c / 2m
+            const double scale = resolution_ * vertex_weight / total_weight;
+            std::int32_t best = current;
+            double best_gain =
+                current_weight -
+                scale * (community_weights_[current].load(std::memory_order_relaxed) -
+                         vertex_weight);
+            for (std::int64_t i = 0; i < map.get_size(); ++i) {
+                const std::int32_t community = map.get_community(i);
+                const double gain =
+                    map.get_weight(i) -
+                    scale * community_weights_[community].load(std::memory_order_relaxed);
+                if (gain > best_gain ||
+                    (gain == best_gain && best != current && community < best)) {
+                    best = community;
+                    best_gain = gain;
+                }
+            }
+
+            if (best == current) {
+                return;
+            }
+            // Two single vertices may swap their communities at the same time,
+            // so the move between single-vertex communities goes to the lower label only
+            if (best > current &&
+                community_sizes_[current].load(std::memory_order_relaxed) == 1 &&
+                community_sizes_[best].load(std::memory_order_relaxed) == 1) {
+                return;
+            }
+
+            atomic_add(community_weights_[current], -vertex_weight);
+            atomic_add(community_weights_[best], vertex_weight);
+            community_sizes_[current].fetch_sub(1, std::memory_order_relaxed);
+            community_sizes_[best].fetch_add(1, std::memory_order_relaxed);
+            communities_[u] = best;
+            is_moved.store(true, std::memory_order_relaxed);
+        });
+
+        return is_moved.load();
+    }
+
+    template <typename Weight>
+    double compute_modularity(const graph_view<Weight>& g, double total_weight) {
+        if (total_weight <= 0.0) {
+            return 0.0;
+        }
+
+        const std::int64_t vertex_count = g.vertex_count;
+        const double internal_weight =
+            parallel_sum(vertex_count, value_allocator_, [&](std::int64_t begin, std::int64_t end) {
+                double sum = 0.0;
+                for (std::int64_t u = begin; u < end; ++u) {
+                    const std::int32_t community = communities_[u];
+                    for (std::int64_t e = g.rows[u]; e < g.rows[u + 1]; ++e) {
+                        if (communities_[g.cols[e]] == community) {
+                            sum += g.get_weight(e);
+                        }
+                    }
+                }
+                return sum;
+            });
+
+        const double squared_community_weight =
+            parallel_sum(vertex_count, value_allocator_, [&](std::int64_t begin, std::int64_t end) {
+                double sum = 0.0;
+                for (std::int64_t c = begin; c < end; ++c) {
+                    const double weight = community_weights_[c].load(std::memory_order_relaxed);
+                    sum += weight * weight;
+                }
+                return sum;
+            });
+
+        return internal_weight / total_weight -
+               resolution_ * squared_community_weight / (total_weight * total_weight);
+    }
+
+    /// Maps the labels of non-empty communities to [0, community_count)
+    std::int64_t renumber_communities(std::int64_t vertex_count) {
+        std::int64_t community_count = 0;
+        for (std::int64_t c = 0; c < vertex_count; ++c) {
+            new_ids_[c] = community_sizes_[c].load(std::memory_order_relaxed) > 0
+                              ? static_cast<std::int32_t>(community_count++)
+                              : -1;
+        }
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+            communities_[u] = new_ids_[communities_[u]];
+        });
+        return community_count;
+    }
+
+    const double resolution_;
+    const double accuracy_threshold_;
+    const std::int64_t max_iteration_count_;
+
+    inner_alloc<std::int32_t> vertex_allocator_;
+    inner_alloc<std::int64_t> edge_allocator_;
+    inner_alloc<std::uint64_t> key_allocator_;
+    inner_alloc<double> value_allocator_;
+    inner_alloc<std::atomic<double>> atomic_value_allocator_;
+    inner_alloc<std::atomic<std::int32_t>> atomic_size_allocator_;
+
+    dal::detail::shared<std::int32_t> communities_mem_;
+    dal::detail::shared<std::int32_t> new_ids_mem_;
+    dal::detail::shared<double> vertex_weights_mem_;
+    dal::detail::shared<std::atomic<double>> community_weights_mem_;
+    dal::detail::shared<std::atomic<std::int32_t>> community_sizes_mem_;
+
+    std::int32_t* communities_;
+    std::int32_t* new_ids_;
+    double* vertex_weights_;
+    std::atomic<double>* community_weights_;
+    std::atomic<std::int32_t>* community_sizes_;
+
+    community_weight_maps maps_;
+
+    std::int64_t community_count_ = 0;
+    double modularity_ = 0.0;
+};
+
 template <typename Cpu, typename EdgeValue>
 struct louvain_kernel {
     vertex_partitioning_result<task::vertex_partitioning> operator()(
@@ -35,10 +641,44 @@ struct louvain_kernel {
         const std::int32_t *init_partition,
         const EdgeValue *vals,
         byte_alloc_iface *alloc_ptr) {
-        {
-            throw unimplemented(
-                dal::detail::error_messages::louvain_algorithm_is_not_implemented());
+        const std::int64_t vertex_count = t.get_vertex_count();
+        if (vertex_count == 0) {
+            return vertex_partitioning_result<task::vertex_partitioning>();
+        }
+
+        auto labels_arr = array<std::int32_t>::empty(vertex_count);
+        std::int32_t *labels = labels_arr.get_mutable_data();
+
+        louvain_solver<Cpu> solver(vertex_count,
+                                   desc.get_resolution(),
+                                   desc.get_accuracy_threshold(),
+                                   desc.get_max_iteration_count(),
+                                   alloc_ptr);
+
+        const graph_view<EdgeValue> input_graph{ vertex_count, t._rows_ptr, t._cols_ptr, vals };
+        bool is_next_level = solver.process_level(input_graph,
+                                                  init_partition,
+                                                  labels,
+                                                  vertex_count,
+                                                  true);
+
+        aggregated_graph level_graph;
+        if (is_next_level) {
+            level_graph = solver.aggregate(input_graph);
         }
+        while (is_next_level) {
+            const auto level_view = level_graph.get_view();
+            is_next_level = solver.process_level(level_view, nullptr, labels, vertex_count, false);
+            if (is_next_level) {
+                level_graph = solver.aggregate(level_view);
+            }
+        }
+
+        return vertex_partitioning_result<task::vertex_partitioning>()
+            .set_labels(
+                dal::detail::homogen_table_builder{}.reset(labels_arr, vertex_count, 1).build())
+            .set_modularity(solver.get_modularity())
+            .set_community_count(solver.get_community_count());
     }
 };
 
@@ -134,17 +134,19 @@ public:
         return *this;
     }
 
-    /// Returns the maximum number of iterations of the Louvain algorithm
+    /// Returns the maximum number of iterations of the local moving phase
+    /// on each level of the Louvain algorithm
     ///
     /// @remark default = 10
     std::int64_t get_max_iteration_count() const {
         return base_t::get_max_iteration_count();
     }
 
-    /// Sets the maximum number of iterations of the Louvain algorithm
+    /// Sets the maximum number of iterations of the local moving phase
+    /// on each level of the Louvain algorithm
     ///
     /// @param [in] max_iteration_count  Maximum number of iterations of the
-    ///                                  Louvain algorithm
+    ///                                  local moving phase
     /// @invariant :expr:`max_iteration_count >= 0`
     /// @remark default = 10
     auto &set_max_iteration_count(std::int64_t max_iteration_count) {
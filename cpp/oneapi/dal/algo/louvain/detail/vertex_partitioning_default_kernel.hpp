@@ -19,6 +19,7 @@
 #include "oneapi/dal/algo/louvain/common.hpp"
 #include "oneapi/dal/algo/louvain/vertex_partitioning_types.hpp"
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_topology_builder.hpp"
@@ -72,18 +73,39 @@ struct vertex_partitioning_kernel_cpu<method::fast, task::vertex_partitioning, A
         using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
         using value_type = edge_user_value_type<Graph>;
         const auto &t = dal::preview::detail::csr_topology_builder<Graph>()(g);
-        const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
-        auto init_partition_arr =
-            oneapi::dal::row_accessor<const std::int32_t>(init_partition).pull();
+
+        array<std::int32_t> init_partition_arr;
+        if (init_partition.has_data()) {
+            if (init_partition.get_row_count() != t.get_vertex_count()) {
+                throw invalid_argument(
+                    dal::detail::error_messages::initial_partition_rc_neq_vertex_count());
+            }
+            init_partition_arr =
+                oneapi::dal::row_accessor<const std::int32_t>(init_partition).pull();
+        }
         const auto init_partition_data = init_partition_arr.get_data();
         alloc_connector<Allocator> alloc_con(alloc);
-        return louvain_kernel<float, task::vertex_partitioning, topology_type, value_type>{}(
-            ctx,
-            desc,
-            t,
-            init_partition_data,
-            vals,
-            &alloc_con);
+
+        if constexpr (std::is_same_v<value_type, empty_value>) {
+            // Every edge of the unweighted graph has unit weight
+            return louvain_kernel<float, task::vertex_partitioning, topology_type, std::int32_t>{}(
+                ctx,
+                desc,
+                t,
+                init_partition_data,
+                nullptr,
+                &alloc_con);
+        }
+        else {
+            const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
+            return louvain_kernel<float, task::vertex_partitioning, topology_type, value_type>{}(
+                ctx,
+                desc,
+                t,
+                init_partition_data,
+                vals,
+                &alloc_con);
+        }
     }
 };
 
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <tuple>
+#include <vector>
+
+#include "oneapi/dal/algo/louvain.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::louvain::test {
+
+namespace dal = oneapi::dal;
+
+template <typename EdgeValue>
+using edge_t = std::tuple<std::int32_t, std::int32_t, EdgeValue>;
+
+class louvain_test {
+public:
+    /// Builds the undirected graph from the list of edges, every edge is listed once
+    template <typename Graph, typename EdgeValue>
+    Graph create_graph(std::int64_t vertex_count, const std::vector<edge_t<EdgeValue>> &edges) {
+        Graph g;
+        auto &graph_impl = oneapi::dal::detail::get_impl(g);
+        auto &vertex_allocator = graph_impl._vertex_allocator;
+        auto &edge_allocator = graph_impl._edge_allocator;
+
+        const std::int64_t edge_count = edges.size();
+        const std::int64_t cols_count = edge_count * 2;
+        const std::int64_t rows_count = vertex_count + 1;
+
+        std::int32_t *degrees =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
+        std::int32_t *cols = oneapi::dal::preview::detail::allocate(vertex_allocator, cols_count);
+        std::int64_t *rows = oneapi::dal::preview::detail::allocate(edge_allocator, rows_count);
+        std::int32_t *rows_vertex =
+            oneapi::dal::preview::detail::allocate(vertex_allocator, rows_count);
+
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            degrees[u] = 0;
+        }
+        for (const auto &[u, v, w] : edges) {
+            degrees[u]++;
+            degrees[v]++;
+        }
+        rows[0] = 0;
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            rows[u + 1] = rows[u] + degrees[u];
+        }
+        for (std::int64_t i = 0; i < rows_count; ++i) {
+            rows_vertex[i] = static_cast<std::int32_t>(rows[i]);
+        }
+
+        std::vector<std::int64_t> offsets(rows, rows + vertex_count);
+        std::vector<EdgeValue> vals(cols_count);
+        for (const auto &[u, v, w] : edges) {
+            cols[offsets[u]] = v;
+            vals[offsets[u]++] = w;
+            cols[offsets[v]] = u;
+            vals[offsets[v]++] = w;
+        }
+
+        graph_impl.set_topology(vertex_count, edge_count, rows, cols, cols_count, degrees);
+        graph_impl.get_topology()._rows_vertex =
+            oneapi::dal::preview::detail::container<std::int32_t>::wrap(rows_vertex, rows_count);
+
+        if constexpr (!std::is_same_v<EdgeValue, dal::preview::empty_value>) {
+            auto &value_allocator = graph_impl._edge_user_value_allocator;
+            EdgeValue *values = oneapi::dal::preview::detail::allocate(value_allocator, cols_count);
+            for (std::int64_t i = 0; i < cols_count; ++i) {
+                values[i] = vals[i];
+            }
+            graph_impl.set_edge_values(values, cols_count);
+        }
+        return g;
+    }
+
+    /// Builds the ring of cliques of the given size connected by single edges
+    template <typename EdgeValue>
+    std::vector<edge_t<EdgeValue>> get_ring_of_cliques(std::int32_t clique_count,
+                                                       std::int32_t clique_size) {
+        EdgeValue weight{};
+        if constexpr (!std::is_same_v<EdgeValue, dal::preview::empty_value>) {
+            weight = 1;
+        }
+
+        std::vector<edge_t<EdgeValue>> edges;
+        for (std::int32_t c = 0; c < clique_count; ++c) {
+            const std::int32_t first = c * clique_size;
+            for (std::int32_t u = first; u < first + clique_size; ++u) {
+                for (std::int32_t v = u + 1; v < first + clique_size; ++v) {
+                    edges.emplace_back(u, v, weight);
+                }
+            }
+            const std::int32_t next = ((c + 1) % clique_count) * clique_size;
+            edges.emplace_back(first + clique_size - 1, next, weight);
+        }
+        return edges;
+    }
+
+    std::vector<std::int32_t> get_labels(const dal::table &labels_table) {
+        const auto labels_arr = dal::row_accessor<const std::int32_t>(labels_table).pull();
+        return std::vector<std::int32_t>(labels_arr.get_data(),
+                                         labels_arr.get_data() + labels_arr.get_count());
+    }
+
+    void check_cliques_are_communities(const std::vector<std::int32_t> &labels,
+                                       std::int32_t clique_size) {
+        for (std::size_t u = 0; u < labels.size(); ++u) {
+            REQUIRE(labels[u] == labels[u - u % clique_size]);
+        }
+    }
+};
+
+#define LOUVAIN_TEST(name) TEST_M(louvain_test, name, "[louvain]")
+
+LOUVAIN_TEST("Two cliques connected in the ring, unweighted graph") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+    using empty_t = dal::preview::empty_value;
+    const auto edges = get_ring_of_cliques<empty_t>(2, 4);
+    const auto graph = create_graph<graph_t, empty_t>(8, edges);
+
+    const auto result = dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                          graph);
+
+    const auto labels = get_labels(result.get_labels());
+    REQUIRE(labels.size() == 8);
+    REQUIRE(result.get_community_count() == 2);
+    check_cliques_are_communities(labels, 4);
+    REQUIRE(labels[0] != labels[4]);
+    // Q = 2 * (12 / 28 - (14 / 28)^2)
+    REQUIRE(result.get_modularity() == Approx(2.0 * (12.0 / 28.0 - 0.25)));
+}
+
+LOUVAIN_TEST("Ring of cliques, double edge weights") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+    const std::int32_t clique_count = 64;
+    const std::int32_t clique_size = 6;
+    const auto edges = get_ring_of_cliques<double>(clique_count, clique_size);
+    const auto graph = create_graph<graph_t, double>(clique_count * clique_size, edges);
+
+    const auto result = dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                          graph);
+
+    const auto labels = get_labels(result.get_labels());
+    check_cliques_are_communities(labels, clique_size);
+    REQUIRE(result.get_community_count() > 1);
+    REQUIRE(result.get_community_count() <= clique_count);
+    REQUIRE(result.get_modularity() > 0.8);
+}
+
+LOUVAIN_TEST("Heavy edges define communities, int32_t edge weights") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, std::int32_t>;
+    // Square 0-1-2-3 where the heavy edges 0-1 and 2-3 form communities
+    const std::vector<edge_t<std::int32_t>> edges = { { 0, 1, 10 },
+                                                      { 1, 2, 1 },
+                                                      { 2, 3, 10 },
+                                                      { 3, 0, 1 } };
+    const auto graph = create_graph<graph_t, std::int32_t>(4, edges);
+
+    const auto result = dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                          graph);
+
+    const auto labels = get_labels(result.get_labels());
+    REQUIRE(result.get_community_count() == 2);
+    REQUIRE(labels[0] == labels[1]);
+    REQUIRE(labels[2] == labels[3]);
+    REQUIRE(labels[0] != labels[2]);
+    // Q = 2 * (20 / 44 - (22 / 44)^2)
+    REQUIRE(result.get_modularity() == Approx(2.0 * (20.0 / 44.0 - 0.25)));
+}
+
+LOUVAIN_TEST("Initial partition is kept without iterations") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+    const auto edges = get_ring_of_cliques<double>(2, 4);
+    const auto graph = create_graph<graph_t, double>(8, edges);
+
+    const std::int32_t initial_labels[] = { 7, 7, 7, 7, 7, 7, 7, 7 };
+    const auto initial_partition = dal::homogen_table::wrap(initial_labels, 8, 1);
+
+    const auto louvain_desc = dal::preview::louvain::descriptor<>().set_max_iteration_count(0);
+    const auto result = dal::preview::vertex_partitioning(louvain_desc, graph, initial_partition);
+
+    const auto labels = get_labels(result.get_labels());
+    REQUIRE(result.get_community_count() == 1);
+    for (const auto label : labels) {
+        REQUIRE(label == 0);
+    }
+    REQUIRE(result.get_modularity() == Approx(0.0).margin(1e-12));
+}
+
+LOUVAIN_TEST("Initial partition is refined") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+    const auto edges = get_ring_of_cliques<double>(2, 4);
+    const auto graph = create_graph<graph_t, double>(8, edges);
+
+    // Vertices 3 and 4 are put into the wrong cliques
+    const std::int64_t initial_labels[] = { 10, 10, 10, 20, 10, 20, 20, 20 };
+    const auto initial_partition = dal::homogen_table::wrap(initial_labels, 8, 1);
+
+    const auto result = dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                          graph,
+                                                          initial_partition);
+
+    const auto labels = get_labels(result.get_labels());
+    REQUIRE(result.get_community_count() == 2);
+    check_cliques_are_communities(labels, 4);
+    REQUIRE(labels[0] != labels[4]);
+}
+
+LOUVAIN_TEST("Graph without edges") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+    const auto graph = create_graph<graph_t, double>(3, {});
+
+    const auto result = dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                          graph);
+
+    const auto labels = get_labels(result.get_labels());
+    REQUIRE(result.get_community_count() == 3);
+    REQUIRE(labels == std::vector<std::int32_t>{ 0, 1, 2 });
+    REQUIRE(result.get_modularity() == 0.0);
+}
+
+LOUVAIN_TEST("Throws if initial partition size does not match vertex count") {
+    using graph_t = dal::preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+    const auto edges = get_ring_of_cliques<double>(2, 4);
+    const auto graph = create_graph<graph_t, double>(8, edges);
+
+    const std::int32_t initial_labels[] = { 0, 1, 2 };
+    const auto initial_partition = dal::homogen_table::wrap(initial_labels, 3, 1);
+
+    REQUIRE_THROWS_AS(dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(),
+                                                        graph,
+                                                        initial_partition),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::algo::louvain::test
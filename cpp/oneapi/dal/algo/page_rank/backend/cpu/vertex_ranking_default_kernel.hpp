@@ -0,0 +1,403 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "oneapi/dal/algo/page_rank/common.hpp"
+#include "oneapi/dal/algo/page_rank/vertex_ranking_types.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::preview::page_rank::backend {
+using namespace oneapi::dal::preview::detail;
+using namespace oneapi::dal::preview::backend;
+
+constexpr std::int64_t page_rank_block_size = 1 << 12;
+
+template <typename Body>
+inline void for_each_block(std::int64_t count, const Body& body) {
+    const std::int64_t block_count = (count + page_rank_block_size - 1) / page_rank_block_size;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * page_rank_block_size;
+        const std::int64_t end = std::min(count, begin + page_rank_block_size);
+        body(begin, end);
+    });
+}
+
+/// Sums `body(block)` over the blocks. Partial sums are added in the fixed order,
+/// so the result does not depend on the scheduling of threads.
+template <typename Body>
+inline double parallel_sum(std::int64_t block_count,
+                           inner_alloc<double>& allocator,
+                           const Body& body) {
+    if (block_count == 0) {
+        return 0.0;
+    }
+
+    auto partial_sums_mem = allocator.make_shared_memory(block_count);
+    double* partial_sums = partial_sums_mem.get();
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        partial_sums[block] = body(block);
+    });
+
+    double sum = 0.0;
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        sum += partial_sums[block];
+    }
+    return sum;
+}
+
+/// Transposed adjacency of the input graph used by the pull-based iterations:
+/// the row of the vertex lists the sources of its incoming edges. Vertices are
+/// relabeled in the descending order of out-degrees, so the contributions of the
+/// most frequently read vertices share a small set of cache lines, and the
+/// incoming edges of each vertex are sorted by the source to stream through
+/// the contributions in order.
+template <typename Cpu>
+class transposed_graph {
+public:
+    explicit transposed_graph(byte_alloc_iface* alloc_ptr)
+            : vertex_allocator_(alloc_ptr),
+              edge_allocator_(alloc_ptr),
+              key_allocator_(alloc_ptr) {}
+
+    void build(const dal::preview::detail::topology<std::int32_t>& t) {
+        vertex_count_ = t.get_vertex_count();
+        edge_count_ = t._rows_ptr[vertex_count_];
+
+        new_ids_mem_ = vertex_allocator_.make_shared_memory(vertex_count_);
+        out_degrees_mem_ = vertex_allocator_.make_shared_memory(vertex_count_);
+        rows_mem_ = edge_allocator_.make_shared_memory(vertex_count_ + 1);
+        cols_mem_ = vertex_allocator_.make_shared_memory(std::max(edge_count_, std::int64_t(1)));
+
+        relabel_by_out_degree(t);
+        fill_transposed_topology(t);
+    }
+
+    std::int64_t get_vertex_count() const {
+        return vertex_count_;
+    }
+
+    std::int64_t get_edge_count() const {
+        return edge_count_;
+    }
+
+    /// Returns the new identifiers of the vertices indexed by the input identifiers
+    const std::int32_t* get_new_ids() const {
+        return new_ids_mem_.get();
+    }
+
+    /// Returns the out-degrees of the vertices indexed by the new identifiers
+    const std::int32_t* get_out_degrees() const {
+        return out_degrees_mem_.get();
+    }
+
+    const std::int64_t* get_rows() const {
+        return rows_mem_.get();
+    }
+
+    const std::int32_t* get_cols() const {
+        return cols_mem_.get();
+    }
+
+private:
+    void relabel_by_out_degree(const dal::preview::detail::topology<std::int32_t>& t) {
+        const std::int64_t* out_rows = t._rows_ptr;
+        std::int32_t* new_ids = new_ids_mem_.get();
+        std::int32_t* out_degrees = out_degrees_mem_.get();
+
+        // Key of the vertex is (max degree - degree, vertex), the ascending order of keys
+        // is the descending order of degrees with ties resolved by the input identifier
+        auto keys_mem = key_allocator_.make_shared_memory(vertex_count_);
+        std::uint64_t* keys = keys_mem.get();
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t u = begin; u < end; ++u) {
+                const std::uint64_t degree = out_rows[u + 1] - out_rows[u];
+                keys[u] = ((std::uint64_t(std::numeric_limits<std::int32_t>::max()) - degree)
+                           << 32) |
+                          std::uint64_t(u);
+            }
+        });
+        dal::detail::parallel_sort(keys, keys + vertex_count_);
+
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t n = begin; n < end; ++n) {
+                const std::int32_t u = static_cast<std::int32_t>(keys[n] & 0xFFFFFFFFull);
+                new_ids[u] = static_cast<std::int32_t>(n);
+                out_degrees[n] = static_cast<std::int32_t>(out_rows[u + 1] - out_rows[u]);
+            }
+        });
+    }
+
+    void fill_transposed_topology(const dal::preview::detail::topology<std::int32_t>& t) {
+        const std::int64_t* out_rows = t._rows_ptr;
+        const std::int32_t* out_cols = t._cols_ptr;
+        const std::int32_t* new_ids = new_ids_mem_.get();
+        std::int64_t* rows = rows_mem_.get();
+        std::int32_t* cols = cols_mem_.get();
+
+        auto counts_mem = edge_allocator_.make_shared_memory(vertex_count_ + 1);
+        std::int64_t* counts = counts_mem.get();
+        for_each_block(vertex_count_ + 1, [&](std::int64_t begin, std::int64_t end) {
+            std::fill(counts + begin, counts + end, std::int64_t(0));
+        });
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t u = begin; u < end; ++u) {
+                for (std::int64_t e = out_rows[u]; e < out_rows[u + 1]; ++e) {
+                    dal::detail::atomic_increment(counts[new_ids[out_cols[e]]]);
+                }
+            }
+        });
+
+        exclusive_scan(counts, rows);
+
+        // Counts are reused as the insertion positions of the rows
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            std::copy(rows + begin, rows + end, counts + begin);
+        });
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t u = begin; u < end; ++u) {
+                const std::int32_t source = new_ids[u];
+                for (std::int64_t e = out_rows[u]; e < out_rows[u + 1]; ++e) {
+                    const std::int64_t position =
+                        dal::detail::atomic_fetch_add(counts[new_ids[out_cols[e]]]);
+                    cols[position] = source;
+                }
+            }
+        });
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t v = begin; v < end; ++v) {
+                std::sort(cols + rows[v], cols + rows[v + 1]);
+            }
+        });
+    }
+
+    /// Writes the exclusive prefix sums of `counts[0, vertex_count)` into `offsets`,
+    /// `offsets[vertex_count]` is the total sum
+    void exclusive_scan(const std::int64_t* counts, std::int64_t* offsets) {
+        const std::int64_t block_count =
+            (vertex_count_ + page_rank_block_size - 1) / page_rank_block_size;
+        auto block_sums_mem = edge_allocator_.make_shared_memory(block_count + 1);
+        std::int64_t* block_sums = block_sums_mem.get();
+
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            std::int64_t sum = 0;
+            for (std::int64_t v = begin; v < end; ++v) {
+                sum += counts[v];
+            }
+            block_sums[begin / page_rank_block_size] = sum;
+        });
+
+        std::int64_t total = 0;
+        for (std::int64_t block = 0; block < block_count; ++block) {
+            const std::int64_t sum = block_sums[block];
+            block_sums[block] = total;
+            total += sum;
+        }
+
+        for_each_block(vertex_count_, [&](std::int64_t begin, std::int64_t end) {
+            std::int64_t offset = block_sums[begin / page_rank_block_size];
+            for (std::int64_t v = begin; v < end; ++v) {
+                offsets[v] = offset;
+                offset += counts[v];
+            }
+        });
+        offsets[vertex_count_] = total;
+    }
+
+    inner_alloc<std::int32_t> vertex_allocator_;
+    inner_alloc<std::int64_t> edge_allocator_;
+    inner_alloc<std::uint64_t> key_allocator_;
+
+    std::int64_t vertex_count_ = 0;
+    std::int64_t edge_count_ = 0;
+
+    dal::detail::shared<std::int32_t> new_ids_mem_;
+    dal::detail::shared<std::int32_t> out_degrees_mem_;
+    dal::detail::shared<std::int64_t> rows_mem_;
+    dal::detail::shared<std::int32_t> cols_mem_;
+};
+
+/// Splits the vertices of the transposed graph into the blocks with approximately
+/// equal number of vertices plus incoming edges, so the vertices with large
+/// in-degree do not serialize the iteration in one block
+template <typename Cpu>
+inline void split_by_edges(const std::int64_t* rows,
+                           std::int64_t vertex_count,
+                           std::int64_t block_count,
+                           std::int64_t* bounds) {
+    const std::int64_t total_work = rows[vertex_count] + vertex_count;
+    bounds[0] = 0;
+    for (std::int64_t block = 1; block < block_count; ++block) {
+        const std::int64_t work = total_work * block / block_count;
+        std::int64_t low = bounds[block - 1];
+        std::int64_t high = vertex_count;
+        // The first vertex v such that rows[v] + v >= work
+        while (low < high) {
+            const std::int64_t middle = low + (high - low) / 2;
+            if (rows[middle] + middle < work) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+        bounds[block] = low;
+    }
+    bounds[block_count] = vertex_count;
+}
+
+template <typename Cpu>
+struct page_rank_kernel {
+    vertex_ranking_result<task::vertex_ranking> operator()(
+        const detail::descriptor_base<task::vertex_ranking>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const std::int32_t* seeds,
+        std::int64_t seed_count,
+        byte_alloc_iface* alloc_ptr) {
+        const std::int64_t vertex_count = t.get_vertex_count();
+        if (vertex_count == 0) {
+            return vertex_ranking_result<task::vertex_ranking>();
+        }
+
+        const double damping_factor = desc.get_damping_factor();
+        const double accuracy_threshold = desc.get_accuracy_threshold();
+        const std::int64_t max_iteration_count = desc.get_max_iteration_count();
+
+        inner_alloc<double> value_allocator(alloc_ptr);
+        inner_alloc<std::int64_t> bound_allocator(alloc_ptr);
+
+        transposed_graph<Cpu> g(alloc_ptr);
+        g.build(t);
+        const std::int64_t* rows = g.get_rows();
+        const std::int32_t* cols = g.get_cols();
+        const std::int32_t* new_ids = g.get_new_ids();
+        const std::int32_t* out_degrees = g.get_out_degrees();
+
+        auto ranks_mem = value_allocator.make_shared_memory(vertex_count);
+        auto next_ranks_mem = value_allocator.make_shared_memory(vertex_count);
+        auto contributions_mem = value_allocator.make_shared_memory(vertex_count);
+        double* ranks = ranks_mem.get();
+        double* next_ranks = next_ranks_mem.get();
+        double* contributions = contributions_mem.get();
+
+        // Teleportation probabilities of the personalized PageRank, uniform over
+        // the distinct seeds. The null pointer stands for the uniform teleportation
+        // over all vertices.
+        dal::detail::shared<double> teleport_mem;
+        double* teleport = nullptr;
+        if (seed_count > 0) {
+            teleport_mem = value_allocator.make_shared_memory(vertex_count);
+            teleport = teleport_mem.get();
+            for_each_block(vertex_count, [&](std::int64_t begin, std::int64_t end) {
+                std::fill(teleport + begin, teleport + end, 0.0);
+            });
+            std::int64_t distinct_seed_count = 0;
+            for (std::int64_t i = 0; i < seed_count; ++i) {
+                double& value = teleport[new_ids[seeds[i]]];
+                distinct_seed_count += (value == 0.0);
+                value = 1.0;
+            }
+            const double seed_probability = 1.0 / distinct_seed_count;
+            for (std::int64_t i = 0; i < seed_count; ++i) {
+                teleport[new_ids[seeds[i]]] = seed_probability;
+            }
+        }
+        const double uniform_probability = 1.0 / vertex_count;
+
+        for_each_block(vertex_count, [&](std::int64_t begin, std::int64_t end) {
+            std::fill(ranks + begin, ranks + end, uniform_probability);
+        });
+
+        const std::int64_t vertex_block_count =
+            (vertex_count + page_rank_block_size - 1) / page_rank_block_size;
+        const std::int64_t edge_block_count =
+            std::min(vertex_count,
+                     (vertex_count + g.get_edge_count() + page_rank_block_size - 1) /
+                         page_rank_block_size);
+        auto bounds_mem = bound_allocator.make_shared_memory(edge_block_count + 1);
+        std::int64_t* bounds = bounds_mem.get();
+        split_by_edges<Cpu>(rows, vertex_count, edge_block_count, bounds);
+
+        std::int64_t iteration_count = 0;
+        while (iteration_count < max_iteration_count) {
+            // The rank of the vertex without outgoing edges is distributed
+            // as the teleportation
+            const double dangling_rank =
+                parallel_sum(vertex_block_count, value_allocator, [&](std::int64_t block) {
+                    const std::int64_t begin = block * page_rank_block_size;
+                    const std::int64_t end = std::min(vertex_count, begin + page_rank_block_size);
+                    double sum = 0.0;
+                    for (std::int64_t u = begin; u < end; ++u) {
+                        if (out_degrees[u] > 0) {
+                            contributions[u] = ranks[u] / out_degrees[u];
+                        }
+                        else {
+                            contributions[u] = 0.0;
+                            sum += ranks[u];
+                        }
+                    }
+                    return sum;
+                });
+            const double teleport_rank = (1.0 - damping_factor) + damping_factor * dangling_rank;
+
+            const double change =
+                parallel_sum(edge_block_count, value_allocator, [&](std::int64_t block) {
+                    double sum = 0.0;
+                    for (std::int64_t v = bounds[block]; v < bounds[block + 1]; ++v) {
+                        double pulled = 0.0;
+                        for (std::int64_t e = rows[v]; e < rows[v + 1]; ++e) {
+                            pulled += contributions[cols[e]];
+                        }
+                        const double probability = teleport ? teleport[v] : uniform_probability;
+                        const double rank = damping_factor * pulled + teleport_rank * probability;
+                        sum += std::abs(rank - ranks[v]);
+                        next_ranks[v] = rank;
+                    }
+                    return sum;
+                });
+
+            std::swap(ranks, next_ranks);
+            ++iteration_count;
+            if (change <= accuracy_threshold) {
+                break;
+            }
+        }
+
+        auto ranks_arr = array<double>::empty(vertex_count);
+        double* result_ranks = ranks_arr.get_mutable_data();
+        for_each_block(vertex_count, [&](std::int64_t begin, std::int64_t end) {
+            for (std::int64_t u = begin; u < end; ++u) {
+                result_ranks[u] = ranks[new_ids[u]];
+            }
+        });
+
+        return vertex_ranking_result<task::vertex_ranking>()
+            .set_ranks(
+                dal::detail::homogen_table_builder{}.reset(ranks_arr, vertex_count, 1).build())
+            .set_iteration_count(iteration_count);
+    }
+};
+
+} // namespace oneapi::dal::preview::page_rank::backend
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/page_rank/common.hpp"
+
+namespace oneapi::dal::preview::page_rank::detail {
+
+template <typename Task>
+class descriptor_impl : public base {
+public:
+    double damping_factor = 0.85;
+    double accuracy_threshold = 1e-6;
+    std::int64_t max_iteration_count = 100;
+};
+
+template <typename Task>
+descriptor_base<Task>::descriptor_base() : impl_(new descriptor_impl<Task>{}) {}
+
+template <typename Task>
+double descriptor_base<Task>::get_damping_factor() const {
+    return impl_->damping_factor;
+}
+
+template <typename Task>
+double descriptor_base<Task>::get_accuracy_threshold() const {
+    return impl_->accuracy_threshold;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_max_iteration_count() const {
+    return impl_->max_iteration_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_damping_factor(double damping_factor) {
+    impl_->damping_factor = damping_factor;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_accuracy_threshold(double accuracy_threshold) {
+    impl_->accuracy_threshold = accuracy_threshold;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_max_iteration_count(std::int64_t max_iteration_count) {
+    impl_->max_iteration_count = max_iteration_count;
+}
+
+template class ONEDAL_EXPORT descriptor_base<task::vertex_ranking>;
+
+} // namespace oneapi::dal::preview::page_rank::detail
@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/page_rank/detail/vertex_ranking_default_kernel.hpp"
+#include "oneapi/dal/algo/page_rank/backend/cpu/vertex_ranking_default_kernel.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::preview::page_rank::detail {
+
+template <typename Float>
+vertex_ranking_result<task::vertex_ranking>
+page_rank_kernel<Float, task::vertex_ranking, dal::preview::detail::topology<std::int32_t>>::
+operator()(const dal::detail::host_policy &policy,
+           const detail::descriptor_base<task::vertex_ranking> &desc,
+           const dal::preview::detail::topology<std::int32_t> &t,
+           const std::int32_t *seeds,
+           std::int64_t seed_count,
+           byte_alloc_iface *alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+        return backend::page_rank_kernel<decltype(cpu)>{}(desc, t, seeds, seed_count, alloc_ptr);
+    });
+}
+
+template struct ONEDAL_EXPORT
+    page_rank_kernel<float, task::vertex_ranking, dal::preview::detail::topology<std::int32_t>>;
+
+} // namespace oneapi::dal::preview::page_rank::detail
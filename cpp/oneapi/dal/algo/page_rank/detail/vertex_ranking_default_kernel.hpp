@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/page_rank/common.hpp"
+#include "oneapi/dal/algo/page_rank/vertex_ranking_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_topology_builder.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::preview::page_rank::detail {
+
+using namespace dal::preview::detail;
+
+template <typename Method, typename Task, typename Allocator, typename Graph>
+struct vertex_ranking_kernel_cpu {
+    inline vertex_ranking_result<Task> operator()(const dal::detail::host_policy &ctx,
+                                                  const detail::descriptor_base<Task> &desc,
+                                                  const Allocator &alloc,
+                                                  const Graph &g,
+                                                  const table &seeds) const;
+};
+
+template <typename Float, typename Task, typename Topology, typename... Param>
+struct page_rank_kernel {
+    vertex_ranking_result<Task> operator()(const dal::detail::host_policy &ctx,
+                                           const detail::descriptor_base<Task> &desc,
+                                           const Topology &t,
+                                           const std::int32_t *seeds,
+                                           std::int64_t seed_count,
+                                           byte_alloc_iface *alloc) const;
+};
+
+template <typename Float>
+struct page_rank_kernel<Float,
+                        task::vertex_ranking,
+                        dal::preview::detail::topology<std::int32_t>> {
+    vertex_ranking_result<task::vertex_ranking> operator()(
+        const dal::detail::host_policy &ctx,
+        const detail::descriptor_base<task::vertex_ranking> &desc,
+        const dal::preview::detail::topology<std::int32_t> &t,
+        const std::int32_t *seeds,
+        std::int64_t seed_count,
+        byte_alloc_iface *alloc) const;
+};
+
+template <typename Allocator, typename Graph>
+struct vertex_ranking_kernel_cpu<method::power_iteration,
+                                 task::vertex_ranking,
+                                 Allocator,
+                                 Graph> {
+    inline vertex_ranking_result<task::vertex_ranking> operator()(
+        const dal::detail::host_policy &ctx,
+        const detail::descriptor_base<task::vertex_ranking> &desc,
+        const Allocator &alloc,
+        const Graph &g,
+        const table &seeds) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        const auto &t = dal::preview::detail::csr_topology_builder<Graph>()(g);
+
+        array<std::int32_t> seeds_arr;
+        if (seeds.has_data()) {
+            seeds_arr = oneapi::dal::row_accessor<const std::int32_t>(seeds).pull();
+            const std::int64_t vertex_count = t.get_vertex_count();
+            for (std::int64_t i = 0; i < seeds_arr.get_count(); ++i) {
+                if (seeds_arr[i] < 0 || seeds_arr[i] >= vertex_count) {
+                    throw out_of_range(
+                        dal::detail::error_messages::
+                            vertex_index_out_of_range_expect_from_zero_to_vertex_count());
+                }
+            }
+        }
+        alloc_connector<Allocator> alloc_con(alloc);
+
+        return page_rank_kernel<float, task::vertex_ranking, topology_type>{}(
+            ctx,
+            desc,
+            t,
+            seeds_arr.get_data(),
+            seeds_arr.get_count(),
+            &alloc_con);
+    }
+};
+
+} // namespace oneapi::dal::preview::page_rank::detail
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/page_rank/common.hpp"
+#include "oneapi/dal/algo/page_rank/detail/select_kernel.hpp"
+#include "oneapi/dal/algo/page_rank/vertex_ranking_types.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_impl.hpp"
+
+namespace oneapi::dal::preview::page_rank::detail {
+
+template <typename Policy, typename Descriptor, typename Graph>
+struct vertex_ranking_ops_dispatcher {
+    using task_t = typename Descriptor::task_t;
+    vertex_ranking_result<task_t> operator()(const Policy &policy,
+                                             const Descriptor &descriptor,
+                                             vertex_ranking_input<Graph, task_t> &input) const {
+        static auto impl = get_backend<Policy, Descriptor>(descriptor, input.get_graph());
+        return (*impl)(policy, descriptor, input.get_graph(), input.get_seeds());
+    }
+};
+
+template <typename Descriptor, typename Graph>
+struct vertex_ranking_ops {
+    using float_t = typename Descriptor::float_t;
+    using task_t = typename Descriptor::task_t;
+    using method_t = typename Descriptor::method_t;
+    using allocator_t = typename Descriptor::allocator_t;
+    using graph_t = Graph;
+    using input_t = vertex_ranking_input<graph_t, task_t>;
+    using result_t = vertex_ranking_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    void check_preconditions(const Descriptor &desc, input_t &input) const {
+        using msg = dal::detail::error_messages;
+        const double damping_factor = desc.get_damping_factor();
+        if (!(damping_factor >= 0.0 && damping_factor < 1.0)) {
+            throw invalid_argument(msg::damping_factor_is_out_of_range());
+        }
+        if (!(desc.get_accuracy_threshold() >= 0.0)) {
+            throw invalid_argument(msg::accuracy_threshold_lt_zero());
+        }
+        if (desc.get_max_iteration_count() < 0) {
+            throw invalid_argument(msg::max_iteration_count_lt_zero());
+        }
+    }
+
+    template <typename Policy>
+    auto operator()(const Policy &policy, const Descriptor &desc, input_t &input) const {
+        check_preconditions(desc, input);
+        return vertex_ranking_ops_dispatcher<Policy, Descriptor, Graph>()(policy, desc, input);
+    }
+};
+
+} // namespace oneapi::dal::preview::page_rank::detail
@@ -0,0 +1,256 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/algo/page_rank.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::page_rank::test {
+
+namespace dal = oneapi::dal;
+
+using edge_t = std::pair<std::int32_t, std::int32_t>;
+using graph_t = dal::preview::directed_adjacency_vector_graph<std::int32_t, double>;
+
+/// Keeps the CSR arrays of the directed graph built from the list of edges,
+/// the graph refers to these arrays
+class csr_graph {
+public:
+    csr_graph(std::int64_t vertex_count, const std::vector<edge_t> &edges)
+            : rows_(vertex_count + 1, 0),
+              cols_(edges.size()),
+              weights_(edges.size(), 1.0) {
+        for (const auto &[u, v] : edges) {
+            rows_[u + 1]++;
+        }
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            rows_[u + 1] += rows_[u];
+        }
+        std::vector<std::int64_t> offsets(rows_.begin(), rows_.end() - 1);
+        for (const auto &[u, v] : edges) {
+            cols_[offsets[u]++] = v;
+        }
+        builder_ = std::make_unique<builder_t>(vertex_count,
+                                               static_cast<std::int64_t>(edges.size()),
+                                               rows_.data(),
+                                               cols_.data(),
+                                               weights_.data());
+    }
+
+    const graph_t &get_graph() const {
+        return builder_->get_graph();
+    }
+
+private:
+    using builder_t = dal::preview::detail::directed_adjacency_vector_graph_builder<
+        std::int32_t,
+        double,
+        dal::preview::empty_value,
+        std::int32_t,
+        std::allocator<char>>;
+
+    std::vector<std::int64_t> rows_;
+    std::vector<std::int32_t> cols_;
+    std::vector<double> weights_;
+    std::unique_ptr<builder_t> builder_;
+};
+
+class page_rank_test {
+public:
+    /// Computes the ranks with the straightforward push-based power iterations
+    std::vector<double> compute_reference(std::int64_t vertex_count,
+                                          const std::vector<edge_t> &edges,
+                                          double damping_factor,
+                                          const std::vector<std::int32_t> &seeds = {}) {
+        std::vector<double> teleport(vertex_count, seeds.empty() ? 1.0 / vertex_count : 0.0);
+        for (const auto seed : seeds) {
+            teleport[seed] = 1.0;
+        }
+        double teleport_sum = 0.0;
+        for (const auto value : teleport) {
+            teleport_sum += value;
+        }
+        for (auto &value : teleport) {
+            value /= teleport_sum;
+        }
+
+        std::vector<std::int64_t> out_degrees(vertex_count, 0);
+        for (const auto &[u, v] : edges) {
+            out_degrees[u]++;
+        }
+
+        std::vector<double> ranks(vertex_count, 1.0 / vertex_count);
+        for (std::int64_t iteration = 0; iteration < 1000; ++iteration) {
+            double dangling_rank = 0.0;
+            for (std::int64_t u = 0; u < vertex_count; ++u) {
+                if (out_degrees[u] == 0) {
+                    dangling_rank += ranks[u];
+                }
+            }
+            std::vector<double> next_ranks(vertex_count);
+            for (std::int64_t v = 0; v < vertex_count; ++v) {
+                next_ranks[v] = (1.0 - damping_factor + damping_factor * dangling_rank) *
+                                teleport[v];
+            }
+            for (const auto &[u, v] : edges) {
+                next_ranks[v] += damping_factor * ranks[u] / out_degrees[u];
+            }
+            ranks.swap(next_ranks);
+        }
+        return ranks;
+    }
+
+    std::vector<double> get_ranks(const dal::table &ranks_table) {
+        const auto ranks_arr = dal::row_accessor<const double>(ranks_table).pull();
+        return std::vector<double>(ranks_arr.get_data(),
+                                   ranks_arr.get_data() + ranks_arr.get_count());
+    }
+
+    void check_ranks(const std::vector<double> &ranks,
+                     const std::vector<double> &reference,
+                     double tolerance) {
+        REQUIRE(ranks.size() == reference.size());
+        double sum = 0.0;
+        for (std::size_t u = 0; u < ranks.size(); ++u) {
+            REQUIRE(std::abs(ranks[u] - reference[u]) <= tolerance);
+            sum += ranks[u];
+        }
+        REQUIRE(std::abs(sum - 1.0) <= 1e-9);
+    }
+
+    /// Graph with a self-loop, a duplicated edge, a vertex without outgoing edges
+    /// and a vertex without incoming edges
+    std::vector<edge_t> get_small_graph_edges() {
+        return { { 0, 1 }, { 0, 2 }, { 1, 2 }, { 2, 0 }, { 3, 2 }, { 3, 3 },
+                 { 4, 0 }, { 4, 5 }, { 4, 5 }, { 5, 6 }, { 6, 4 }, { 6, 1 } };
+    }
+
+    /// Star with edges from the leaves to the center, the relabeling moves the
+    /// center to the end of the order
+    std::vector<edge_t> get_star_edges(std::int32_t leaf_count) {
+        std::vector<edge_t> edges;
+        for (std::int32_t leaf = 1; leaf <= leaf_count; ++leaf) {
+            edges.emplace_back(leaf, 0);
+        }
+        edges.emplace_back(0, 1);
+        return edges;
+    }
+};
+
+#define PAGE_RANK_TEST(name) TEST_M(page_rank_test, name, "[page_rank]")
+
+PAGE_RANK_TEST("Small graph with dangling vertex, self-loop and duplicated edge") {
+    const auto edges = get_small_graph_edges();
+    const csr_graph g(8, edges);
+
+    const auto desc = dal::preview::page_rank::descriptor<>()
+                          .set_accuracy_threshold(1e-12)
+                          .set_max_iteration_count(1000);
+    const auto result = dal::preview::vertex_ranking(desc, g.get_graph());
+
+    REQUIRE(result.get_iteration_count() < 1000);
+    check_ranks(get_ranks(result.get_ranks()), compute_reference(8, edges, 0.85), 1e-10);
+}
+
+PAGE_RANK_TEST("Personalized PageRank with repeated seeds") {
+    const auto edges = get_small_graph_edges();
+    const csr_graph g(8, edges);
+
+    const std::int32_t seeds[] = { 4, 1, 4 };
+    const auto seeds_table = dal::homogen_table::wrap(seeds, 3, 1);
+    const auto desc = dal::preview::page_rank::descriptor<>()
+                          .set_damping_factor(0.7)
+                          .set_accuracy_threshold(1e-12)
+                          .set_max_iteration_count(1000);
+    const auto result = dal::preview::vertex_ranking(desc, g.get_graph(), seeds_table);
+
+    const auto ranks = get_ranks(result.get_ranks());
+    check_ranks(ranks, compute_reference(8, edges, 0.7, { 1, 4 }), 1e-10);
+    // Vertex 3 is not reachable from the seeds
+    REQUIRE(ranks[3] < 1e-10);
+}
+
+PAGE_RANK_TEST("Star graph") {
+    const std::int32_t leaf_count = 5000;
+    const auto edges = get_star_edges(leaf_count);
+    const csr_graph g(leaf_count + 1, edges);
+
+    const auto desc = dal::preview::page_rank::descriptor<>()
+                          .set_accuracy_threshold(1e-12)
+                          .set_max_iteration_count(1000);
+    const auto result = dal::preview::vertex_ranking(desc, g.get_graph());
+
+    REQUIRE(result.get_iteration_count() < 1000);
+    check_ranks(get_ranks(result.get_ranks()),
+                compute_reference(leaf_count + 1, edges, 0.85),
+                1e-10);
+}
+
+PAGE_RANK_TEST("Graph without edges has uniform ranks") {
+    const csr_graph g(4, {});
+
+    const auto result =
+        dal::preview::vertex_ranking(dal::preview::page_rank::descriptor<>(), g.get_graph());
+
+    check_ranks(get_ranks(result.get_ranks()), std::vector<double>(4, 0.25), 1e-15);
+    REQUIRE(result.get_iteration_count() == 1);
+}
+
+PAGE_RANK_TEST("Zero iterations return initial ranks") {
+    const auto edges = get_small_graph_edges();
+    const csr_graph g(8, edges);
+
+    const auto desc = dal::preview::page_rank::descriptor<>().set_max_iteration_count(0);
+    const auto result = dal::preview::vertex_ranking(desc, g.get_graph());
+
+    check_ranks(get_ranks(result.get_ranks()), std::vector<double>(8, 0.125), 1e-15);
+    REQUIRE(result.get_iteration_count() == 0);
+}
+
+PAGE_RANK_TEST("Bad arguments") {
+    const auto edges = get_small_graph_edges();
+    const csr_graph g(8, edges);
+    using descriptor_t = dal::preview::page_rank::descriptor<>;
+
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(descriptor_t().set_damping_factor(1.0), g.get_graph()),
+        invalid_argument);
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(descriptor_t().set_damping_factor(-0.1), g.get_graph()),
+        invalid_argument);
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(descriptor_t().set_accuracy_threshold(-1.0), g.get_graph()),
+        invalid_argument);
+    REQUIRE_THROWS_AS(
+        dal::preview::vertex_ranking(descriptor_t().set_max_iteration_count(-1), g.get_graph()),
+        invalid_argument);
+
+    const std::int32_t seeds[] = { 0, 8 };
+    REQUIRE_THROWS_AS(dal::preview::vertex_ranking(descriptor_t(),
+                                                   g.get_graph(),
+                                                   dal::homogen_table::wrap(seeds, 2, 1)),
+                      out_of_range);
+}
+
+} // namespace oneapi::dal::algo::page_rank::test
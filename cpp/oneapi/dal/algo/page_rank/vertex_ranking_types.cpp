@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/page_rank/vertex_ranking_types.hpp"
+
+namespace oneapi::dal::preview::page_rank {
+
+class detail::vertex_ranking_result_impl : public base {
+public:
+    table ranks;
+    std::int64_t iteration_count = 0;
+};
+
+using detail::vertex_ranking_result_impl;
+
+template <typename Task>
+vertex_ranking_result<Task>::vertex_ranking_result() : impl_(new vertex_ranking_result_impl()) {}
+
+template <typename Task>
+const table &vertex_ranking_result<Task>::get_ranks_impl() const {
+    return impl_->ranks;
+}
+
+template <typename Task>
+std::int64_t vertex_ranking_result<Task>::get_iteration_count_impl() const {
+    return impl_->iteration_count;
+}
+
+template <typename Task>
+void vertex_ranking_result<Task>::set_ranks_impl(const table &value) {
+    impl_->ranks = value;
+}
+
+template <typename Task>
+void vertex_ranking_result<Task>::set_iteration_count_impl(std::int64_t value) {
+    impl_->iteration_count = value;
+}
+
+template class ONEDAL_EXPORT vertex_ranking_result<task::vertex_ranking>;
+
+} // namespace oneapi::dal::preview::page_rank
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// Contains the definition of the input and output for the PageRank
+/// algorithm
+
+#pragma once
+
+#include "oneapi/dal/algo/page_rank/common.hpp"
+#include "oneapi/dal/algo/page_rank/detail/vertex_ranking_types.hpp"
+
+namespace oneapi::dal::preview::page_rank {
+
+/// Class for the description of the input parameters of the PageRank
+/// algorithm
+///
+/// @tparam Graph  Type of the input graph
+template <typename Graph, typename Task = task::by_default>
+class vertex_ranking_input : public base {
+    static_assert(detail::is_valid_task<Task>);
+
+public:
+    using task_t = Task;
+    static_assert(detail::is_valid_graph<Graph>,
+                  "Only directed_adjacency_vector_graph is supported.");
+
+    /// Constructs the algorithm input initialized with the graph
+    /// and the set of seed vertices
+    ///
+    /// @param [in]   g      The input graph
+    /// @param [in]   seeds  The table of size [seed_count x 1] with the seed vertices
+    ///                      of the personalized PageRank. If the table is empty,
+    ///                      the teleportation is uniform over all vertices.
+    vertex_ranking_input(const Graph &g, const table &seeds = table{});
+
+    /// Returns the constant reference to the input graph
+    const Graph &get_graph() const;
+
+    /// Returns the constant reference to the table with seed vertices
+    const table &get_seeds() const;
+
+    /// Sets the table with seed vertices
+    auto &set_seeds(const table &seeds);
+
+private:
+    dal::detail::pimpl<detail::vertex_ranking_input_impl<Graph, Task>> impl_;
+};
+
+/// Class for the description of the result of the PageRank algorithm
+template <typename Task = task::by_default>
+class vertex_ranking_result {
+    static_assert(detail::is_valid_task<Task>);
+
+public:
+    using task_t = Task;
+    /// Constructs the empty result
+    vertex_ranking_result();
+
+    /// Returns the table of size [vertex_count x 1] with computed ranks
+    /// for each vertex represented as double values. The ranks sum up to one.
+    const table &get_ranks() const {
+        return get_ranks_impl();
+    }
+
+    /// Returns the number of performed power iterations
+    std::int64_t get_iteration_count() const {
+        return get_iteration_count_impl();
+    }
+
+    /// Sets the table with computed ranks for each vertex
+    auto &set_ranks(const table &value) {
+        set_ranks_impl(value);
+        return *this;
+    }
+
+    /// Sets the number of performed power iterations
+    auto &set_iteration_count(std::int64_t value) {
+        set_iteration_count_impl(value);
+        return *this;
+    }
+
+private:
+    const table &get_ranks_impl() const;
+    std::int64_t get_iteration_count_impl() const;
+    void set_ranks_impl(const table &value);
+    void set_iteration_count_impl(std::int64_t value);
+    dal::detail::pimpl<detail::vertex_ranking_result_impl> impl_;
+};
+
+template <typename Graph, typename Task>
+vertex_ranking_input<Graph, Task>::vertex_ranking_input(const Graph &g, const table &seeds)
+        : impl_(new detail::vertex_ranking_input_impl<Graph, Task>(g, seeds)) {}
+
+template <typename Graph, typename Task>
+const Graph &vertex_ranking_input<Graph, Task>::get_graph() const {
+    return impl_->graph_data;
+}
+
+template <typename Graph, typename Task>
+const table &vertex_ranking_input<Graph, Task>::get_seeds() const {
+    return impl_->seeds_data;
+}
+
+template <typename Graph, typename Task>
+auto &vertex_ranking_input<Graph, Task>::set_seeds(const table &seeds) {
+    impl_->seeds_data = seeds;
+    return *this;
+}
+
+} // namespace oneapi::dal::preview::page_rank
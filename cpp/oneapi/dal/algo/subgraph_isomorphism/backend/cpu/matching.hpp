@@ -29,6 +29,39 @@ namespace oneapi::dal::preview::subgraph_isomorphism::backend {
 template <typename Cpu>
 class engine_bundle;
 
+/// Passes the found matches to the user callback instead of storing them
+template <typename Cpu>
+class match_stream {
+public:
+    match_stream(const match_callback& callback, std::int64_t max_match_count)
+            : callback_(callback),
+              max_match_count_(max_match_count) {}
+
+    /// Returns the number of matches passed to the callback
+    std::int64_t get_match_count() {
+        const std::int64_t count = dal::detail::atomic_load(match_count_);
+        return (max_match_count_ > 0) ? std::min(count, max_match_count_) : count;
+    }
+
+    /// Reserves the place for a new match. Returns false if max_match_count is reached
+    bool try_reserve() {
+        if (max_match_count_ > 0) {
+            return dal::detail::atomic_fetch_add(match_count_) < max_match_count_;
+        }
+        dal::detail::atomic_increment(match_count_);
+        return true;
+    }
+
+    void emit(std::int64_t pattern_vertex_count, const std::int64_t* vertex_match) const {
+        callback_(pattern_vertex_count, vertex_match);
+    }
+
+private:
+    const match_callback& callback_;
+    std::int64_t max_match_count_;
+    std::int64_t match_count_ = 0;
+};
+
 template <typename Cpu>
 class matching_engine {
 public:
@@ -46,10 +79,12 @@ public:
     virtual ~matching_engine();
 
     void run_and_wait(global_stack<Cpu>& gstack,
+                      std::int64_t engine_count,
                       std::int64_t& busy_engine_count,
                       std::int64_t& current_match_count,
                       std::int64_t target_match_count,
                       bool main_engine);
+    void set_match_stream(match_stream<Cpu>* stream);
     solution<Cpu> get_solution();
     std::int64_t get_match_count() const;
 
@@ -86,9 +121,13 @@ public:
     dfs_stack<Cpu> hlocal_stack;
     solution<Cpu> engine_solutions;
 
+    match_stream<Cpu>* stream = nullptr;
+    std::int64_t* stream_buffer = nullptr;
+
     kind isomorphism_kind;
 
     std::int64_t extract_candidates(bool check_solution);
+    bool emit_match(std::int64_t candidate);
     bool check_vertex_candidate(bool check_solution, std::int64_t candidate);
     void set_not_busy(bool& is_busy_engine, std::int64_t& busy_engine_count);
 };
@@ -107,7 +146,7 @@ public:
                   kind isomorphism_kind,
                   inner_alloc alloc);
     virtual ~engine_bundle();
-    solution<Cpu> run(std::int64_t max_match_count);
+    solution<Cpu> run(std::int64_t max_match_count, match_stream<Cpu>* stream = nullptr);
 
     inner_alloc allocator;
     const graph<Cpu>* pattern;
@@ -136,6 +175,12 @@ matching_engine<Cpu>::~matching_engine() {
     allocator.deallocate(temporary_list, temporary_list_size);
     temporary_list = nullptr;
     temporary_list_size = 0;
+
+    if (stream_buffer != nullptr) {
+        allocator.deallocate(stream_buffer, 2 * solution_length);
+        stream_buffer = nullptr;
+    }
+    stream = nullptr;
 }
 
 template <typename Cpu>
@@ -267,6 +312,9 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     std::uint64_t solution_length_unsigned = solution_length;
     if (match_vertex(sorted_pattern_vertex[hlocal_stack.get_current_level()], candidate)) {
         if (check_solution && hlocal_stack.get_current_level() + 1 == solution_length_unsigned) {
+            if (stream != nullptr) {
+                return emit_match(candidate);
+            }
             std::int64_t* solution_core = allocator.allocate<std::int64_t>(solution_length);
             if (solution_core != nullptr) {
                 hlocal_stack.fill_solution(solution_core, candidate);
@@ -281,6 +329,30 @@ bool matching_engine<Cpu>::check_vertex_candidate(bool check_solution, std::int6
     return false;
 }
 
+template <typename Cpu>
+bool matching_engine<Cpu>::emit_match(std::int64_t candidate) {
+    if (!stream->try_reserve()) {
+        return false;
+    }
+    // The solution core is in the sorted pattern order, the callback expects the original one
+    std::int64_t* const solution_core = stream_buffer;
+    std::int64_t* const vertex_match = stream_buffer + solution_length;
+    hlocal_stack.fill_solution(solution_core, candidate);
+    for (std::int64_t i = 0; i < solution_length; ++i) {
+        vertex_match[sorted_pattern_vertex[i]] = solution_core[i];
+    }
+    stream->emit(solution_length, vertex_match);
+    return true;
+}
+
+template <typename Cpu>
+void matching_engine<Cpu>::set_match_stream(match_stream<Cpu>* match_stream_ptr) {
+    stream = match_stream_ptr;
+    if (stream != nullptr && stream_buffer == nullptr) {
+        stream_buffer = allocator.allocate<std::int64_t>(2 * solution_length);
+    }
+}
+
 template <typename Cpu>
 std::int64_t matching_engine<Cpu>::state_exploration_list(bool check_solution) {
     std::uint64_t current_level_index = hlocal_stack.get_current_level_index();
@@ -393,6 +465,7 @@ void matching_engine<Cpu>::set_not_busy(bool& is_busy_engine, std::int64_t& busy
 
 template <typename Cpu>
 void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
+                                        std::int64_t engine_count,
                                         std::int64_t& busy_engine_count,
                                         std::int64_t& cumulative_match_count,
                                         std::int64_t target_match_count,
@@ -410,7 +483,11 @@ void matching_engine<Cpu>::run_and_wait(global_stack<Cpu>& gstack,
             break;
         }
         if (hlocal_stack.states_in_stack() > 0) {
-            while ((hlocal_stack.states_in_stack() > 5) && gstack.push(hlocal_stack))
+            // Donate unexplored states only while there are idle engines waiting for work
+            while (hlocal_stack.states_in_stack() > 1 &&
+                   gstack.get_state_count() <
+                       engine_count - dal::detail::atomic_load(busy_engine_count) &&
+                   gstack.push(hlocal_stack))
                 ;
             ONEDAL_ASSERT(hlocal_stack.states_in_stack() > 0);
             const auto delta = state_exploration();
@@ -505,7 +582,8 @@ solution<Cpu> engine_bundle<Cpu>::combine_solutions(matching_engine<Cpu>* engine
 }
 
 template <typename Cpu>
-solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
+solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count,
+                                      match_stream<Cpu>* stream) {
     std::int64_t degree = pattern->get_vertex_degree(sorted_pattern_vertex[0]);
 
     std::uint64_t first_states_count =
@@ -538,6 +616,7 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
                                                     pconsistent_conditions,
                                                     isomorphism_kind,
                                                     allocator);
+        engine_array[i].set_match_stream(stream);
     }
 
     state<Cpu> null_state(allocator);
@@ -561,6 +640,7 @@ solution<Cpu> engine_bundle<Cpu>::run(std::int64_t max_match_count) {
     std::int64_t cumulative_match_count(0);
     dal::detail::threader_for(array_size, array_size, [&](const int index) {
         engine_array[index].run_and_wait(gstack,
+                                         array_size,
                                          busy_engine_count,
                                          cumulative_match_count,
                                          max_match_count,
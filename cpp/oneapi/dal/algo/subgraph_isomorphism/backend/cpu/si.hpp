@@ -31,6 +31,7 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                               const graph<Cpu>& target,
                               kind isomorphism_kind,
                               std::int64_t max_match_count,
+                              match_stream<Cpu>* stream,
                               byte_alloc_iface_t* alloc_ptr) {
     inner_alloc local_allocator(alloc_ptr);
 
@@ -72,7 +73,7 @@ oneapi::dal::homogen_table si(const graph<Cpu>& pattern,
                                pattern_vertex_probability.get(),
                                isomorphism_kind,
                                local_allocator);
-    const solution<Cpu> results = harness.run(max_match_count);
+    const solution<Cpu> results = harness.run(max_match_count, stream);
 
     for (std::int64_t i = 0; i < (pattern_vetrex_count - 1); i++) {
         cconditions_array[i].~sconsistent_conditions();
@@ -86,6 +87,7 @@ template <typename Cpu>
 subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
     const kind& si_kind,
     std::int64_t max_match_count,
+    const match_callback& callback,
     byte_alloc_iface_t* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -101,10 +103,15 @@ subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel(
         pattern.set_vertex_attribute(p_data._vertex_count, vv_p);
     }
 
+    // Matches are passed to the callback instead of being stored if it is set
+    match_stream<Cpu> stream(callback, max_match_count);
+    match_stream<Cpu>* const stream_ptr = callback ? &stream : nullptr;
+
     const oneapi::dal::homogen_table results =
-        si<Cpu>(pattern, target, si_kind, max_match_count, alloc_ptr);
+        si<Cpu>(pattern, target, si_kind, max_match_count, stream_ptr, alloc_ptr);
 
-    const auto solution_count = results.get_row_count();
+    const auto solution_count =
+        (stream_ptr != nullptr) ? stream.get_match_count() : results.get_row_count();
     return graph_matching_result<task::compute>().set_vertex_match(results).set_match_count(
         (max_match_count == 0) ? solution_count : std::min(solution_count, max_match_count));
 }
@@ -22,11 +22,13 @@ template oneapi::dal::homogen_table si<__CPU_TAG__>(const graph<__CPU_TAG__>& pa
                                                     const graph<__CPU_TAG__>& target,
                                                     kind isomorphism_kind,
                                                     std::int64_t max_match_count,
+                                                    match_stream<__CPU_TAG__>* stream,
                                                     byte_alloc_iface_t* alloc_ptr);
 
 template subgraph_isomorphism::graph_matching_result<task::compute> si_call_kernel<__CPU_TAG__>(
     const kind& si_kind,
     std::int64_t max_match_count,
+    const match_callback& callback,
     byte_alloc_iface_t* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -103,6 +103,11 @@ public:
     bool push(dfs_stack<Cpu>& s);
     void pop(dfs_stack<Cpu>& s);
 
+    /// Returns the number of donated states which are not taken by any engine yet
+    std::int64_t get_state_count() {
+        return dal::detail::atomic_load(state_count_);
+    }
+
 private:
     void internal_push(dfs_stack<Cpu>& s, std::uint64_t level);
     void clear();
@@ -126,6 +131,7 @@ private:
     std::uint64_t* bottom_{ nullptr };
     std::uint64_t* top_{ nullptr };
     std::int64_t capacity_{ 0 };
+    std::int64_t state_count_{ 0 };
 };
 
 template <typename Cpu>
@@ -399,24 +405,24 @@ void vertex_stack<Cpu>::increase_stack_size() {
 
 template <typename Cpu>
 bool global_stack<Cpu>::push(dfs_stack<Cpu>& s) {
-    for (auto level = s.get_current_level_index(); level > 0; --level) {
+    // Donate the shallowest unexplored state: it roots the largest search subtree
+    const auto current_level = s.get_current_level_index();
+    for (std::uint64_t level = 0; level <= current_level; ++level) {
         if (s.data_by_levels[level].size() > 1) {
             internal_push(s, level);
             return true;
         }
     }
 
-    if (s.data_by_levels[0].size() > 1) {
-        internal_push(s, 0);
-        return true;
-    }
-
     return false;
 }
 
 template <typename Cpu>
 void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
     ONEDAL_ASSERT(s.empty());
+    if (get_state_count() == 0) {
+        return;
+    }
     const dal::detail::scoped_lock lock(mutex_);
     if (!empty()) {
         // const auto& v = data_.top();
@@ -430,6 +436,7 @@ void global_stack<Cpu>::pop(dfs_stack<Cpu>& s) {
             }
         }
         top_ = v;
+        dal::detail::atomic_decrement(state_count_);
     }
 }
 
@@ -472,6 +479,7 @@ void global_stack<Cpu>::internal_push(dfs_stack<Cpu>& s, std::uint64_t level) {
         for (; j < static_cast<std::uint64_t>(vertex_count_); ++j) {
             *(top_++) = null_vertex();
         }
+        dal::detail::atomic_increment(state_count_);
 
         allocator.deallocate(v, level + 1);
     }
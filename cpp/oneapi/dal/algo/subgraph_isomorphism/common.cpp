@@ -24,6 +24,7 @@ public:
     bool semantic_match = false;
     std::int64_t max_match_count = 0;
     kind _kind = kind::induced;
+    match_callback callback;
 };
 
 template <typename Task>
@@ -44,6 +45,11 @@ std::int64_t descriptor_base<Task>::get_max_match_count() const {
     return impl_->max_match_count;
 }
 
+template <typename Task>
+const match_callback& descriptor_base<Task>::get_match_callback() const {
+    return impl_->callback;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_kind(kind kind) {
     impl_->_kind = kind;
@@ -59,6 +65,11 @@ void descriptor_base<Task>::set_max_match_count(std::int64_t max_match_count) {
     impl_->max_match_count = max_match_count;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_match_callback(const match_callback& callback) {
+    impl_->callback = callback;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::compute>;
 
 } // namespace oneapi::dal::preview::subgraph_isomorphism::detail
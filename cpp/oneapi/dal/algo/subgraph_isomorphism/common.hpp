@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #pragma once
+#include <functional>
+
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/table/common.hpp"
@@ -33,6 +35,14 @@ using by_default = fast;
 
 enum class kind { induced, non_induced };
 
+/// The function which is called for each match as soon as it is found.
+/// The first argument is the number of pattern vertices, the second one is the array
+/// of target vertices matched to the pattern vertices `0, ..., pattern_vertex_count - 1`.
+/// The array is valid only during the call. The function can be called concurrently
+/// from several threads and shall not throw exceptions.
+using match_callback =
+    std::function<void(std::int64_t pattern_vertex_count, const std::int64_t* vertex_match)>;
+
 namespace detail {
 struct descriptor_tag {};
 
@@ -68,10 +78,14 @@ public:
     /// Returns the maximum number of matches to search
     auto get_max_match_count() const -> std::int64_t;
 
+    /// Returns the function which is called for each found match
+    auto get_match_callback() const -> const match_callback&;
+
 protected:
     void set_kind(kind value);
     void set_semantic_match(bool semantic_match);
     void set_max_match_count(std::int64_t max_match_count);
+    void set_match_callback(const match_callback& callback);
 
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
 };
@@ -141,6 +155,21 @@ public:
         return *this;
     }
 
+    /// Returns the function which is called for each found match
+    const match_callback& get_match_callback() const {
+        return base_t::get_match_callback();
+    }
+
+    /// Sets the function which is called for each match as soon as it is found.
+    /// If the function is set, the matches are not stored in the result and
+    /// the vertex match table is empty, only the match count is returned.
+    ///
+    /// @param [in] callback  The function which is called for each found match
+    auto& set_match_callback(const match_callback& callback) {
+        base_t::set_match_callback(callback);
+        return *this;
+    }
+
     Allocator get_allocator() const {
         return alloc_;
     }
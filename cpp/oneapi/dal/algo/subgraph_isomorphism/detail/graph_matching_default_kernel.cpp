@@ -25,6 +25,7 @@ ONEDAL_EXPORT subgraph_isomorphism::graph_matching_result<task::compute> call_ke
     const dal::detail::host_policy& policy,
     const kind& si_kind,
     std::int64_t max_match_count,
+    const match_callback& callback,
     byte_alloc_iface_t* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -33,6 +34,7 @@ ONEDAL_EXPORT subgraph_isomorphism::graph_matching_result<task::compute> call_ke
     return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
         return backend::si_call_kernel<decltype(cpu)>(si_kind,
                                                       max_match_count,
+                                                      callback,
                                                       alloc_ptr,
                                                       t_data,
                                                       p_data,
@@ -35,6 +35,7 @@ subgraph_isomorphism::graph_matching_result<Task> call_kernel(
     const dal::detail::host_policy& ctx,
     const kind& desc,
     std::int64_t max_match_count,
+    const match_callback& callback,
     byte_alloc_iface_t* alloc_ptr,
     const dal::preview::detail::topology<std::int32_t>& t_data,
     const dal::preview::detail::topology<std::int32_t>& p_data,
@@ -85,6 +86,7 @@ struct call_subgraph_isomorphism_kernel_cpu {
         auto result = call_kernel<task::compute>(ctx,
                                                  desc.get_kind(),
                                                  desc.get_max_match_count(),
+                                                 desc.get_match_callback(),
                                                  alloc_ptr,
                                                  t_data,
                                                  p_data,
@@ -118,6 +120,7 @@ struct call_subgraph_isomorphism_kernel_cpu<Allocator,
         auto result = call_kernel<task::compute>(ctx,
                                                  desc.get_kind(),
                                                  desc.get_max_match_count(),
+                                                 desc.get_match_callback(),
                                                  alloc_ptr,
                                                  t_data,
                                                  p_data);
@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <initializer_list>
+#include <mutex>
+#include <set>
 
 #include "oneapi/dal/algo/subgraph_isomorphism/graph_matching.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
@@ -1873,6 +1875,50 @@ public:
             kind == isomorphism_kind::induced,
             is_vertex_labeled));
     }
+
+    template <typename TargetGraphType, typename PatternGraphType>
+    void check_subgraph_isomorphism_with_callback(isomorphism_kind kind,
+                                                  std::int64_t max_match_count,
+                                                  std::int64_t expected_match_count) {
+        const auto target_graph = create_graph<TargetGraphType>();
+        const auto pattern_graph = create_graph<PatternGraphType>();
+
+        std::mutex matches_mutex;
+        std::vector<std::vector<std::int32_t>> matches;
+        const auto callback = [&](std::int64_t pattern_vertex_count,
+                                  const std::int64_t *vertex_match) {
+            std::vector<std::int32_t> permutation(vertex_match,
+                                                  vertex_match + pattern_vertex_count);
+            std::lock_guard<std::mutex> lock(matches_mutex);
+            matches.push_back(std::move(permutation));
+        };
+
+        const auto subgraph_isomorphism_desc =
+            dal::preview::subgraph_isomorphism::descriptor<>()
+                .set_kind(kind)
+                .set_max_match_count(max_match_count)
+                .set_match_callback(callback);
+
+        const auto result =
+            dal::preview::graph_matching(subgraph_isomorphism_desc, target_graph, pattern_graph);
+        REQUIRE(expected_match_count == result.get_match_count());
+        REQUIRE(expected_match_count == static_cast<std::int64_t>(matches.size()));
+        REQUIRE(!result.get_vertex_match().has_data());
+
+        std::vector<std::pair<std::int32_t, std::int32_t>> target_edgelist =
+            build_edgelist<TargetGraphType>();
+        std::vector<std::pair<std::int32_t, std::int32_t>> pattern_edgelist =
+            build_edgelist<PatternGraphType>();
+        std::sort(pattern_edgelist.begin(), pattern_edgelist.end());
+        for (const auto &permutation : matches) {
+            REQUIRE(check_isomorphism(permutation,
+                                      target_edgelist,
+                                      pattern_edgelist,
+                                      kind == isomorphism_kind::induced));
+        }
+        const std::set<std::vector<std::int32_t>> unique_matches(matches.begin(), matches.end());
+        REQUIRE(unique_matches.size() == matches.size());
+    }
 };
 
 #define SUBGRAPH_ISOMORPHISM_INDUCED_TEST(name) \
@@ -2448,6 +2494,41 @@ SUBGRAPH_ISOMORPHISM_NON_INDUCED_TEST(
                                                                   true);
 }
 
+#define SUBGRAPH_ISOMORPHISM_CALLBACK_TEST(name) \
+    TEST_M(subgraph_isomorphism_test, name, "[subgraph_isomorphism][callback]")
+
+SUBGRAPH_ISOMORPHISM_CALLBACK_TEST("Match callback, all matches are streamed") {
+    this->check_subgraph_isomorphism_with_callback<double_triangle_target_type,
+                                                   double_triangle_pattern_type>(
+        isomorphism_kind::induced,
+        0,
+        12);
+    this->check_subgraph_isomorphism_with_callback<connected_4_cycle_80_type,
+                                                   connected_3_cycle_80_type>(
+        isomorphism_kind::induced,
+        0,
+        192);
+    this->check_subgraph_isomorphism_with_callback<cycle_100_type, path_10_type>(
+        isomorphism_kind::induced,
+        0,
+        200);
+}
+
+SUBGRAPH_ISOMORPHISM_CALLBACK_TEST("Match callback, max_match_count <= total number of SI") {
+    this->check_subgraph_isomorphism_with_callback<difficult_graph_type,
+                                                   triangles_edge_link_type>(
+        isomorphism_kind::induced,
+        50,
+        50);
+}
+
+SUBGRAPH_ISOMORPHISM_CALLBACK_TEST("Match callback, no matches") {
+    this->check_subgraph_isomorphism_with_callback<k_6_type, k_5_without_edge_type>(
+        isomorphism_kind::induced,
+        0,
+        0);
+}
+
 SUBGRAPH_ISOMORPHISM_ALLOCATOR_TEST("Custom allocator, positive case") {
     this->check_subgraph_isomorphism<lolipop_5_100_type, paths_1_2_5_type>(
         false,
@@ -19,6 +19,7 @@
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 
 #include "oneapi/dal/algo/svm/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/svm/backend/cpu/infer_primal.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
 #include "oneapi/dal/algo/svm/backend/model_conversion.hpp"
 
@@ -113,29 +114,41 @@ static infer_result<Task> call_binary_daal_kernel(const context_cpu& ctx,
     const std::int64_t row_count = data.get_row_count();
     auto arr_response = array<Float>::empty(row_count * 1);
 
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
-    const auto daal_support_vectors =
-        interop::convert_to_daal_table<Float>(trained_model.get_support_vectors());
-    const auto daal_coeffs = interop::convert_to_daal_table<Float>(trained_model.get_coeffs());
-
     const auto biases = trained_model.get_biases();
     const auto biases_acc = row_accessor<const Float>{ biases }.pull();
     const double bias = biases_acc[0];
-    auto daal_model = daal_model_builder{}
-                          .set_support_vectors(daal_support_vectors)
-                          .set_coeffs(daal_coeffs)
-                          .set_bias(bias);
-
-    auto arr_decision_function = array<Float>::empty(row_count * 1);
-    const auto daal_decision_function =
-        interop::convert_to_daal_homogen_table(arr_decision_function, row_count, 1);
 
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_svm_predict_kernel_t>(ctx,
-                                                                    daal_data,
-                                                                    &daal_model,
-                                                                    *daal_decision_function,
-                                                                    &daal_parameter));
+    array<Float> arr_decision_function;
+    const auto primal_kernel_params = get_primal_kernel_params(desc, trained_model, data);
+    if (primal_kernel_params) {
+        arr_decision_function = infer_by_primal_weights<Float>(ctx,
+                                                               *primal_kernel_params,
+                                                               trained_model,
+                                                               data,
+                                                               bias);
+    }
+    else {
+        arr_decision_function = array<Float>::empty(row_count * 1);
+        const auto daal_data = interop::convert_to_daal_table<Float>(data);
+        const auto daal_support_vectors =
+            interop::convert_to_daal_table<Float>(trained_model.get_support_vectors());
+        const auto daal_coeffs = interop::convert_to_daal_table<Float>(trained_model.get_coeffs());
+
+        auto daal_model = daal_model_builder{}
+                              .set_support_vectors(daal_support_vectors)
+                              .set_coeffs(daal_coeffs)
+                              .set_bias(bias);
+
+        const auto daal_decision_function =
+            interop::convert_to_daal_homogen_table(arr_decision_function, row_count, 1);
+
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_svm_predict_kernel_t>(ctx,
+                                                                        daal_data,
+                                                                        &daal_model,
+                                                                        *daal_decision_function,
+                                                                        &daal_parameter));
+    }
 
     auto response_data = arr_response.get_mutable_data();
     for (std::int64_t i = 0; i < row_count; ++i) {
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/src/externals/service_blas.h>
+
+#include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/algo/svm/backend/model_conversion.hpp"
+#include "oneapi/dal/algo/svm/backend/model_impl.hpp"
+#include "oneapi/dal/algo/svm/backend/primal_weights.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::svm::backend {
+
+/// Computes the decision function scale * X w + (shift * sum_i coeff_i + bias)
+/// with a single GEMV instead of evaluating the kernel against all support vectors
+template <typename Float, typename Task>
+inline array<Float> infer_by_primal_weights(const dal::backend::context_cpu& ctx,
+                                            const detail::linear_kernel_params& kernel_params,
+                                            const model<Task>& trained_model,
+                                            const table& data,
+                                            double bias) {
+    using daal_int_t = DAAL_INT;
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    const auto arr_coeffs = row_accessor<const Float>{ trained_model.get_coeffs() }.pull();
+    double coeff_sum = 0.0;
+    for (std::int64_t i = 0; i < arr_coeffs.get_count(); ++i) {
+        coeff_sum += arr_coeffs[i];
+    }
+    const Float intercept = static_cast<Float>(kernel_params.shift * coeff_sum + bias);
+
+    // The weights are not serialized and are not set for the models built from the support
+    // vectors, so they are computed here. This costs as much as the kernel function evaluation
+    // for a single row and leaves the model, which may be shared by other threads, unchanged.
+    const table& cached_weights = dal::detail::get_impl(trained_model).primal_weights;
+    const table primal_weights =
+        cached_weights.has_data()
+            ? cached_weights
+            : compute_primal_weights<Float>(trained_model.get_support_vectors(),
+                                            trained_model.get_coeffs());
+    const auto arr_weights = row_accessor<const Float>{ primal_weights }.pull();
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    auto arr_decision_function = array<Float>::full(row_count, intercept);
+
+    const char trans = 'T';
+    const daal_int_t m = dal::detail::integral_cast<daal_int_t>(column_count);
+    const daal_int_t n = dal::detail::integral_cast<daal_int_t>(row_count);
+    const daal_int_t inc = 1;
+    const Float alpha = static_cast<Float>(kernel_params.scale);
+    const Float beta = 1.0;
+    Float* decision_function_data = arr_decision_function.get_mutable_data();
+
+    dal::backend::dispatch_by_cpu(ctx, [&](auto cpu) {
+        constexpr auto daal_cpu = dal::backend::interop::to_daal_cpu_type<decltype(cpu)>::value;
+        daal::internal::Blas<Float, daal_cpu>::xgemv(&trans,
+                                                     &m,
+                                                     &n,
+                                                     &alpha,
+                                                     arr_data.get_data(),
+                                                     &m,
+                                                     arr_weights.get_data(),
+                                                     &inc,
+                                                     &beta,
+                                                     decision_function_data,
+                                                     &inc);
+    });
+
+    return arr_decision_function;
+}
+
+} // namespace oneapi::dal::svm::backend
@@ -17,6 +17,7 @@
 #include <daal/src/algorithms/svm/svm_predict_kernel.h>
 
 #include "oneapi/dal/algo/svm/backend/cpu/infer_kernel.hpp"
+#include "oneapi/dal/algo/svm/backend/cpu/infer_primal.hpp"
 #include "oneapi/dal/algo/svm/backend/model_interop.hpp"
 #include "oneapi/dal/algo/svm/backend/model_conversion.hpp"
 #include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
@@ -45,39 +46,50 @@ static infer_result<Task> call_daal_kernel(const context_cpu& ctx,
                                            const table& data) {
     const std::int64_t row_count = data.get_row_count();
 
-    const auto daal_data = interop::convert_to_daal_table<Float>(data);
-    const auto daal_support_vectors =
-        interop::convert_to_daal_table<Float>(trained_model.get_support_vectors());
-    const auto daal_coeffs = interop::convert_to_daal_table<Float>(trained_model.get_coeffs());
-
     const auto biases = trained_model.get_biases();
     const auto biases_acc = row_accessor<const Float>{ biases }.pull();
     const double bias = biases_acc[0];
 
-    auto daal_model = daal_model_builder{}
-                          .set_support_vectors(daal_support_vectors)
-                          .set_coeffs(daal_coeffs)
-                          .set_bias(bias);
-
-    auto kernel_impl = detail::get_kernel_function_impl(desc);
-    if (!kernel_impl) {
-        throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
+    array<Float> arr_decision_function;
+    const auto primal_kernel_params = get_primal_kernel_params(desc, trained_model, data);
+    if (primal_kernel_params) {
+        arr_decision_function = infer_by_primal_weights<Float>(ctx,
+                                                               *primal_kernel_params,
+                                                               trained_model,
+                                                               data,
+                                                               bias);
+    }
+    else {
+        const auto daal_data = interop::convert_to_daal_table<Float>(data);
+        const auto daal_support_vectors =
+            interop::convert_to_daal_table<Float>(trained_model.get_support_vectors());
+        const auto daal_coeffs = interop::convert_to_daal_table<Float>(trained_model.get_coeffs());
+
+        auto daal_model = daal_model_builder{}
+                              .set_support_vectors(daal_support_vectors)
+                              .set_coeffs(daal_coeffs)
+                              .set_bias(bias);
+
+        auto kernel_impl = detail::get_kernel_function_impl(desc);
+        if (!kernel_impl) {
+            throw internal_error{ dal::detail::error_messages::unknown_kernel_function_type() };
+        }
+        const bool is_dense{ data.get_kind() != dal::detail::csr_table::kind() };
+        const auto daal_kernel = kernel_impl->get_daal_kernel_function(is_dense);
+
+        daal_svm::Parameter daal_parameter(daal_kernel);
+
+        arr_decision_function = array<Float>::empty(row_count * 1);
+        const auto daal_decision_function =
+            interop::convert_to_daal_homogen_table(arr_decision_function, row_count, 1);
+
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_svm_predict_kernel_t>(ctx,
+                                                                        daal_data,
+                                                                        &daal_model,
+                                                                        *daal_decision_function,
+                                                                        &daal_parameter));
     }
-    const bool is_dense{ data.get_kind() != dal::detail::csr_table::kind() };
-    const auto daal_kernel = kernel_impl->get_daal_kernel_function(is_dense);
-
-    daal_svm::Parameter daal_parameter(daal_kernel);
-
-    auto arr_decision_function = array<Float>::empty(row_count * 1);
-    const auto daal_decision_function =
-        interop::convert_to_daal_homogen_table(arr_decision_function, row_count, 1);
-
-    interop::status_to_exception(
-        interop::call_daal_kernel<Float, daal_svm_predict_kernel_t>(ctx,
-                                                                    daal_data,
-                                                                    &daal_model,
-                                                                    *daal_decision_function,
-                                                                    &daal_parameter));
 
     return infer_result<Task>().set_responses(
         dal::detail::homogen_table_builder{}.reset(arr_decision_function, row_count, 1).build());
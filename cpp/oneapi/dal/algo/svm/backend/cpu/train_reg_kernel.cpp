@@ -117,6 +117,7 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
         interop::convert_from_daal_homogen_table<Float>(daal_model->getSupportIndices());
 
     auto trained_model = convert_from_daal_model<Task, Float>(*daal_model);
+    set_primal_weights<Float>(desc, is_dense, trained_model);
     return train_result<Task>().set_model(trained_model).set_support_indices(table_support_indices);
 }
 
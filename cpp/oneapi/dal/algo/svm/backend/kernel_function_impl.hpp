@@ -25,16 +25,28 @@
 namespace oneapi::dal::svm::detail {
 namespace v1 {
 
+/// Parameters of the linear kernel K(x, y) = scale * x^T y + shift
+struct linear_kernel_params {
+    double scale;
+    double shift;
+};
+
 class kernel_function_impl : public base {
 public:
     virtual ~kernel_function_impl() = default;
 
     virtual daal::algorithms::kernel_function::KernelIfacePtr get_daal_kernel_function(
         bool is_dense) = 0;
+
+    /// Returns the parameters of the linear kernel or nullptr if the kernel is not linear
+    virtual const linear_kernel_params* get_linear_kernel_params() const {
+        return nullptr;
+    }
 };
 
 } // namespace v1
 
+using v1::linear_kernel_params;
 using v1::kernel_function_impl;
 
 } // namespace oneapi::dal::svm::detail
@@ -22,7 +22,9 @@
 
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/algo/svm/backend/model_impl.hpp"
+#include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::svm::backend {
 
@@ -98,4 +100,50 @@ inline auto convert_from_daal_multiclass_model(
         .set_biases(table_biases);
 }
 
+/// Computes the primal weights w = sum_i coeff_i * sv_i of the model with a single
+/// decision function. For the linear kernel the decision function reduces to
+/// scale * w^T x + shift * sum_i coeff_i + bias.
+template <typename Float>
+inline table compute_primal_weights(const table& support_vectors, const table& coeffs) {
+    const std::int64_t sv_count = support_vectors.get_row_count();
+    const std::int64_t column_count = support_vectors.get_column_count();
+    ONEDAL_ASSERT(coeffs.get_row_count() == sv_count);
+    ONEDAL_ASSERT(coeffs.get_column_count() == 1);
+
+    const auto arr_sv = row_accessor<const Float>{ support_vectors }.pull();
+    const auto arr_coeffs = row_accessor<const Float>{ coeffs }.pull();
+    const Float* sv_data = arr_sv.get_data();
+
+    auto arr_sum = array<double>::zeros(column_count);
+    double* sum_data = arr_sum.get_mutable_data();
+    for (std::int64_t i = 0; i < sv_count; ++i) {
+        const double coeff = arr_coeffs[i];
+        const Float* sv_row = sv_data + i * column_count;
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            sum_data[j] += coeff * sv_row[j];
+        }
+    }
+
+    auto arr_weights = array<Float>::empty(column_count);
+    Float* weights_data = arr_weights.get_mutable_data();
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        weights_data[j] = static_cast<Float>(sum_data[j]);
+    }
+    return dal::detail::homogen_table_builder{}.reset(arr_weights, 1, column_count).build();
+}
+
+/// Stores the primal weights in the model trained with the linear kernel on dense data
+template <typename Float, typename Task>
+inline void set_primal_weights(const detail::descriptor_base<Task>& desc,
+                               bool is_dense,
+                               model<Task>& trained_model) {
+    const auto kernel_impl = detail::get_kernel_function_impl(desc);
+    if (!is_dense || !kernel_impl || !kernel_impl->get_linear_kernel_params()) {
+        return;
+    }
+    auto& impl = dal::detail::get_impl(trained_model);
+    impl.primal_weights = compute_primal_weights<Float>(trained_model.get_support_vectors(),
+                                                        trained_model.get_coeffs());
+}
+
 } // namespace oneapi::dal::svm::backend
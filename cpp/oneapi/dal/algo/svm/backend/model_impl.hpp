@@ -40,6 +40,10 @@ public:
     table coeffs;
     double bias;
     table biases;
+    /// Cached sum of the support vectors weighted by the coefficients. It is not
+    /// serialized and is reset by the setters of the support vectors and the
+    /// coefficients, the inference computes it from them when it is empty.
+    table primal_weights;
     double first_class_response;
     double second_class_response;
     std::int64_t class_count = 2;
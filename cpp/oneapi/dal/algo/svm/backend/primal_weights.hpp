@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/svm/backend/kernel_function_impl.hpp"
+#include "oneapi/dal/algo/svm/common.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
+
+namespace oneapi::dal::svm::backend {
+
+/// Returns the parameters of the linear kernel if the decision function of the model
+/// can be computed from its primal weights, and nullptr otherwise
+template <typename Task>
+inline const detail::linear_kernel_params* get_primal_kernel_params(
+    const detail::descriptor_base<Task>& desc,
+    const model<Task>& trained_model,
+    const table& data) {
+    const bool is_dense{ data.get_kind() != dal::detail::csr_table::kind() };
+    const auto kernel_impl = detail::get_kernel_function_impl(desc);
+    if (!is_dense || !kernel_impl) {
+        return nullptr;
+    }
+
+    const table& support_vectors = trained_model.get_support_vectors();
+    if (!support_vectors.has_data() ||
+        support_vectors.get_kind() == dal::detail::csr_table::kind() ||
+        support_vectors.get_column_count() != data.get_column_count() ||
+        trained_model.get_coeffs().get_column_count() != 1) {
+        return nullptr;
+    }
+    return kernel_impl->get_linear_kernel_params();
+}
+
+} // namespace oneapi::dal::svm::backend
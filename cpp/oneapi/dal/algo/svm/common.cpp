@@ -228,11 +228,13 @@ std::int64_t model<Task>::get_second_class_response() const {
 template <typename Task>
 void model<Task>::set_support_vectors_impl(const table& value) {
     impl_->support_vectors = value;
+    impl_->primal_weights = table{};
 }
 
 template <typename Task>
 void model<Task>::set_coeffs_impl(const table& value) {
     impl_->coeffs = value;
+    impl_->primal_weights = table{};
 }
 
 template <typename Task>
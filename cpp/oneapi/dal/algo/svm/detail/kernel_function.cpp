@@ -41,25 +41,29 @@ using sigmoid_kernel_t = sigmoid_kernel::descriptor<F, M>;
 template <typename Float, typename Method>
 class daal_interop_linear_kernel_impl : public kernel_function_impl {
 public:
-    daal_interop_linear_kernel_impl(double scale, double shift) : scale_(scale), shift_(shift) {}
+    daal_interop_linear_kernel_impl(double scale, double shift) : params_{ scale, shift } {}
 
     daal_kf_t get_daal_kernel_function(bool is_dense) override {
         if (is_dense) {
             constexpr daal_linear_kernel::Method daal_method = get_daal_dense_method();
             auto alg = new daal_linear_kernel::Batch<Float, daal_method>;
-            alg->parameter.k = scale_;
-            alg->parameter.b = shift_;
+            alg->parameter.k = params_.scale;
+            alg->parameter.b = params_.shift;
             return daal_kf_t(alg);
         }
         else {
             constexpr daal_linear_kernel::Method daal_method = get_daal_csr_method();
             auto alg = new daal_linear_kernel::Batch<Float, daal_method>;
-            alg->parameter.k = scale_;
-            alg->parameter.b = shift_;
+            alg->parameter.k = params_.scale;
+            alg->parameter.b = params_.shift;
             return daal_kf_t(alg);
         }
     }
 
+    const linear_kernel_params* get_linear_kernel_params() const override {
+        return &params_;
+    }
+
 private:
     static constexpr daal_linear_kernel::Method get_daal_dense_method() {
         return daal_linear_kernel::Method::defaultDense;
@@ -69,8 +73,7 @@ private:
         return daal_linear_kernel::Method::fastCSR;
     }
 
-    double scale_;
-    double shift_;
+    linear_kernel_params params_;
 };
 
 template <typename Float, typename Method>
@@ -16,12 +16,14 @@
 
 #include "oneapi/dal/algo/svm/infer.hpp"
 #include "oneapi/dal/algo/svm/train.hpp"
+#include "oneapi/dal/algo/svm/backend/primal_weights.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/dataframe.hpp"
 #include "oneapi/dal/test/engine/fixtures.hpp"
 #include "oneapi/dal/test/engine/math.hpp"
 #include "oneapi/dal/test/engine/metrics/classification.hpp"
+#include "oneapi/dal/test/engine/serialization.hpp"
 
 #include "oneapi/dal/table/homogen.hpp"
 
@@ -155,6 +157,36 @@ public:
         check_table_match(responses, result.get_responses());
     }
 
+    /// Computes the decision function of the binary model with the linear kernel
+    /// directly from the support vectors
+    table compute_linear_decision_function(const svm::model<svm::task::classification>& model,
+                                           const table& data,
+                                           double scale,
+                                           double shift) {
+        const auto sv = row_accessor<const Float>{ model.get_support_vectors() }.pull();
+        const auto coeffs = row_accessor<const Float>{ model.get_coeffs() }.pull();
+        const auto biases = row_accessor<const Float>{ model.get_biases() }.pull();
+        const auto x = row_accessor<const Float>{ data }.pull();
+
+        const std::int64_t row_count = data.get_row_count();
+        const std::int64_t column_count = data.get_column_count();
+        const std::int64_t sv_count = model.get_support_vectors().get_row_count();
+
+        auto decision_function = array<Float>::empty(row_count);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            double value = biases[0];
+            for (std::int64_t k = 0; k < sv_count; ++k) {
+                double dot = 0.0;
+                for (std::int64_t j = 0; j < column_count; ++j) {
+                    dot += double(x[i * column_count + j]) * double(sv[k * column_count + j]);
+                }
+                value += coeffs[k] * (scale * dot + shift);
+            }
+            decision_function.get_mutable_data()[i] = static_cast<Float>(value);
+        }
+        return homogen_table::wrap(decision_function, row_count, 1);
+    }
+
     void check_table_match(const table& reference, const table& actual_value) {
         const double tol = te::get_tolerance<Float>(1e-4, 1e-10);
         const double diff = te::rel_error(reference, actual_value, tol);
@@ -269,6 +301,7 @@ private:
 
 using svm_types = COMBINE_TYPES((float, double), (svm::method::thunder, svm::method::smo));
 using svm_nightly_types = COMBINE_TYPES((float, double), (svm::method::thunder));
+using svm_thunder_double_types = COMBINE_TYPES((double), (svm::method::thunder));
 
 TEMPLATE_LIST_TEST_M(svm_batch_test,
                      "svm polynomial manual dataset",
@@ -321,6 +354,264 @@ TEMPLATE_LIST_TEST_M(svm_batch_test,
     this->check_kernel_accuracy(x_train, y_train, x_test, y_test, svm_desc, ref_accuracy);
 }
 
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm linear inference by primal weights",
+                     "[svm][integration][batch][linear]",
+                     svm_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->kernel_not_available_on_device());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+
+    constexpr std::int64_t row_count_train = 19;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t element_count_train = row_count_train * column_count;
+
+    constexpr std::array<float_t, element_count_train> x_data = {
+        -5, 2, -4, 1,  -3, 0, -2, -1, -1, -2, 0, -3, 1, -2, 2, -1, 3, 0, 4,
+        1,  5, 2,  -1, 1,  0, 1,  1,  1,  -2, 2, -1, 2, 0,  2, 1,  2, 2, 2,
+    };
+    const auto x_train = homogen_table::wrap(x_data.data(), row_count_train, column_count);
+
+    constexpr std::array<float_t, row_count_train> y_data = { -1, -1, -1, -1, -1, -1, -1,
+                                                              -1, -1, -1, -1, 1,  1,  1,
+                                                              1,  1,  1,  1,  1 };
+    const auto y_train = homogen_table::wrap(y_data.data(), row_count_train, 1);
+
+    const auto kernel_desc = kernel_t{}.set_scale(0.5).set_shift(2.0);
+    const auto svm_desc =
+        svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{ kernel_desc }
+            .set_c(1.0);
+
+    INFO("run training");
+    const auto train_result = this->train(svm_desc, x_train, y_train);
+    const auto trained_model = train_result.get_model();
+
+    INFO("rebuild the model from support vectors only");
+    const auto sv_model = svm::model<svm::task::classification>{}
+                              .set_support_vectors(trained_model.get_support_vectors())
+                              .set_coeffs(trained_model.get_coeffs())
+                              .set_biases(trained_model.get_biases())
+                              .set_first_class_response(trained_model.get_first_class_response())
+                              .set_second_class_response(trained_model.get_second_class_response());
+
+    INFO("run inference");
+    const auto primal_result = this->infer(svm_desc, trained_model, x_train);
+    const auto sv_result = this->infer(svm_desc, sv_model, x_train);
+
+    INFO("check if decision function matches the support vectors based one")
+    const auto expected_decision_function =
+        this->compute_linear_decision_function(trained_model, x_train, 0.5, 2.0);
+    this->check_table_match(expected_decision_function, primal_result.get_decision_function());
+    this->check_table_match(expected_decision_function, sv_result.get_decision_function());
+    this->check_table_match(sv_result.get_responses(), primal_result.get_responses());
+}
+
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm linear inference by primal weights after deserialization",
+                     "[svm][integration][batch][linear]",
+                     svm_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->kernel_not_available_on_device());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+
+    constexpr std::int64_t row_count_train = 19;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t element_count_train = row_count_train * column_count;
+
+    constexpr std::array<float_t, element_count_train> x_data = {
+        -5, 2, -4, 1,  -3, 0, -2, -1, -1, -2, 0, -3, 1, -2, 2, -1, 3, 0, 4,
+        1,  5, 2,  -1, 1,  0, 1,  1,  1,  -2, 2, -1, 2, 0,  2, 1,  2, 2, 2,
+    };
+    const auto x_train = homogen_table::wrap(x_data.data(), row_count_train, column_count);
+
+    constexpr std::array<float_t, row_count_train> y_data = { -1, -1, -1, -1, -1, -1, -1,
+                                                              -1, -1, -1, -1, 1,  1,  1,
+                                                              1,  1,  1,  1,  1 };
+    const auto y_train = homogen_table::wrap(y_data.data(), row_count_train, 1);
+
+    const auto kernel_desc = kernel_t{}.set_scale(0.5).set_shift(2.0);
+    const auto svm_desc =
+        svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{ kernel_desc }
+            .set_c(1.0);
+
+    INFO("run training");
+    const auto train_result = this->train(svm_desc, x_train, y_train);
+    const auto trained_model = train_result.get_model();
+
+    INFO("serialize and deserialize the model");
+    const auto deserialized_model = te::serialize_deserialize(trained_model);
+
+    INFO("check if deserialized model is inferred by primal weights");
+    REQUIRE(svm::backend::get_primal_kernel_params(svm_desc, deserialized_model, x_train));
+
+    INFO("run inference");
+    const auto trained_result = this->infer(svm_desc, trained_model, x_train);
+    const auto deserialized_result = this->infer(svm_desc, deserialized_model, x_train);
+
+    INFO("check if decision function matches the support vectors based one")
+    const auto expected_decision_function =
+        this->compute_linear_decision_function(trained_model, x_train, 0.5, 2.0);
+    this->check_table_match(expected_decision_function,
+                            deserialized_result.get_decision_function());
+    this->check_table_match(trained_result.get_decision_function(),
+                            deserialized_result.get_decision_function());
+    this->check_table_match(trained_result.get_responses(), deserialized_result.get_responses());
+}
+
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm linear inference after update of trained model",
+                     "[svm][integration][batch][linear]",
+                     svm_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+    SKIP_IF(this->kernel_not_available_on_device());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = linear::descriptor<float_t, linear::method::dense>;
+
+    constexpr std::int64_t row_count_train = 19;
+    constexpr std::int64_t column_count = 2;
+    constexpr std::int64_t element_count_train = row_count_train * column_count;
+
+    constexpr std::array<float_t, element_count_train> x_data = {
+        -5, 2, -4, 1,  -3, 0, -2, -1, -1, -2, 0, -3, 1, -2, 2, -1, 3, 0, 4,
+        1,  5, 2,  -1, 1,  0, 1,  1,  1,  -2, 2, -1, 2, 0,  2, 1,  2, 2, 2,
+    };
+    const auto x_train = homogen_table::wrap(x_data.data(), row_count_train, column_count);
+
+    constexpr std::array<float_t, row_count_train> y_data = { -1, -1, -1, -1, -1, -1, -1,
+                                                              -1, -1, -1, -1, 1,  1,  1,
+                                                              1,  1,  1,  1,  1 };
+    const auto y_train = homogen_table::wrap(y_data.data(), row_count_train, 1);
+
+    const auto svm_desc =
+        svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{}.set_c(1.0);
+
+    INFO("run training");
+    const auto train_result = this->train(svm_desc, x_train, y_train);
+    auto trained_model = train_result.get_model();
+
+    INFO("replace the coefficients of the trained model");
+    const auto coeffs = row_accessor<const float_t>{ trained_model.get_coeffs() }.pull();
+    auto scaled_coeffs = array<float_t>::empty(coeffs.get_count());
+    for (std::int64_t i = 0; i < coeffs.get_count(); ++i) {
+        scaled_coeffs.get_mutable_data()[i] = -2 * coeffs[i];
+    }
+    const auto scaled_coeffs_table = homogen_table::wrap(scaled_coeffs, coeffs.get_count(), 1);
+    trained_model.set_coeffs(scaled_coeffs_table);
+
+    INFO("build the model with the same support vectors and coefficients");
+    const auto sv_model = svm::model<svm::task::classification>{}
+                              .set_support_vectors(trained_model.get_support_vectors())
+                              .set_coeffs(scaled_coeffs_table)
+                              .set_biases(trained_model.get_biases())
+                              .set_first_class_response(trained_model.get_first_class_response())
+                              .set_second_class_response(trained_model.get_second_class_response());
+
+    INFO("run inference");
+    const auto updated_result = this->infer(svm_desc, trained_model, x_train);
+    const auto sv_result = this->infer(svm_desc, sv_model, x_train);
+
+    INFO("check if stale primal weights are not used")
+    const auto expected_decision_function =
+        this->compute_linear_decision_function(sv_model, x_train, 1.0, 0.0);
+    this->check_table_match(expected_decision_function, updated_result.get_decision_function());
+    this->check_table_match(sv_result.get_decision_function(),
+                            updated_result.get_decision_function());
+    this->check_table_match(sv_result.get_responses(), updated_result.get_responses());
+}
+
+TEMPLATE_LIST_TEST_M(svm_batch_test,
+                     "svm thunder training with and without shrinking",
+                     "[svm][integration][batch][rbf]",
+                     svm_thunder_double_types) {
+    SKIP_IF(this->not_float64_friendly());
+
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = rbf::descriptor<float_t, rbf::method::dense>;
+
+    // The data set is much larger than the working set of 256 rows, and every fifth label
+    // is flipped, so many variables are bounded by C and are shrunk during the training
+    constexpr std::int64_t row_count_train = 5000;
+    constexpr std::int64_t column_count = 4;
+    constexpr double c = 1.0;
+    constexpr double accuracy_threshold = 1e-4;
+
+    const te::dataframe train_data = GENERATE_DATAFRAME(
+        te::dataframe_builder{ row_count_train, column_count }.fill_normal(0, 1, 7777));
+    const table x_train = train_data.get_table(this->get_homogen_table_id());
+
+    INFO("build overlapping classes with a part of labels flipped");
+    const auto x_rows = row_accessor<const float_t>{ x_train }.pull();
+    auto y_data = array<float_t>::empty(row_count_train);
+    for (std::int64_t i = 0; i < row_count_train; ++i) {
+        const float_t* row = x_rows.get_data() + i * column_count;
+        const bool positive = (row[0] + float_t(0.5) * row[1] - row[2] * row[3]) > 0;
+        const bool flipped = (i % 5 == 0);
+        y_data.get_mutable_data()[i] = (positive != flipped) ? float_t(1) : float_t(-1);
+    }
+    const auto y_train = homogen_table::wrap(y_data, row_count_train, 1);
+
+    const auto kernel_desc = kernel_t{}.set_sigma(1.5);
+    const auto base_desc =
+        svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{ kernel_desc }
+            .set_c(c)
+            .set_accuracy_threshold(accuracy_threshold)
+            .set_max_iteration_count(100 * row_count_train);
+    auto shrinking_desc = base_desc;
+    shrinking_desc.set_shrinking(true);
+    auto no_shrinking_desc = base_desc;
+    no_shrinking_desc.set_shrinking(false);
+
+    INFO("run training");
+    const auto shrinking_result = this->train(shrinking_desc, x_train, y_train);
+    const auto no_shrinking_result = this->train(no_shrinking_desc, x_train, y_train);
+
+    INFO("check if most of the support vectors are bounded");
+    const std::int64_t sv_count = no_shrinking_result.get_support_vector_count();
+    const auto coeffs = row_accessor<const float_t>{ no_shrinking_result.get_coeffs() }.pull();
+    std::int64_t bounded_sv_count = 0;
+    for (std::int64_t i = 0; i < sv_count; ++i) {
+        bounded_sv_count += (std::abs(coeffs[i]) > c * (1 - accuracy_threshold));
+    }
+    REQUIRE(bounded_sv_count > row_count_train / 10);
+    REQUIRE(bounded_sv_count > sv_count / 2);
+
+    INFO("check if the support vector counts match up to the variables near the bounds");
+    const std::int64_t sv_count_diff =
+        std::abs(shrinking_result.get_support_vector_count() - sv_count);
+    REQUIRE(sv_count_diff <= sv_count / 100);
+
+    INFO("check if the decision functions match within the solver accuracy");
+    // The solutions of both runs satisfy the optimality conditions up to the accuracy
+    // threshold, so their decision functions differ by a small multiple of it
+    const double tolerance = 100 * accuracy_threshold;
+    const auto shrinking_infer_result =
+        this->infer(shrinking_desc, shrinking_result.get_model(), x_train);
+    const auto no_shrinking_infer_result =
+        this->infer(no_shrinking_desc, no_shrinking_result.get_model(), x_train);
+    const auto shrinking_df =
+        row_accessor<const float_t>{ shrinking_infer_result.get_decision_function() }.pull();
+    const auto no_shrinking_df =
+        row_accessor<const float_t>{ no_shrinking_infer_result.get_decision_function() }.pull();
+    double max_df_diff = 0.0;
+    for (std::int64_t i = 0; i < row_count_train; ++i) {
+        max_df_diff = std::max(max_df_diff, double(std::abs(shrinking_df[i] - no_shrinking_df[i])));
+    }
+    CAPTURE(max_df_diff);
+    REQUIRE(max_df_diff < tolerance);
+}
+
 TEMPLATE_LIST_TEST_M(svm_batch_test,
                      "svm sigmoid manual dataset",
                      "[svm][integration][batch][sigmoid]",
@@ -31,6 +31,9 @@
 #define KERNEL_SINGLE_NODE_GPU(...) \
     KERNEL_SPEC(::oneapi::dal::backend::single_node_gpu_kernel, __VA_ARGS__)
 
+#define KERNEL_UNIVERSAL_SPMD_CPU(...) \
+    KERNEL_SPEC(::oneapi::dal::backend::universal_spmd_cpu_kernel, __VA_ARGS__)
+
 #define KERNEL_UNIVERSAL_SPMD_GPU(...) \
     KERNEL_SPEC(::oneapi::dal::backend::universal_spmd_gpu_kernel, __VA_ARGS__)
 
@@ -86,7 +89,9 @@ public:
 
     explicit context_cpu(const detail::spmd_communicator& comm)
             : communicator_provider(comm),
-              cpu_extensions_(detail::host_policy::get_default().get_enabled_cpu_extensions()) {}
+              cpu_extensions_(detail::host_policy::get_default().get_enabled_cpu_extensions()) {
+        global_init();
+    }
 
     detail::cpu_extension get_enabled_cpu_extensions() const {
         return cpu_extensions_;
@@ -142,6 +147,9 @@ struct single_node_gpu_kernel {};
 /// Tag that indicates universal GPU kernel for single-node and SPMD modes
 struct universal_spmd_gpu_kernel {};
 
+/// Tag that indicates universal CPU kernel for single-node and SPMD modes
+struct universal_spmd_cpu_kernel {};
+
 template <typename Tag, typename Kernel>
 struct kernel_spec {};
 
@@ -272,6 +280,126 @@ struct kernel_dispatcher<kernel_spec<single_node_cpu_kernel, CpuKernel>,
 };
 #endif
 
+/// Dispatcher for the case of only CPU algorithm based on universal SPMD kernel
+template <typename CpuKernel>
+struct kernel_dispatcher<kernel_spec<universal_spmd_cpu_kernel, CpuKernel>> {
+    template <typename... Args>
+    auto operator()(const detail::host_policy& policy, Args&&... args) const {
+        return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_host_policy& policy, Args&&... args) const {
+        return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    template <typename... Args>
+    auto operator()(const detail::data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy,
+            [&]() {
+                return CpuKernel{}(context_cpu{}, std::forward<Args>(args)...);
+            },
+            [&]() -> cpu_kernel_return_t<CpuKernel, Args...> {
+                // We have to specify return type for this lambda as compiler cannot
+                // infer it from a body that consist of single `throw` expression
+                using msg = detail::error_messages;
+                throw unimplemented{ msg::algorithm_is_not_implemented_for_this_device() };
+            });
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy.get_local(),
+            [&]() {
+                return CpuKernel{}(context_cpu{ policy.get_communicator() },
+                                   std::forward<Args>(args)...);
+            },
+            [&]() -> cpu_kernel_return_t<CpuKernel, Args...> {
+                // We have to specify return type for this lambda as compiler cannot
+                // infer it from a body that consist of single `throw` expression
+                using msg = detail::error_messages;
+                throw unimplemented{
+                    msg::spmd_version_of_algorithm_is_not_implemented_for_this_device()
+                };
+            });
+    }
+#endif
+};
+
+#ifdef ONEDAL_DATA_PARALLEL
+/// Dispatcher for the case of multi-node CPU algorithm based on
+/// universal SPMD kernel and single-node GPU algorithm
+template <typename CpuKernel, typename GpuKernel>
+struct kernel_dispatcher<kernel_spec<universal_spmd_cpu_kernel, CpuKernel>,
+                         kernel_spec<single_node_gpu_kernel, GpuKernel>> {
+    template <typename... Args>
+    auto operator()(const detail::data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy,
+            [&]() {
+                return CpuKernel{}(context_cpu{}, std::forward<Args>(args)...);
+            },
+            [&]() {
+                return GpuKernel{}(context_gpu{ policy }, std::forward<Args>(args)...);
+            });
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy.get_local(),
+            [&]() {
+                return CpuKernel{}(context_cpu{ policy.get_communicator() },
+                                   std::forward<Args>(args)...);
+            },
+            [&]() -> cpu_kernel_return_t<CpuKernel, Args...> {
+                // We have to specify return type for this lambda as compiler cannot
+                // infer it from a body that consist of single `throw` expression
+                using msg = detail::error_messages;
+                throw unimplemented{
+                    msg::spmd_version_of_algorithm_is_not_implemented_for_this_device()
+                };
+            });
+    }
+};
+#endif
+
+#ifdef ONEDAL_DATA_PARALLEL
+/// Dispatcher for the case of multi-node CPU and GPU algorithms
+/// based on universal SPMD kernels
+template <typename CpuKernel, typename GpuKernel>
+struct kernel_dispatcher<kernel_spec<universal_spmd_cpu_kernel, CpuKernel>,
+                         kernel_spec<universal_spmd_gpu_kernel, GpuKernel>> {
+    template <typename... Args>
+    auto operator()(const detail::data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy,
+            [&]() {
+                return CpuKernel{}(context_cpu{}, std::forward<Args>(args)...);
+            },
+            [&]() {
+                return GpuKernel{}(context_gpu{ policy }, std::forward<Args>(args)...);
+            });
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_data_parallel_policy& policy, Args&&... args) const {
+        return dispatch_by_device(
+            policy.get_local(),
+            [&]() {
+                return CpuKernel{}(context_cpu{ policy.get_communicator() },
+                                   std::forward<Args>(args)...);
+            },
+            [&]() {
+                return GpuKernel{}(context_gpu{ policy }, std::forward<Args>(args)...);
+            });
+    }
+};
+#endif
+
 inline bool test_cpu_extension(detail::cpu_extension mask, detail::cpu_extension test) {
     return mask >= test;
 }
@@ -52,6 +52,16 @@ ONEDAL_EXPORT void _onedal_threader_for_int32ptr(const std::int32_t *begin,
     _daal_threader_for_int32ptr(begin, end, a, static_cast<daal::functype_int32ptr>(func));
 }
 
+ONEDAL_EXPORT void _onedal_threader_execute_in_arena(std::int32_t max_concurrency,
+                                                     std::int32_t numa_node,
+                                                     const void *a,
+                                                     oneapi::dal::preview::arena_functype func) {
+    _daal_threader_execute_in_arena(max_concurrency,
+                                    numa_node,
+                                    a,
+                                    static_cast<daal::functype_arena>(func));
+}
+
 ONEDAL_EXPORT std::int64_t _onedal_parallel_reduce_int32_int64(
     int32_t n,
     std::int64_t init,
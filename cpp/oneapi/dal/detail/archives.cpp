@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/archives.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oneapi::dal::detail::v1 {
+
+file_output_archive::file_output_archive(int file_descriptor, std::int64_t buffer_size)
+        : file_descriptor_(file_descriptor) {
+    if (buffer_size <= 0) {
+        throw invalid_argument{ error_messages::archive_buffer_size_leq_zero() };
+    }
+    buffer_ = array<byte_t>::empty(buffer_size);
+}
+
+file_output_archive::~file_output_archive() {
+    try {
+        flush();
+    }
+    catch (...) {
+        // Destructor must not throw, the error is reported by the explicit flush
+    }
+}
+
+void file_output_archive::flush() {
+    write_to_file(buffer_.get_data(), buffer_count_);
+    buffer_count_ = 0;
+}
+
+void file_output_archive::write(const byte_t* data, std::int64_t byte_count) {
+    const std::int64_t buffer_size = buffer_.get_count();
+    if (buffer_count_ + byte_count > buffer_size) {
+        flush();
+    }
+
+    // Payloads larger than the buffer are written to the file directly
+    if (byte_count >= buffer_size) {
+        write_to_file(data, byte_count);
+    }
+    else {
+        memcpy(default_host_policy{},
+               buffer_.get_mutable_data() + buffer_count_,
+               data,
+               byte_count);
+        buffer_count_ += byte_count;
+    }
+    size_ += byte_count;
+}
+
+void file_output_archive::write_to_file(const byte_t* data, std::int64_t byte_count) {
+    while (byte_count > 0) {
+#ifdef _WIN32
+        const auto chunk_size =
+            static_cast<unsigned>(std::min<std::int64_t>(byte_count, std::int64_t(1) << 30));
+        const std::int64_t written_count = ::_write(file_descriptor_, data, chunk_size);
+#else
+        const std::int64_t written_count =
+            ::write(file_descriptor_, data, static_cast<std::size_t>(byte_count));
+#endif
+        if (written_count <= 0) {
+            is_valid_ = false;
+            throw internal_error{ error_messages::archive_cannot_be_written_to_file() };
+        }
+        data += written_count;
+        byte_count -= written_count;
+    }
+}
+
+#ifndef _WIN32
+
+array<byte_t> map_file(const std::string& path) {
+    const int file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        throw invalid_argument{ error_messages::file_not_found() };
+    }
+
+    struct stat file_stat;
+    if (::fstat(file_descriptor, &file_stat) != 0) {
+        ::close(file_descriptor);
+        throw invalid_argument{ error_messages::file_cannot_be_mapped() };
+    }
+
+    const std::int64_t size = file_stat.st_size;
+    if (size == 0) {
+        ::close(file_descriptor);
+        return array<byte_t>{};
+    }
+
+    // Private mapping is writable, modifications of the arrays that alias
+    // the file content are not written back to the file
+    void* data = ::mmap(nullptr,
+                        static_cast<std::size_t>(size),
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE,
+                        file_descriptor,
+                        0);
+    ::close(file_descriptor);
+    if (data == MAP_FAILED) {
+        throw invalid_argument{ error_messages::file_cannot_be_mapped() };
+    }
+
+    return array<byte_t>{ static_cast<byte_t*>(data), size, [size](byte_t* ptr) {
+                             ::munmap(ptr, static_cast<std::size_t>(size));
+                         } };
+}
+
+#else
+
+array<byte_t> map_file(const std::string& path) {
+    // Memory mapping is not used on Windows, the file is read into the buffer
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        throw invalid_argument{ error_messages::file_not_found() };
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    const std::int64_t size = _ftelli64(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (size <= 0) {
+        std::fclose(file);
+        return array<byte_t>{};
+    }
+
+    auto content = array<byte_t>::empty(size);
+    const std::size_t read_count =
+        std::fread(content.get_mutable_data(), 1, static_cast<std::size_t>(size), file);
+    std::fclose(file);
+    if (static_cast<std::int64_t>(read_count) != size) {
+        throw invalid_argument{ error_messages::file_cannot_be_mapped() };
+    }
+    return content;
+}
+
+#endif
+
+} // namespace oneapi::dal::detail::v1
@@ -16,12 +16,31 @@
 
 #pragma once
 
+#include <string>
+
 #include "oneapi/dal/detail/paged_vector.hpp"
 
 namespace oneapi::dal::detail {
 namespace v1 {
 
 constexpr std::uint32_t binary_archive_magic = 0x4441414F;
+constexpr std::uint32_t aligned_binary_archive_magic = 0x4441414C;
+
+/// Alignment of the large payloads in the aligned binary archive
+constexpr std::int64_t aligned_archive_alignment = 64;
+
+/// Payloads of at least this number of bytes are aligned in the aligned binary archive
+constexpr std::int64_t aligned_archive_min_aligned_size = 1024;
+
+/// Returns the number of padding bytes written to the aligned binary archive
+/// at the `position` before the payload of `byte_count` bytes
+inline std::int64_t get_aligned_archive_padding(std::int64_t position, std::int64_t byte_count) {
+    if (byte_count < aligned_archive_min_aligned_size) {
+        return 0;
+    }
+    const std::int64_t remainder = position % aligned_archive_alignment;
+    return remainder > 0 ? aligned_archive_alignment - remainder : 0;
+}
 
 class binary_output_archive : public base {
 public:
@@ -72,7 +91,7 @@ public:
     }
 
 private:
-    static constexpr std::int64_t min_page_size = 32;
+    static constexpr std::int64_t min_page_size = 4096;
     paged_vector<byte_t> content_{ min_page_size };
     bool is_valid_ = true;
 };
@@ -109,9 +128,10 @@ public:
             throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
         }
 
-        for (std::int64_t i = 0; i < byte_count; i++) {
-            reinterpret_cast<byte_t*>(data)[i] = input_data_[position_ + i];
-        }
+        memcpy(default_host_policy{},
+               data,
+               input_data_.get_data() + position_,
+               byte_count);
         position_ += byte_count;
     }
 
@@ -125,9 +145,220 @@ private:
     bool is_valid_ = true;
 };
 
+/// Output archive in the aligned binary format. Payloads of at least
+/// `aligned_archive_min_aligned_size` bytes are padded to
+/// `aligned_archive_alignment`, so the arrays can be read from the archive
+/// content in place by the `aligned_binary_input_archive`.
+class aligned_binary_output_archive : public base {
+public:
+    aligned_binary_output_archive() = default;
+
+    aligned_binary_output_archive(const aligned_binary_output_archive&) = delete;
+    aligned_binary_output_archive& operator=(const aligned_binary_output_archive&) = delete;
+
+    void prologue() {
+        is_valid_ = false;
+        const std::uint32_t magic = aligned_binary_archive_magic;
+        operator()(&magic, make_data_type<std::uint32_t>());
+    }
+
+    void epilogue() {
+        is_valid_ = true;
+    }
+
+    void operator()(const void* data, data_type dtype, std::int64_t count = 1) {
+        ONEDAL_ASSERT(data);
+        ONEDAL_ASSERT(count > 0);
+
+        const std::int64_t type_size = get_data_type_size(dtype);
+        const std::int64_t byte_count = check_mul_overflow(type_size, count);
+
+        const std::int64_t padding = get_aligned_archive_padding(get_size(), byte_count);
+        if (padding > 0) {
+            const byte_t zeros[aligned_archive_alignment] = {};
+            content_.push_back(zeros, padding);
+        }
+        content_.push_back(reinterpret_cast<const byte_t*>(data), byte_count);
+    }
+
+    void reset() {
+        is_valid_ = true;
+        content_.reset();
+    }
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+    std::int64_t get_size() const {
+        return integral_cast<std::int64_t>(content_.get_count());
+    }
+
+    array<byte_t> to_array() const {
+        if (!is_valid_) {
+            throw internal_error{ error_messages::archive_is_in_invalid_state() };
+        }
+
+        return content_.to_array();
+    }
+
+private:
+    static constexpr std::int64_t min_page_size = 4096;
+    paged_vector<byte_t> content_{ min_page_size };
+    bool is_valid_ = true;
+};
+
+/// Input archive in the aligned binary format. If the archive content is
+/// mutable and properly aligned, large arrays are deserialized as views of
+/// the content, which shares the ownership of the data with them.
+class aligned_binary_input_archive : public base {
+public:
+    explicit aligned_binary_input_archive(const array<byte_t>& data) : input_data_(data) {}
+
+    aligned_binary_input_archive(const byte_t* data, std::int64_t size_in_bytes)
+            : input_data_(array<byte_t>::wrap(data, size_in_bytes)) {}
+
+    void prologue() {
+        is_valid_ = false;
+
+        std::uint32_t magic;
+        operator()(&magic, make_data_type<std::uint32_t>());
+        if (magic != aligned_binary_archive_magic) {
+            throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+        }
+    }
+
+    void epilogue() {
+        is_valid_ = true;
+    }
+
+    void operator()(void* data, data_type dtype, std::int64_t count = 1) {
+        ONEDAL_ASSERT(data);
+        ONEDAL_ASSERT(count > 0);
+
+        const std::int64_t type_size = get_data_type_size(dtype);
+        const std::int64_t byte_count = check_mul_overflow(type_size, count);
+        const std::int64_t offset = get_payload_offset(byte_count);
+
+        memcpy(default_host_policy{}, data, input_data_.get_data() + offset, byte_count);
+        position_ = offset + byte_count;
+    }
+
+    /// Reads the payload of `byte_count` bytes as the view of the archive content.
+    /// Returns the empty pointer and does not change the position of the archive
+    /// if the content cannot be shared.
+    shared<byte_t> try_alias(std::int64_t byte_count) {
+        ONEDAL_ASSERT(byte_count > 0);
+
+        if (!input_data_.has_mutable_data() || byte_count < aligned_archive_min_aligned_size) {
+            return shared<byte_t>{};
+        }
+
+        const std::int64_t offset = get_payload_offset(byte_count);
+        byte_t* payload = input_data_.get_mutable_data() + offset;
+        if (reinterpret_cast<std::uintptr_t>(payload) % aligned_archive_alignment > 0) {
+            return shared<byte_t>{};
+        }
+
+        position_ = offset + byte_count;
+        return shared<byte_t>{ payload, [content = input_data_](byte_t*) {} };
+    }
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+private:
+    std::int64_t get_payload_offset(std::int64_t byte_count) const {
+        const std::int64_t offset =
+            position_ + get_aligned_archive_padding(position_, byte_count);
+        if (offset + byte_count > input_data_.get_count()) {
+            throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+        }
+        return offset;
+    }
+
+    array<byte_t> input_data_;
+    std::int64_t position_ = 0;
+    bool is_valid_ = true;
+};
+
+/// Output archive that writes the aligned binary format directly to the file
+/// descriptor through the buffer of fixed size, so the serialized object is
+/// never kept in memory as a whole. The file descriptor is not closed.
+class ONEDAL_EXPORT file_output_archive : public base {
+public:
+    explicit file_output_archive(int file_descriptor,
+                                 std::int64_t buffer_size = default_buffer_size);
+    ~file_output_archive();
+
+    file_output_archive(const file_output_archive&) = delete;
+    file_output_archive& operator=(const file_output_archive&) = delete;
+
+    void prologue() {
+        is_valid_ = false;
+        const std::uint32_t magic = aligned_binary_archive_magic;
+        operator()(&magic, make_data_type<std::uint32_t>());
+    }
+
+    void epilogue() {
+        flush();
+        is_valid_ = true;
+    }
+
+    void operator()(const void* data, data_type dtype, std::int64_t count = 1) {
+        ONEDAL_ASSERT(data);
+        ONEDAL_ASSERT(count > 0);
+
+        const std::int64_t type_size = get_data_type_size(dtype);
+        const std::int64_t byte_count = check_mul_overflow(type_size, count);
+
+        const std::int64_t padding = get_aligned_archive_padding(size_, byte_count);
+        if (padding > 0) {
+            const byte_t zeros[aligned_archive_alignment] = {};
+            write(zeros, padding);
+        }
+        write(reinterpret_cast<const byte_t*>(data), byte_count);
+    }
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+    /// Returns the number of bytes written to the archive
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+    /// Writes the buffered bytes to the file
+    void flush();
+
+private:
+    static constexpr std::int64_t default_buffer_size = 1 << 20;
+
+    void write(const byte_t* data, std::int64_t byte_count);
+    void write_to_file(const byte_t* data, std::int64_t byte_count);
+
+    int file_descriptor_;
+    array<byte_t> buffer_;
+    std::int64_t buffer_count_ = 0;
+    std::int64_t size_ = 0;
+    bool is_valid_ = true;
+};
+
+/// Maps the file into memory with the private copy-on-write mapping. The file
+/// is unmapped once the last copy of the returned array is destroyed.
+ONEDAL_EXPORT array<byte_t> map_file(const std::string& path);
+
 } // namespace v1
 
+using v1::aligned_archive_alignment;
+using v1::aligned_archive_min_aligned_size;
 using v1::binary_output_archive;
 using v1::binary_input_archive;
+using v1::aligned_binary_output_archive;
+using v1::aligned_binary_input_archive;
+using v1::file_output_archive;
+using v1::map_file;
 
 } // namespace oneapi::dal::detail
@@ -54,6 +54,12 @@ inline deserialize_result_t deserialize_array_on_host(input_archive& archive,
     }
 
     if (size_in_bytes > 0) {
+        // Large arrays from the aligned archives are not copied
+        auto aliased_data = archive.try_alias(size_in_bytes);
+        if (aliased_data) {
+            return { aliased_data, size_in_bytes };
+        }
+
         auto deleter = make_default_delete<byte_t>(detail::default_host_policy{});
         byte_t* data_placeholder = malloc<byte_t>(detail::default_host_policy{}, size_in_bytes);
         auto shared_data_placeholder = shared<byte_t>{ data_placeholder, std::move(deleter) };
@@ -59,6 +59,8 @@ MSG(invalid_key, "Cannot find the given key")
 MSG(capacity_leq_zero, "Capacity is lower than or equal to zero")
 MSG(empty_set_of_result_options, "Empty set of result options")
 MSG(this_result_is_not_enabled_via_result_options, "This result is not enabled via result options")
+MSG(thread_count_lt_zero, "Thread count is lower than zero")
+MSG(numa_node_lt_minus_one, "NUMA node index is lower than -1")
 
 /* Primitives */
 MSG(invalid_number_of_elements_to_process, "Invalid number of elements to process")
@@ -122,6 +124,15 @@ MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
 
 /* IO */
 MSG(file_not_found, "File not found")
+MSG(file_cannot_be_mapped, "File cannot be mapped into memory")
+MSG(invalid_edge_list_format,
+    "Invalid edge list format, expect one edge per line: two vertex IDs and optional weight")
+MSG(incompatible_binary_graph_file,
+    "Binary graph file is incompatible with the requested graph type")
+MSG(corrupted_binary_graph_file,
+    "Binary graph file is corrupted: section sizes, offsets or vertex IDs are out of range")
+MSG(file_cannot_be_opened_for_writing, "File cannot be opened for writing")
+MSG(file_write_failed, "Failed to write to the file")
 MSG(unsupported_read_mode, "Unsupported read mode")
 
 /* Serialization */
@@ -130,15 +141,36 @@ MSG(archive_content_does_not_match_type, "Archive content does not match request
 MSG(archive_is_in_invalid_state,
     "Archive state is invalid. It may indicate that "
     "serialization or deserialization was interupted by an exception")
+MSG(archive_cannot_be_written_to_file, "Archive cannot be written to the file")
+MSG(archive_buffer_size_leq_zero, "Archive buffer size is lower than or equal to zero")
+
+/* Communicators */
+MSG(rank_count_leq_zero, "Rank count is lower than or equal to zero")
+MSG(rank_is_out_of_range, "Rank is out of range")
+MSG(communication_buffer_size_leq_zero, "Communication buffer size is lower than or equal to zero")
+MSG(shared_memory_segment_cannot_be_created, "Shared memory segment cannot be created")
+MSG(shared_memory_segment_already_exists,
+    "Shared memory segment with the given name already exists")
+MSG(shared_memory_segment_cannot_be_attached, "Shared memory segment cannot be attached")
+MSG(shared_memory_segment_is_incompatible,
+    "Shared memory segment was created with different rank count or buffer size")
+MSG(timeout_expired_while_waiting_for_ranks, "Timeout expired while waiting for other ranks")
+MSG(shared_memory_communicator_is_not_supported,
+    "Shared memory communicator is not supported on this platform")
+MSG(unsupported_reduce_operation, "Reduce operation is not supported by the communicator")
 
 /* General algorithms */
 MSG(accuracy_threshold_lt_zero, "Accuracy_threshold is lower than zero")
 MSG(class_count_leq_one, "Class count is lower than or equal to one")
 MSG(input_data_is_empty, "Input data is empty")
+MSG(input_data_is_not_csr_table, "Input data is not a CSR table")
 MSG(input_data_rc_neq_input_responses_rc,
     "Input data row count is not equal to input responses row count")
 MSG(input_data_rc_neq_input_weights_rc,
     "Input data row count is not equal to input weights row count")
+MSG(input_partial_result_is_empty, "Input partial result is empty")
+MSG(input_prior_partial_result_cc_neq_input_data_cc,
+    "Input prior partial result column count is not equal to input data column count")
 MSG(input_responses_are_empty, "Responses are empty")
 MSG(input_responses_contain_only_one_unique_value_expect_two,
     "Input responses contain only one unique value, two unique values are expected")
@@ -183,6 +215,10 @@ MSG(incompatible_knn_model,
     "The provided model is incompatible with the selected k-NN task or method")
 MSG(invalid_set_of_result_options_to_search,
     "Provided results options are incompatible with the search task. Search task cannot compute responses.")
+MSG(knn_hnsw_method_is_not_implemented_for_gpu, "k-NN HNSW method is not implemented for GPU")
+MSG(graph_degree_lt_two, "Graph degree is lower than two")
+MSG(construction_candidate_count_lt_one, "Construction candidate count is lower than one")
+MSG(search_candidate_count_lt_one, "Search candidate count is lower than one")
 
 /* Minkowski distance */
 MSG(invalid_minkowski_degree, "Minkowski degree should be greater than zero")
@@ -194,6 +230,8 @@ MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
+MSG(top_k_lt_zero, "Top-k is lower than zero")
+MSG(similarity_threshold_is_out_of_range, "Similarity threshold is out of the range [0, 1]")
 
 /* Subgraph Isomorphism */
 MSG(max_match_count_lt_zero, "Maximum number of match count less that zero")
@@ -205,6 +243,9 @@ MSG(incorrect_index_is_returned, "Internal error: incorrect index is returned")
 MSG(invalid_vertex_edge_attributes, "Internal error: invalid vertex/edge attributes")
 MSG(target_graph_is_smaller_than_pattern_graph, "Target graph is smaller than pattern graph")
 
+/* PageRank */
+MSG(damping_factor_is_out_of_range, "Damping factor should be in the [0, 1) range")
+
 /* PCA */
 MSG(component_count_lt_zero, "Component count is lower than zero")
 MSG(input_data_cc_lt_desc_component_count,
@@ -290,6 +331,8 @@ MSG(input_model_tree_has_invalid_size, "Input model tree size is invalid")
 
 /* Louvain */
 MSG(louvain_algorithm_is_not_implemented, "Louvain algorithm is not implemented")
+MSG(initial_partition_rc_neq_vertex_count,
+    "Row count of the initial partition is not equal to vertex count")
 
 } // namespace v1
 } // namespace oneapi::dal::detail
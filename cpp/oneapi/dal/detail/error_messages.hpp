@@ -88,6 +88,8 @@ public:
     MSG(capacity_leq_zero);
     MSG(empty_set_of_result_options);
     MSG(this_result_is_not_enabled_via_result_options);
+    MSG(thread_count_lt_zero);
+    MSG(numa_node_lt_minus_one);
 
     /* Primitives */
     MSG(invalid_number_of_elements_to_process);
@@ -140,19 +142,42 @@ public:
 
     /* I/O */
     MSG(file_not_found);
+    MSG(file_cannot_be_mapped);
+    MSG(invalid_edge_list_format);
+    MSG(incompatible_binary_graph_file);
+    MSG(corrupted_binary_graph_file);
+    MSG(file_cannot_be_opened_for_writing);
+    MSG(file_write_failed);
     MSG(unsupported_read_mode);
 
     /* Serialization */
     MSG(object_is_not_serializable);
     MSG(archive_content_does_not_match_type);
     MSG(archive_is_in_invalid_state);
+    MSG(archive_cannot_be_written_to_file);
+    MSG(archive_buffer_size_leq_zero);
+
+    /* Communicators */
+    MSG(rank_count_leq_zero);
+    MSG(rank_is_out_of_range);
+    MSG(communication_buffer_size_leq_zero);
+    MSG(shared_memory_segment_cannot_be_created);
+    MSG(shared_memory_segment_already_exists);
+    MSG(shared_memory_segment_cannot_be_attached);
+    MSG(shared_memory_segment_is_incompatible);
+    MSG(timeout_expired_while_waiting_for_ranks);
+    MSG(shared_memory_communicator_is_not_supported);
+    MSG(unsupported_reduce_operation);
 
     /* General Algorithms */
     MSG(accuracy_threshold_lt_zero);
     MSG(class_count_leq_one);
     MSG(input_data_is_empty);
+    MSG(input_data_is_not_csr_table);
     MSG(input_data_rc_neq_input_responses_rc);
     MSG(input_data_rc_neq_input_weights_rc);
+    MSG(input_partial_result_is_empty);
+    MSG(input_prior_partial_result_cc_neq_input_data_cc);
     MSG(input_responses_are_empty);
     MSG(input_responses_contain_only_one_unique_value_expect_two);
     MSG(input_responses_contain_wrong_unique_values_count_expect_two);
@@ -184,6 +209,8 @@ public:
     MSG(negative_interval);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
+    MSG(top_k_lt_zero);
+    MSG(similarity_threshold_is_out_of_range);
 
     /* Subgraph Isomorphism */
     MSG(unsupported_kind);
@@ -218,6 +245,10 @@ public:
     MSG(distance_is_not_supported_for_gpu);
     MSG(incompatible_knn_model);
     MSG(invalid_set_of_result_options_to_search);
+    MSG(knn_hnsw_method_is_not_implemented_for_gpu);
+    MSG(graph_degree_lt_two);
+    MSG(construction_candidate_count_lt_one);
+    MSG(search_candidate_count_lt_one);
 
     /* Linear and RBF Kernels */
     MSG(input_x_cc_neq_y_cc);
@@ -226,10 +257,14 @@ public:
 
     /* Louvain */
     MSG(louvain_algorithm_is_not_implemented);
+    MSG(initial_partition_rc_neq_vertex_count);
 
     /* Minkowski distance */
     MSG(invalid_minkowski_degree);
 
+    /* PageRank */
+    MSG(damping_factor_is_out_of_range);
+
     /* PCA */
     MSG(component_count_lt_zero);
     MSG(input_data_cc_lt_desc_component_count);
@@ -17,6 +17,7 @@
 #include "oneapi/dal/detail/memory_impl_host.hpp"
 
 #include <daal/include/services/daal_memory.h>
+#include <daal/src/externals/service_memory.h>
 
 namespace oneapi::dal::detail::v1 {
 
@@ -30,7 +31,9 @@ void* alloc_impl(AllocOp&& op, std::size_t size, std::size_t alignment) {
 }
 
 void* malloc(const default_host_policy&, std::size_t size) {
-    return alloc_impl(daal::services::daal_malloc, size, daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
+    return alloc_impl(daal::services::internal::daal_numa_malloc,
+                      size,
+                      daal::DAAL_MALLOC_DEFAULT_ALIGNMENT);
 }
 
 void* calloc(const default_host_policy&, std::size_t size) {
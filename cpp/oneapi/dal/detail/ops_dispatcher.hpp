@@ -16,11 +16,48 @@
 
 #pragma once
 
+#include <exception>
+#include <optional>
+
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::detail {
 namespace v1 {
 
+template <typename Policy, typename Body>
+inline auto execute_with_policy(const Policy& policy, Body&& body) {
+    return body();
+}
+
+/// Runs the algorithm in its own task arena if the host policy limits
+/// the number of threads or the NUMA node
+template <typename Body>
+inline auto execute_with_policy(const host_policy& policy, Body&& body) {
+    const std::int64_t thread_count = policy.get_thread_count();
+    const std::int64_t numa_node = policy.get_numa_node();
+    if (thread_count == 0 && numa_node < 0) {
+        return body();
+    }
+
+    std::optional<decltype(body())> result;
+    std::exception_ptr error;
+    threader_execute_in_arena(integral_cast<std::int32_t>(thread_count),
+                              integral_cast<std::int32_t>(numa_node),
+                              [&]() {
+                                  try {
+                                      result.emplace(body());
+                                  }
+                                  catch (...) {
+                                      error = std::current_exception();
+                                  }
+                              });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return std::move(*result);
+}
+
 template <typename T, typename Ops, bool IsInput = std::is_same_v<T, typename Ops::input_t>>
 struct ops_input_dispatcher;
 
@@ -52,10 +89,12 @@ struct ops_policy_dispatcher<T, Ops, /* IsPolicy = */ true> {
     auto operator()(Policy&& policy, Descriptor&& desc, Head&& head, Tail&&... tail) {
         using ops_t = Ops<std::decay_t<Descriptor>>;
         using dispatcher_t = ops_input_dispatcher<std::decay_t<Head>, ops_t>;
-        return dispatcher_t{}(std::forward<Policy>(policy),
-                              std::forward<Descriptor>(desc),
-                              std::forward<Head>(head),
-                              std::forward<Tail>(tail)...);
+        return execute_with_policy(policy, [&]() {
+            return dispatcher_t{}(std::forward<Policy>(policy),
+                                  std::forward<Descriptor>(desc),
+                                  std::forward<Head>(head),
+                                  std::forward<Tail>(tail)...);
+        });
     }
 };
 
@@ -85,17 +124,21 @@ struct ops_policy_dispatcher_object<Object, T, Ops, /* IsPolicy = */ true> {
     auto operator()(Policy&& policy, Descriptor&& desc) {
         using ops_t = Ops<std::decay_t<Object>, std::decay_t<Descriptor>>;
         using input_t = typename ops_t::input_t;
-        return ops_t{}(std::forward<Policy>(policy), std::forward<Descriptor>(desc), input_t{});
+        return execute_with_policy(policy, [&]() {
+            return ops_t{}(std::forward<Policy>(policy), std::forward<Descriptor>(desc), input_t{});
+        });
     }
 
     template <typename Policy, typename Descriptor, typename Head, typename... Tail>
     auto operator()(Policy&& policy, Descriptor&& desc, Head&& head, Tail&&... tail) {
         using ops_t = Ops<std::decay_t<Object>, std::decay_t<Descriptor>>;
         using dispatcher_t = ops_input_dispatcher<std::decay_t<Head>, ops_t>;
-        return dispatcher_t{}(std::forward<Policy>(policy),
-                              std::forward<Descriptor>(desc),
-                              std::forward<Head>(head),
-                              std::forward<Tail>(tail)...);
+        return execute_with_policy(policy, [&]() {
+            return dispatcher_t{}(std::forward<Policy>(policy),
+                                  std::forward<Descriptor>(desc),
+                                  std::forward<Head>(head),
+                                  std::forward<Tail>(tail)...);
+        });
     }
 };
 
@@ -121,6 +164,7 @@ struct ops_policy_dispatcher_object<Object, T, Ops, /* IsPolicy = */ false> {
 
 } // namespace v1
 
+using v1::execute_with_policy;
 using v1::ops_input_dispatcher;
 using v1::ops_policy_dispatcher;
 using v1::ops_policy_dispatcher_object;
@@ -75,8 +75,8 @@ public:
             return false;
         }
 
-        for (std::int64_t i = 0; i < count; i++) {
-            data_[count_ + i] = data[i];
+        if (count > 0) {
+            memcpy(default_host_policy{}, data_ + count_, data, sizeof(T) * count);
         }
 
         count_ += count;
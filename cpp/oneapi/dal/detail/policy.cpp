@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 
 namespace oneapi::dal::detail {
@@ -23,6 +25,8 @@ namespace v1 {
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int64_t thread_count = 0;
+    std::int64_t numa_node = -1;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -31,10 +35,32 @@ void host_policy::set_enabled_cpu_extensions_impl(const cpu_extension& extension
     impl_->cpu_extensions_mask = extensions;
 }
 
+void host_policy::set_thread_count_impl(std::int64_t value) {
+    if (value < 0) {
+        throw invalid_argument{ error_messages::thread_count_lt_zero() };
+    }
+    impl_->thread_count = value;
+}
+
+void host_policy::set_numa_node_impl(std::int64_t value) {
+    if (value < -1) {
+        throw invalid_argument{ error_messages::numa_node_lt_minus_one() };
+    }
+    impl_->numa_node = value;
+}
+
 cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+std::int64_t host_policy::get_thread_count() const noexcept {
+    return impl_->thread_count;
+}
+
+std::int64_t host_policy::get_numa_node() const noexcept {
+    return impl_->numa_node;
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
@@ -82,13 +82,33 @@ public:
 
     cpu_extension get_enabled_cpu_extensions() const noexcept;
 
+    /// The maximal number of threads used by a single call of an algorithm.
+    /// If 0, the call uses all threads available to the process.
+    std::int64_t get_thread_count() const noexcept;
+
+    /// The index of the NUMA node the call runs on.
+    /// If -1, the threads are not bound to any NUMA node.
+    std::int64_t get_numa_node() const noexcept;
+
     auto& set_enabled_cpu_extensions(const cpu_extension& extensions) {
         set_enabled_cpu_extensions_impl(extensions);
         return *this;
     }
 
+    auto& set_thread_count(std::int64_t value) {
+        set_thread_count_impl(value);
+        return *this;
+    }
+
+    auto& set_numa_node(std::int64_t value) {
+        set_numa_node_impl(value);
+        return *this;
+    }
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_thread_count_impl(std::int64_t value);
+    void set_numa_node_impl(std::int64_t value);
 
     pimpl<host_policy_impl> impl_;
 };
@@ -55,6 +55,14 @@ public:
     virtual void deserialize(void* data, data_type dtype, std::int64_t count) = 0;
 };
 
+/// Optional interface of the archives that can share their content for deserialization.
+/// It is kept separate from `input_archive_iface`, so the layout of the latter does not change.
+class input_archive_alias_iface {
+public:
+    virtual ~input_archive_alias_iface() = default;
+    virtual shared<byte_t> try_alias(std::int64_t size_in_bytes) = 0;
+};
+
 /// Archive interface for serialization
 class output_archive_iface {
 public:
@@ -97,6 +105,14 @@ struct trivial_serialization_type<T, true> {
 template <typename T>
 using trivial_serialization_type_t = typename trivial_serialization_type<T>::type;
 
+template <typename Archive, typename = void>
+struct has_try_alias : std::false_type {};
+
+template <typename Archive>
+struct has_try_alias<Archive,
+                     std::void_t<decltype(std::declval<Archive&>().try_alias(std::int64_t{}))>>
+        : std::true_type {};
+
 template <typename Archive>
 class input_archive_impl : public base, public input_archive_iface {
 public:
@@ -118,10 +134,31 @@ public:
         archive_(data, dtype, count);
     }
 
-private:
+protected:
     std::remove_reference_t<Archive>& archive_;
 };
 
+template <typename Archive>
+class aliasing_input_archive_impl : public input_archive_impl<Archive>,
+                                    public input_archive_alias_iface {
+public:
+    explicit aliasing_input_archive_impl(Archive& archive) : input_archive_impl<Archive>(archive) {}
+
+    shared<byte_t> try_alias(std::int64_t size_in_bytes) override {
+        return this->archive_.try_alias(size_in_bytes);
+    }
+};
+
+template <typename Archive>
+inline input_archive_iface* make_input_archive_impl(Archive& archive) {
+    if constexpr (has_try_alias<std::remove_reference_t<Archive>>::value) {
+        return new aliasing_input_archive_impl<Archive>{ archive };
+    }
+    else {
+        return new input_archive_impl<Archive>{ archive };
+    }
+}
+
 template <typename Archive>
 class output_archive_impl : public base, public output_archive_iface {
 public:
@@ -173,7 +210,7 @@ class input_archive : public archive_base<input_archive_iface> {
 
 public:
     template <typename Archive>
-    explicit input_archive(Archive& archive) : base_t(new input_archive_impl<Archive>{ archive }) {}
+    explicit input_archive(Archive& archive) : base_t(make_input_archive_impl(archive)) {}
 
     void prologue() {
         get_impl().prologue();
@@ -203,6 +240,15 @@ public:
         return value;
     }
 
+    /// Reads `size_in_bytes` bytes written by the `output_archive::range` as the
+    /// view of the archive content. Returns the empty pointer and leaves the
+    /// archive unchanged if the underlying archive cannot share its content.
+    shared<byte_t> try_alias(std::int64_t size_in_bytes) {
+        ONEDAL_ASSERT(size_in_bytes > 0);
+        auto alias_impl = dynamic_cast<input_archive_alias_iface*>(&get_impl());
+        return alias_impl ? alias_impl->try_alias(size_in_bytes) : shared<byte_t>{};
+    }
+
 private:
     template <typename T, enable_if_trivially_serializable_t<T>* = nullptr>
     void process(T& value) {
@@ -0,0 +1,756 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/shm_communicator.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+
+#ifndef _WIN32
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oneapi::dal::detail::v1 {
+
+#ifndef _WIN32
+
+using error_msg = dal::detail::error_messages;
+
+constexpr std::int64_t shm_alignment = 64;
+constexpr std::uint64_t shm_magic = 0x4f4e4544414c534dull;
+
+inline std::int64_t align_shm_offset(std::int64_t offset) {
+    return (offset + shm_alignment - 1) / shm_alignment * shm_alignment;
+}
+
+/// The header of the shared memory segment. The counters are placed
+/// to the separate cache lines to avoid false sharing.
+struct shm_header {
+    std::atomic<std::uint64_t> magic;
+    std::int64_t rank_count;
+    std::int64_t buffer_size;
+    alignas(shm_alignment) std::atomic<std::int64_t> attached_count;
+    alignas(shm_alignment) std::atomic<std::int64_t> arrived_count;
+    alignas(shm_alignment) std::atomic<std::uint64_t> generation;
+};
+
+/// One value per rank used to exchange the sizes of the messages
+struct alignas(shm_alignment) shm_value {
+    std::int64_t value;
+};
+
+/// The layout of the segment is the header, the array of per-rank values,
+/// the buffer for the results of the reduction and the per-rank buffers
+class shm_segment_layout {
+public:
+    shm_segment_layout() = default;
+
+    shm_segment_layout(std::int64_t rank_count, std::int64_t buffer_size)
+            : buffer_size_(align_shm_offset(buffer_size)) {
+        values_offset_ = align_shm_offset(sizeof(shm_header));
+        result_offset_ = values_offset_ + check_mul_overflow<std::int64_t>(
+                                              rank_count,
+                                              sizeof(shm_value));
+        buffers_offset_ = check_sum_overflow(result_offset_, buffer_size_);
+        size_ = check_sum_overflow(buffers_offset_,
+                                   check_mul_overflow(rank_count, buffer_size_));
+    }
+
+    std::int64_t get_buffer_size() const {
+        return buffer_size_;
+    }
+
+    std::int64_t get_values_offset() const {
+        return values_offset_;
+    }
+
+    std::int64_t get_result_offset() const {
+        return result_offset_;
+    }
+
+    std::int64_t get_buffer_offset(std::int64_t rank) const {
+        return buffers_offset_ + rank * buffer_size_;
+    }
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+private:
+    std::int64_t buffer_size_ = 0;
+    std::int64_t values_offset_ = 0;
+    std::int64_t result_offset_ = 0;
+    std::int64_t buffers_offset_ = 0;
+    std::int64_t size_ = 0;
+};
+
+template <typename Op>
+inline void switch_by_dtype(const data_type& dtype, const Op& op) {
+    switch (dtype) {
+        case data_type::int8: return op(std::int8_t{});
+        case data_type::uint8: return op(std::uint8_t{});
+        case data_type::int16: return op(std::int16_t{});
+        case data_type::uint16: return op(std::uint16_t{});
+        case data_type::int32: return op(std::int32_t{});
+        case data_type::uint32: return op(std::uint32_t{});
+        case data_type::int64: return op(std::int64_t{});
+        case data_type::uint64: return op(std::uint64_t{});
+        case data_type::float32: return op(float{});
+        case data_type::float64: return op(double{});
+        default: throw invalid_argument{ error_msg::unsupported_data_type() };
+    }
+}
+
+class shm_communicator_impl : public spmd_communicator_iface {
+public:
+    using request_t = spmd_request_iface;
+
+    shm_communicator_impl(const std::string& name,
+                          std::int64_t rank,
+                          std::int64_t rank_count,
+                          std::int64_t buffer_size,
+                          std::int64_t attach_timeout_ms,
+                          std::int64_t collective_timeout_ms)
+            : name_(name),
+              rank_(rank),
+              rank_count_(rank_count),
+              attach_timeout_(attach_timeout_ms),
+              collective_timeout_(collective_timeout_ms) {
+        if (rank_count <= 0) {
+            throw invalid_argument{ error_msg::rank_count_leq_zero() };
+        }
+        if (rank < 0 || rank >= rank_count) {
+            throw invalid_argument{ error_msg::rank_is_out_of_range() };
+        }
+        if (buffer_size <= 0) {
+            throw invalid_argument{ error_msg::communication_buffer_size_leq_zero() };
+        }
+
+        layout_ = shm_segment_layout{ rank_count, buffer_size };
+
+        try {
+            if (rank == 0) {
+                create_segment();
+            }
+            else {
+                attach_segment();
+            }
+
+            get_header().attached_count.fetch_add(1, std::memory_order_acq_rel);
+            wait_for(attach_timeout_, [&]() {
+                return get_header().attached_count.load(std::memory_order_acquire) ==
+                       rank_count_;
+            });
+        }
+        catch (...) {
+            release_segment();
+            throw;
+        }
+
+        // All ranks are attached, the name is not needed anymore
+        unlink_segment();
+    }
+
+    ~shm_communicator_impl() override {
+        if (segment_) {
+            munmap(segment_, layout_.get_size());
+        }
+    }
+
+    shm_communicator_impl(const shm_communicator_impl&) = delete;
+    shm_communicator_impl& operator=(const shm_communicator_impl&) = delete;
+
+    std::int64_t get_rank() override {
+        return rank_;
+    }
+
+    std::int64_t get_rank_count() override {
+        return rank_count_;
+    }
+
+    std::int64_t get_default_root_rank() override {
+        return 0;
+    }
+
+    void barrier() override {
+        auto& header = get_header();
+        const std::uint64_t generation = header.generation.load(std::memory_order_acquire);
+
+        if (header.arrived_count.fetch_add(1, std::memory_order_acq_rel) == rank_count_ - 1) {
+            // The counter is reset before the generation is changed, so the ranks
+            // that leave the barrier observe zero when they enter the next one
+            header.arrived_count.store(0, std::memory_order_relaxed);
+            header.generation.fetch_add(1, std::memory_order_release);
+        }
+        else {
+            wait_for(collective_timeout_, [&]() {
+                return header.generation.load(std::memory_order_acquire) != generation;
+            });
+        }
+    }
+
+    request_t* bcast(byte_t* send_buf,
+                     std::int64_t count,
+                     const data_type& dtype,
+                     std::int64_t root) override {
+        ONEDAL_ASSERT(root >= 0 && root < rank_count_);
+
+        const std::int64_t size = get_size(count, dtype);
+        for_each_chunk(size, [&](std::int64_t offset, std::int64_t chunk_size) {
+            if (rank_ == root) {
+                std::memcpy(get_buffer(root), send_buf + offset, chunk_size);
+            }
+            barrier();
+            if (rank_ != root) {
+                std::memcpy(send_buf + offset, get_buffer(root), chunk_size);
+            }
+            barrier();
+        });
+
+        return nullptr;
+    }
+
+    request_t* gather(const byte_t* send_buf,
+                      std::int64_t send_count,
+                      byte_t* recv_buf,
+                      std::int64_t recv_count,
+                      const data_type& dtype,
+                      std::int64_t root) override {
+        ONEDAL_ASSERT(root >= 0 && root < rank_count_);
+
+        const std::int64_t send_size = get_size(send_count, dtype);
+        const std::int64_t recv_size = get_size(recv_count, dtype);
+        if (rank_ == root) {
+            ONEDAL_ASSERT(send_size <= recv_size);
+        }
+
+        for_each_chunk(send_size, [&](std::int64_t offset, std::int64_t chunk_size) {
+            std::memcpy(get_buffer(rank_), send_buf + offset, chunk_size);
+            barrier();
+            if (rank_ == root) {
+                for (std::int64_t r = 0; r < rank_count_; r++) {
+                    std::memcpy(recv_buf + r * recv_size + offset, get_buffer(r), chunk_size);
+                }
+            }
+            barrier();
+        });
+
+        return nullptr;
+    }
+
+    request_t* gatherv(const byte_t* send_buf,
+                       std::int64_t send_count,
+                       byte_t* recv_buf,
+                       const std::int64_t* recv_counts,
+                       const std::int64_t* displs,
+                       const data_type& dtype,
+                       std::int64_t root) override {
+        ONEDAL_ASSERT(root >= 0 && root < rank_count_);
+
+        const std::int64_t dtype_size = get_data_type_size(dtype);
+        const std::int64_t send_size = get_size(send_count, dtype);
+
+        // The ranks send the messages of different sizes,
+        // so the number of rounds is defined by the largest one
+        get_value(rank_) = send_size;
+        barrier();
+
+        std::int64_t max_size = 0;
+        for (std::int64_t r = 0; r < rank_count_; r++) {
+            max_size = std::max(max_size, get_value(r));
+        }
+
+        if (max_size == 0) {
+            // Guarantees that the values are read before the next operation overwrites them
+            barrier();
+            return nullptr;
+        }
+
+        for_each_chunk(max_size, [&](std::int64_t offset, std::int64_t chunk_size) {
+            const std::int64_t own_chunk_size = get_chunk_size(send_size, offset, chunk_size);
+            if (own_chunk_size > 0) {
+                std::memcpy(get_buffer(rank_), send_buf + offset, own_chunk_size);
+            }
+            barrier();
+            if (rank_ == root) {
+                ONEDAL_ASSERT(recv_counts);
+                ONEDAL_ASSERT(displs);
+                for (std::int64_t r = 0; r < rank_count_; r++) {
+                    const std::int64_t size = get_value(r);
+                    ONEDAL_ASSERT(size <= recv_counts[r] * dtype_size);
+
+                    const std::int64_t rank_chunk_size = get_chunk_size(size, offset, chunk_size);
+                    if (rank_chunk_size > 0) {
+                        std::memcpy(recv_buf + displs[r] * dtype_size + offset,
+                                    get_buffer(r),
+                                    rank_chunk_size);
+                    }
+                }
+            }
+            barrier();
+        });
+
+        return nullptr;
+    }
+
+    request_t* allgather(const byte_t* send_buf,
+                         std::int64_t send_count,
+                         byte_t* recv_buf,
+                         std::int64_t recv_count,
+                         const data_type& dtype) override {
+        const std::int64_t send_size = get_size(send_count, dtype);
+        const std::int64_t recv_size = get_size(recv_count, dtype);
+        ONEDAL_ASSERT(send_size <= recv_size);
+
+        for_each_chunk(send_size, [&](std::int64_t offset, std::int64_t chunk_size) {
+            std::memcpy(get_buffer(rank_), send_buf + offset, chunk_size);
+            barrier();
+            for (std::int64_t r = 0; r < rank_count_; r++) {
+                std::memcpy(recv_buf + r * recv_size + offset, get_buffer(r), chunk_size);
+            }
+            barrier();
+        });
+
+        return nullptr;
+    }
+
+    request_t* allreduce(const byte_t* send_buf,
+                         byte_t* recv_buf,
+                         std::int64_t count,
+                         const data_type& dtype,
+                         const spmd_reduce_op& op) override {
+        if (op != spmd_reduce_op::sum) {
+            throw unimplemented{ error_msg::unsupported_reduce_operation() };
+        }
+
+        switch_by_dtype(dtype, [&](auto _) {
+            using value_t = decltype(_);
+            allreduce_sum(reinterpret_cast<const value_t*>(send_buf),
+                          reinterpret_cast<value_t*>(recv_buf),
+                          count);
+        });
+
+        return nullptr;
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    request_t* bcast(sycl::queue& q,
+                     byte_t* send_buf,
+                     std::int64_t count,
+                     const data_type& dtype,
+                     const std::vector<sycl::event>& deps,
+                     std::int64_t root) override {
+        sycl::event::wait_and_throw(deps);
+
+        const std::int64_t size = get_size(count, dtype);
+        if (size == 0) {
+            return nullptr;
+        }
+
+        const auto buf_host = array<byte_t>::empty(size);
+        if (rank_ == root) {
+            memcpy_usm2host(q, buf_host.get_mutable_data(), send_buf, size);
+        }
+
+        bcast(buf_host.get_mutable_data(), count, dtype, root);
+
+        if (rank_ != root) {
+            memcpy_host2usm(q, send_buf, buf_host.get_data(), size);
+        }
+
+        return nullptr;
+    }
+
+    request_t* gather(sycl::queue& q,
+                      const byte_t* send_buf,
+                      std::int64_t send_count,
+                      byte_t* recv_buf,
+                      std::int64_t recv_count,
+                      const data_type& dtype,
+                      const std::vector<sycl::event>& deps,
+                      std::int64_t root) override {
+        sycl::event::wait_and_throw(deps);
+
+        const std::int64_t send_size = get_size(send_count, dtype);
+        const std::int64_t all_recv_size =
+            check_mul_overflow(get_size(recv_count, dtype), rank_count_);
+        if (send_size == 0) {
+            return nullptr;
+        }
+
+        const auto send_host = array<byte_t>::empty(send_size);
+        memcpy_usm2host(q, send_host.get_mutable_data(), send_buf, send_size);
+
+        array<byte_t> recv_host;
+        if (rank_ == root) {
+            recv_host.reset(all_recv_size);
+        }
+
+        gather(send_host.get_data(),
+               send_count,
+               recv_host.get_mutable_data(),
+               recv_count,
+               dtype,
+               root);
+
+        if (rank_ == root) {
+            memcpy_host2usm(q, recv_buf, recv_host.get_data(), all_recv_size);
+        }
+
+        return nullptr;
+    }
+
+    request_t* gatherv(sycl::queue& q,
+                       const byte_t* send_buf,
+                       std::int64_t send_count,
+                       byte_t* recv_buf,
+                       const std::int64_t* recv_counts_host,
+                       const std::int64_t* displs_host,
+                       const data_type& dtype,
+                       const std::vector<sycl::event>& deps,
+                       std::int64_t root) override {
+        sycl::event::wait_and_throw(deps);
+
+        const std::int64_t dtype_size = get_data_type_size(dtype);
+        const std::int64_t send_size = get_size(send_count, dtype);
+
+        const auto send_host = array<byte_t>::empty(send_size);
+        if (send_size > 0) {
+            memcpy_usm2host(q, send_host.get_mutable_data(), send_buf, send_size);
+        }
+
+        // The root receives the messages to the dense host buffer
+        // and copies them to the USM buffer using the passed displacements
+        std::int64_t total_recv_count = 0;
+        array<std::int64_t> displs_host_0;
+        if (rank_ == root) {
+            displs_host_0.reset(rank_count_);
+            for (std::int64_t r = 0; r < rank_count_; r++) {
+                displs_host_0.get_mutable_data()[r] = total_recv_count;
+                total_recv_count += recv_counts_host[r];
+            }
+        }
+
+        array<byte_t> recv_host;
+        if (rank_ == root) {
+            recv_host.reset(get_size(total_recv_count, dtype));
+        }
+
+        gatherv(send_host.get_data(),
+                send_count,
+                recv_host.get_mutable_data(),
+                recv_counts_host,
+                displs_host_0.get_data(),
+                dtype,
+                root);
+
+        if (rank_ == root) {
+            for (std::int64_t r = 0; r < rank_count_; r++) {
+                const std::int64_t size = get_size(recv_counts_host[r], dtype);
+                if (size > 0) {
+                    memcpy_host2usm(q,
+                                    recv_buf + displs_host[r] * dtype_size,
+                                    recv_host.get_data() + displs_host_0.get_data()[r] * dtype_size,
+                                    size);
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    request_t* allgather(sycl::queue& q,
+                         const byte_t* send_buf,
+                         std::int64_t send_count,
+                         byte_t* recv_buf,
+                         std::int64_t recv_count,
+                         const data_type& dtype,
+                         const std::vector<sycl::event>& deps) override {
+        sycl::event::wait_and_throw(deps);
+
+        const std::int64_t send_size = get_size(send_count, dtype);
+        const std::int64_t all_recv_size =
+            check_mul_overflow(get_size(recv_count, dtype), rank_count_);
+        if (send_size == 0) {
+            return nullptr;
+        }
+
+        const auto send_host = array<byte_t>::empty(send_size);
+        const auto recv_host = array<byte_t>::empty(all_recv_size);
+
+        memcpy_usm2host(q, send_host.get_mutable_data(), send_buf, send_size);
+        allgather(send_host.get_data(),
+                  send_count,
+                  recv_host.get_mutable_data(),
+                  recv_count,
+                  dtype);
+        memcpy_host2usm(q, recv_buf, recv_host.get_data(), all_recv_size);
+
+        return nullptr;
+    }
+
+    request_t* allreduce(sycl::queue& q,
+                         const byte_t* send_buf,
+                         byte_t* recv_buf,
+                         std::int64_t count,
+                         const data_type& dtype,
+                         const spmd_reduce_op& op,
+                         const std::vector<sycl::event>& deps) override {
+        sycl::event::wait_and_throw(deps);
+
+        const std::int64_t size = get_size(count, dtype);
+        if (size == 0) {
+            return nullptr;
+        }
+
+        const auto send_host = array<byte_t>::empty(size);
+        const auto recv_host = array<byte_t>::empty(size);
+
+        memcpy_usm2host(q, send_host.get_mutable_data(), send_buf, size);
+        allreduce(send_host.get_data(), recv_host.get_mutable_data(), count, dtype, op);
+        memcpy_host2usm(q, recv_buf, recv_host.get_data(), size);
+
+        return nullptr;
+    }
+#endif
+
+private:
+    shm_header& get_header() {
+        return *reinterpret_cast<shm_header*>(segment_);
+    }
+
+    std::int64_t& get_value(std::int64_t rank) {
+        auto values = reinterpret_cast<shm_value*>(segment_ + layout_.get_values_offset());
+        return values[rank].value;
+    }
+
+    byte_t* get_result_buffer() {
+        return segment_ + layout_.get_result_offset();
+    }
+
+    byte_t* get_buffer(std::int64_t rank) {
+        return segment_ + layout_.get_buffer_offset(rank);
+    }
+
+    static std::int64_t get_size(std::int64_t count, const data_type& dtype) {
+        ONEDAL_ASSERT(count >= 0);
+        return check_mul_overflow(get_data_type_size(dtype), count);
+    }
+
+    static std::int64_t get_chunk_size(std::int64_t size,
+                                       std::int64_t offset,
+                                       std::int64_t chunk_size) {
+        return std::max(std::min(size - offset, chunk_size), std::int64_t(0));
+    }
+
+    /// Splits the message into the chunks that fit into the per-rank buffer.
+    /// All ranks must pass the same `size`, so they perform the same number of rounds.
+    template <typename Body>
+    void for_each_chunk(std::int64_t size, Body&& body) {
+        const std::int64_t buffer_size = layout_.get_buffer_size();
+        for (std::int64_t offset = 0; offset < size; offset += buffer_size) {
+            body(offset, std::min(buffer_size, size - offset));
+        }
+    }
+
+    /// Each rank copies its part of the message to the shared buffer, then
+    /// the reduction is split between the ranks and the results are written
+    /// to the common buffer. The terms are summed in the order of the ranks,
+    /// so all ranks get bitwise equal results.
+    template <typename T>
+    void allreduce_sum(const T* send_buf, T* recv_buf, std::int64_t count) {
+        const std::int64_t chunk_count = layout_.get_buffer_size() / std::int64_t(sizeof(T));
+        for (std::int64_t offset = 0; offset < count; offset += chunk_count) {
+            const std::int64_t current_count = std::min(chunk_count, count - offset);
+
+            std::memcpy(get_buffer(rank_), send_buf + offset, current_count * sizeof(T));
+            barrier();
+
+            const std::int64_t part = (current_count + rank_count_ - 1) / rank_count_;
+            const std::int64_t first = std::min(rank_ * part, current_count);
+            const std::int64_t last = std::min(first + part, current_count);
+
+            T* result = reinterpret_cast<T*>(get_result_buffer());
+            for (std::int64_t i = first; i < last; i++) {
+                T sum = reinterpret_cast<const T*>(get_buffer(0))[i];
+                for (std::int64_t r = 1; r < rank_count_; r++) {
+                    sum += reinterpret_cast<const T*>(get_buffer(r))[i];
+                }
+                result[i] = sum;
+            }
+            barrier();
+
+            std::memcpy(recv_buf + offset, result, current_count * sizeof(T));
+            barrier();
+        }
+    }
+
+    /// Waits until the predicate is true, the negative timeout means no limit
+    template <typename Predicate>
+    void wait_for(std::chrono::milliseconds timeout, Predicate&& predicate) {
+        constexpr std::int64_t spin_count = 1024;
+        const bool is_limited = timeout.count() >= 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::int64_t i = 0; !predicate(); i++) {
+            if (i < spin_count) {
+                continue;
+            }
+            std::this_thread::yield();
+            if (is_limited && i % spin_count == 0 &&
+                std::chrono::steady_clock::now() - start > timeout) {
+                throw communication_error{ error_msg::timeout_expired_while_waiting_for_ranks() };
+            }
+        }
+    }
+
+    void create_segment() {
+        // The existing segment may belong to another job that uses the same name,
+        // so it is never removed here
+        const int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            if (errno == EEXIST) {
+                throw communication_error{ error_msg::shared_memory_segment_already_exists() };
+            }
+            throw communication_error{ error_msg::shared_memory_segment_cannot_be_created() };
+        }
+        owns_name_ = true;
+
+        const bool is_resized = ftruncate(fd, layout_.get_size()) == 0;
+        if (is_resized) {
+            map_segment(fd);
+        }
+        close(fd);
+
+        if (!is_resized || !segment_) {
+            throw communication_error{ error_msg::shared_memory_segment_cannot_be_created() };
+        }
+
+        // The pages are zeroed by `ftruncate`, so only non-zero fields are set.
+        // The magic is written last to signal other ranks that the segment is ready.
+        auto& header = get_header();
+        header.rank_count = rank_count_;
+        header.buffer_size = layout_.get_buffer_size();
+        header.magic.store(shm_magic, std::memory_order_release);
+    }
+
+    void attach_segment() {
+        int fd = -1;
+        wait_for(attach_timeout_, [&]() {
+            fd = shm_open(name_.c_str(), O_RDWR, 0);
+            if (fd < 0) {
+                return false;
+            }
+
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size >= layout_.get_size()) {
+                return true;
+            }
+
+            // The segment exists, but the rank 0 has not resized it yet
+            close(fd);
+            return false;
+        });
+
+        map_segment(fd);
+        close(fd);
+
+        if (!segment_) {
+            throw communication_error{ error_msg::shared_memory_segment_cannot_be_attached() };
+        }
+
+        auto& header = get_header();
+        wait_for(attach_timeout_, [&]() {
+            return header.magic.load(std::memory_order_acquire) == shm_magic;
+        });
+
+        if (header.rank_count != rank_count_ || header.buffer_size != layout_.get_buffer_size()) {
+            throw communication_error{ error_msg::shared_memory_segment_is_incompatible() };
+        }
+    }
+
+    /// Removes the name of the segment if it was created by the calling process
+    void unlink_segment() {
+        if (owns_name_) {
+            shm_unlink(name_.c_str());
+            owns_name_ = false;
+        }
+    }
+
+    /// Unmaps the segment and removes its name
+    void release_segment() {
+        unlink_segment();
+        if (segment_) {
+            munmap(segment_, layout_.get_size());
+            segment_ = nullptr;
+        }
+    }
+
+    void map_segment(int fd) {
+        void* ptr =
+            mmap(nullptr, layout_.get_size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        segment_ = (ptr == MAP_FAILED) ? nullptr : static_cast<byte_t*>(ptr);
+    }
+
+    std::string name_;
+    std::int64_t rank_;
+    std::int64_t rank_count_;
+    std::chrono::milliseconds attach_timeout_;
+    std::chrono::milliseconds collective_timeout_;
+    shm_segment_layout layout_;
+    byte_t* segment_ = nullptr;
+    bool owns_name_ = false;
+};
+
+shm_communicator::shm_communicator(const std::string& name,
+                                   std::int64_t rank,
+                                   std::int64_t rank_count,
+                                   std::int64_t buffer_size,
+                                   std::int64_t attach_timeout_ms,
+                                   std::int64_t collective_timeout_ms)
+        : spmd_communicator(new shm_communicator_impl{ name,
+                                                       rank,
+                                                       rank_count,
+                                                       buffer_size,
+                                                       attach_timeout_ms,
+                                                       collective_timeout_ms }) {}
+
+#else
+
+shm_communicator::shm_communicator(const std::string& name,
+                                   std::int64_t rank,
+                                   std::int64_t rank_count,
+                                   std::int64_t buffer_size,
+                                   std::int64_t attach_timeout_ms,
+                                   std::int64_t collective_timeout_ms)
+        : spmd_communicator(nullptr) {
+    throw unimplemented{
+        dal::detail::error_messages::shared_memory_communicator_is_not_supported()
+    };
+}
+
+#endif
+
+} // namespace oneapi::dal::detail::v1
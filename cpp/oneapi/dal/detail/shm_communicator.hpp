@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/communicator.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// SPMD communicator for several processes on one node. The processes exchange
+/// the data through the POSIX shared memory segment, so no MPI is required.
+/// All collective operations are blocking, the returned requests are completed.
+///
+/// Every process creates the communicator with the same `name`, `rank_count`
+/// and `buffer_size` and the unique `rank` in range [0, rank_count). The name
+/// must be unique for the job, for example, it can contain the job identifier
+/// provided by the launcher. The rank 0 creates the segment and fails if the
+/// segment with such name already exists, other ranks wait until it is created.
+/// The constructor returns when all ranks are attached, after that the name of
+/// the segment is removed from the system.
+///
+/// Example of the usage in each process:
+///
+///     const std::string name = "/my_app_" + job_id;
+///     dal::detail::shm_communicator comm{ name, rank, rank_count };
+///     dal::detail::spmd_host_policy policy{ dal::detail::host_policy{}, comm };
+///     const auto result = dal::compute(policy, desc, local_data);
+class ONEDAL_EXPORT shm_communicator : public spmd_communicator {
+public:
+    /// The default size of the per-rank buffer in the shared memory segment.
+    /// Messages larger than the buffer are transferred in several rounds.
+    static constexpr std::int64_t default_buffer_size = 4 * 1024 * 1024;
+
+    /// The default time the ranks wait for each other on attach, in milliseconds
+    static constexpr std::int64_t default_attach_timeout_ms = 60000;
+
+    /// The timeout that makes the ranks wait for each other indefinitely
+    static constexpr std::int64_t infinite_timeout = -1;
+
+    /// Creates the communicator and attaches the calling process to the
+    /// shared memory segment
+    ///
+    /// @param name        The name of the shared memory segment, must start with `/`
+    ///                    and be unique for the job
+    /// @param rank        The rank of the calling process
+    /// @param rank_count  The number of processes in the communicator
+    /// @param buffer_size The size of the per-rank buffer in bytes
+    /// @param attach_timeout_ms     The time to wait for other ranks on attach
+    ///                              in milliseconds
+    /// @param collective_timeout_ms The time to wait for other ranks on every
+    ///                              collective operation in milliseconds. The
+    ///                              ranks may spend arbitrary time computing
+    ///                              between collectives, so they wait indefinitely
+    ///                              by default.
+    ///
+    /// If the time expires, :expr:`communication_error` is thrown
+    shm_communicator(const std::string& name,
+                     std::int64_t rank,
+                     std::int64_t rank_count,
+                     std::int64_t buffer_size = default_buffer_size,
+                     std::int64_t attach_timeout_ms = default_attach_timeout_ms,
+                     std::int64_t collective_timeout_ms = infinite_timeout);
+};
+
+} // namespace v1
+
+using v1::shm_communicator;
+
+} // namespace oneapi::dal::detail
@@ -31,6 +31,7 @@ typedef void (*functype_int64)(std::int64_t i, const void *a);
 typedef void (*functype_int32ptr)(const std::int32_t *i, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
+typedef void (*arena_functype)(const void *a);
 
 typedef std::int64_t (*loop_functype_int32_int64)(std::int32_t start_idx,
                                                   std::int32_t end_idx,
@@ -73,6 +74,11 @@ ONEDAL_EXPORT void _onedal_threader_for_int32ptr(const std::int32_t *begin,
                                                  const void *a,
                                                  oneapi::dal::preview::functype_int32ptr func);
 
+ONEDAL_EXPORT void _onedal_threader_execute_in_arena(std::int32_t max_concurrency,
+                                                     std::int32_t numa_node,
+                                                     const void *a,
+                                                     oneapi::dal::preview::arena_functype func);
+
 ONEDAL_EXPORT std::int64_t _onedal_parallel_reduce_int32_int64(
     std::int32_t n,
     std::int64_t init,
@@ -175,6 +181,24 @@ inline ONEDAL_EXPORT void threader_for_int32ptr(const std::int32_t *begin,
     _onedal_threader_for_int32ptr(begin, end, a, threader_func_int32ptr<F>);
 }
 
+template <typename F>
+inline void threader_func_arena(const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
+/// Runs the lambda in the task arena limited by `max_concurrency` threads and
+/// bound to the `numa_node`. Non-positive `max_concurrency` and negative
+/// `numa_node` mean no limitation
+template <typename F>
+inline ONEDAL_EXPORT void threader_execute_in_arena(std::int32_t max_concurrency,
+                                                    std::int32_t numa_node,
+                                                    const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_threader_execute_in_arena(max_concurrency, numa_node, a, threader_func_arena<F>);
+}
+
 template <typename F>
 inline std::int64_t parallel_reduce_loop_int32_int64(std::int32_t start_idx,
                                                      std::int32_t end_idx,
@@ -283,6 +307,14 @@ inline void atomic_decrement(std::int64_t &value, std::int64_t delta = 1) {
 #endif
 }
 
+inline std::int64_t atomic_fetch_add(std::int64_t &value, std::int64_t delta = 1) {
+#if defined(_WIN32) || defined(_WIN64)
+    return _InterlockedExchangeAdd64(&value, delta);
+#else
+    return __atomic_fetch_add(&value, delta, __ATOMIC_SEQ_CST);
+#endif
+}
+
 inline std::int64_t atomic_load(std::int64_t &value) {
 #if defined(_WIN32) || defined(_WIN64)
     const std::int64_t result = value;
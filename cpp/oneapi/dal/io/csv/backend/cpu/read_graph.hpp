@@ -16,23 +16,29 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/common.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/io/csv/backend/mapped_file.hpp"
 #include "oneapi/dal/io/csv/detail/common.hpp"
+#include "oneapi/dal/io/csv/detail/parallel_scan.hpp"
 
 namespace oneapi::dal::preview::csv::backend {
 
 template <typename Cpu>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
-    std::int32_t max_id = edges[0].first;
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        std::int32_t edge_max = std::max(edges[i].first, edges[i].second);
-        max_id = std::max(max_id, edge_max);
-    }
-    const std::int64_t vertex_count = max_id + 1;
+    const std::int32_t max_id =
+        detail::parallel_max<std::int32_t>(edges.size(), [&](std::int64_t i) {
+            return std::max(edges[i].first, edges[i].second);
+        });
+    const std::int64_t vertex_count = std::int64_t(max_id) + 1;
     return vertex_count;
 }
 
@@ -40,13 +46,124 @@ template <typename Cpu>
 std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
+    return detail::parallel_prefix_sum<std::int64_t>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return degrees[i];
+        },
+        edge_offsets);
+}
+
+inline bool is_edge_list_separator(char c) {
+    return c == ' ' || c == '\t' || c == ',';
+}
+
+inline bool is_edge_list_comment(char c) {
+    return c == '#' || c == '%';
+}
+
+inline const char *skip_edge_list_separators(const char *p, const char *end) {
+    while (p < end && is_edge_list_separator(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+/// Returns true if the line does not contain an edge: it is empty or is a comment
+inline bool is_edge_list_skipped_line(const char *p, const char *end) {
+    p = skip_edge_list_separators(p, end);
+    return p == end || dal::csv::backend::is_line_end(*p) || is_edge_list_comment(*p);
+}
+
+inline bool parse_edge_field(const char *&p, const char *end, std::int32_t &value) {
+    p = skip_edge_list_separators(p, end);
+    return dal::csv::backend::parse_integer(p, end, value);
+}
+
+/// Parses the vertex ID, which unlike the integer weight must be non-negative
+inline bool parse_vertex_id(const char *&p, const char *end, std::int32_t &value) {
+    return parse_edge_field(p, end, value) && value >= 0;
+}
+
+inline bool parse_edge_field(const char *&p, const char *end, double &value) {
+    p = skip_edge_list_separators(p, end);
+    return dal::csv::backend::parse_number(p, end, ' ', value);
+}
+
+inline bool parse_edge_line_end(const char *&p, const char *end) {
+    p = skip_edge_list_separators(p, end);
+    return p == end || dal::csv::backend::is_line_end(*p);
+}
+
+inline bool parse_edge(const char *&p,
+                       const char *end,
+                       std::pair<std::int32_t, std::int32_t> &edge) {
+    return parse_vertex_id(p, end, edge.first) && parse_vertex_id(p, end, edge.second) &&
+           parse_edge_line_end(p, end);
+}
+
+template <typename Weight>
+inline bool parse_edge(const char *&p,
+                       const char *end,
+                       std::tuple<std::int32_t, std::int32_t, Weight> &edge) {
+    return parse_vertex_id(p, end, std::get<0>(edge)) &&
+           parse_vertex_id(p, end, std::get<1>(edge)) &&
+           parse_edge_field(p, end, std::get<2>(edge)) && parse_edge_line_end(p, end);
+}
+
+/// Reads the text edge list mapped into memory in parallel. Every non-empty line
+/// that is not a comment contains one edge. The first pass counts edges in the
+/// line-aligned chunks, the second pass parses the chunks directly into their
+/// ranges of the edge list.
+template <typename Cpu, typename EdgeList>
+void read_edge_list(const std::string &file_name, EdgeList &elist) {
+    const dal::csv::backend::mapped_file file{ file_name };
+
+    const auto boundaries = dal::csv::backend::split_by_lines_for_threads(file.begin(), file.end());
+    const auto boundaries_ptr = boundaries.get_data();
+    const std::int64_t chunk_count = boundaries.get_count() - 1;
+
+    auto edge_offsets = array<std::int64_t>::empty(chunk_count + 1);
+    auto edge_offsets_ptr = edge_offsets.get_mutable_data();
+
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t edge_count = 0;
+        const char *chunk_end = boundaries_ptr[i + 1];
+        for (const char *p = boundaries_ptr[i]; p < chunk_end;
+             p = dal::csv::backend::find_next_line(p, chunk_end)) {
+            edge_count += !is_edge_list_skipped_line(p, chunk_end);
+        }
+        edge_offsets_ptr[i + 1] = edge_count;
+    });
+
+    edge_offsets_ptr[0] = 0;
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        edge_offsets_ptr[i + 1] += edge_offsets_ptr[i];
+    }
+
+    elist.resize(edge_offsets_ptr[chunk_count]);
+    auto edges = elist.get_mutable_data();
+
+    std::atomic<bool> is_parsed{ true };
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        auto edge = edges + edge_offsets_ptr[i];
+        const char *chunk_end = boundaries_ptr[i + 1];
+        for (const char *p = boundaries_ptr[i]; p < chunk_end;
+             p = dal::csv::backend::find_next_line(p, chunk_end)) {
+            if (is_edge_list_skipped_line(p, chunk_end)) {
+                continue;
+            }
+            if (!parse_edge(p, chunk_end, *edge)) {
+                is_parsed.store(false, std::memory_order_relaxed);
+                return;
+            }
+            ++edge;
+        }
+    });
+
+    if (!is_parsed.load()) {
+        throw invalid_argument(dal::detail::error_messages::invalid_edge_list_format());
     }
-    return total_sum_degrees;
 }
 
 template <typename Cpu>
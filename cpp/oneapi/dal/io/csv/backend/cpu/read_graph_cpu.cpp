@@ -21,6 +21,15 @@ namespace oneapi::dal::preview::csv::backend {
 template std::int64_t get_vertex_count_from_edge_list<__CPU_TAG__>(
     const edge_list<std::int32_t> &edges);
 
+template void read_edge_list<__CPU_TAG__>(const std::string &file_name,
+                                          edge_list<std::int32_t> &elist);
+
+template void read_edge_list<__CPU_TAG__>(const std::string &file_name,
+                                          weighted_edge_list<std::int32_t, std::int32_t> &elist);
+
+template void read_edge_list<__CPU_TAG__>(const std::string &file_name,
+                                          weighted_edge_list<std::int32_t, double> &elist);
+
 template std::int64_t compute_prefix_sum<__CPU_TAG__>(const std::int32_t *degrees,
                                                       std::int64_t degrees_count,
                                                       std::int64_t *edge_offsets);
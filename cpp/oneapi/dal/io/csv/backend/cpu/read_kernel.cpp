@@ -23,21 +23,27 @@
 
 #endif
 
+#include <atomic>
+
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/text_parser.hpp"
+#include "oneapi/dal/io/csv/backend/mapped_file.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
+using csv_float_t = DAAL_DATA_TYPE;
+
+/// Reads the file line by line via the DAAL data source. This path handles
+/// categorical features and missing values that the native parser does not support.
+static table read_with_feature_manager(const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -52,8 +58,146 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
     daal_data_source.loadDataBlock();
     interop::status_to_exception(daal_data_source.status());
 
-    return oneapi::dal::backend::interop::convert_from_daal_homogen_table<DAAL_DATA_TYPE>(
+    return interop::convert_from_daal_homogen_table<csv_float_t>(
         daal_data_source.getNumericTable());
 }
 
+static std::int64_t count_fields(const char* p, const char* end, char delimiter) {
+    std::int64_t count = 1;
+    for (; p < end && !is_line_end(*p); ++p) {
+        count += (*p == delimiter);
+    }
+    return count;
+}
+
+/// Parses all non-empty lines of the chunk into the row-major block `rows`.
+/// Returns false if the chunk contains a non-numeric or missing value, or
+/// the line with unexpected number of fields.
+static bool parse_chunk(const char* p,
+                        const char* end,
+                        char delimiter,
+                        std::int64_t column_count,
+                        csv_float_t* rows) {
+    while (p < end) {
+        if (is_empty_line(p, end, delimiter)) {
+            p = find_next_line(p, end);
+            continue;
+        }
+
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            while (p < end && is_blank(*p, delimiter)) {
+                ++p;
+            }
+
+            double value;
+            if (!parse_number(p, end, delimiter, value)) {
+                return false;
+            }
+            rows[j] = static_cast<csv_float_t>(value);
+
+            while (p < end && is_blank(*p, delimiter)) {
+                ++p;
+            }
+
+            const bool is_last_field = (j + 1 == column_count);
+            if (is_last_field) {
+                if (p < end && !is_line_end(*p)) {
+                    return false;
+                }
+            }
+            else {
+                if (p == end || *p != delimiter) {
+                    return false;
+                }
+                ++p;
+            }
+        }
+
+        rows += column_count;
+        p = find_next_line(p, end);
+    }
+    return true;
+}
+
+/// Parses the file mapped into memory in parallel. The text is split into
+/// line-aligned chunks, the first pass counts rows in each chunk, the second pass
+/// parses the chunks directly into their rows of the resulting table.
+/// Returns an empty table if the file cannot be handled by the native parser.
+static table read_mapped(const detail::data_source_base& ds) {
+    const mapped_file file{ ds.get_file_name() };
+    const char delimiter = ds.get_delimiter();
+
+    const char* begin = file.begin();
+    const char* const end = file.end();
+    if (ds.get_parse_header()) {
+        begin = find_next_line(begin, end);
+    }
+    while (begin < end && is_empty_line(begin, end, delimiter)) {
+        begin = find_next_line(begin, end);
+    }
+    if (begin == end) {
+        return table{};
+    }
+
+    const std::int64_t column_count = count_fields(begin, end, delimiter);
+
+    const auto boundaries = split_by_lines_for_threads(begin, end);
+    const auto boundaries_ptr = boundaries.get_data();
+    const std::int64_t chunk_count = boundaries.get_count() - 1;
+    ONEDAL_ASSERT(chunk_count <= dal::detail::limits<std::int32_t>::max());
+
+    auto row_offsets = array<std::int64_t>::empty(chunk_count + 1);
+    auto row_offsets_ptr = row_offsets.get_mutable_data();
+
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t row_count = 0;
+        const char* chunk_end = boundaries_ptr[i + 1];
+        for (const char* p = boundaries_ptr[i]; p < chunk_end; p = find_next_line(p, chunk_end)) {
+            row_count += !is_empty_line(p, chunk_end, delimiter);
+        }
+        row_offsets_ptr[i + 1] = row_count;
+    });
+
+    row_offsets_ptr[0] = 0;
+    for (std::int64_t i = 0; i < chunk_count; ++i) {
+        row_offsets_ptr[i + 1] += row_offsets_ptr[i];
+    }
+    const std::int64_t row_count = row_offsets_ptr[chunk_count];
+
+    auto data = array<csv_float_t>::empty(dal::detail::check_mul_overflow(row_count, column_count));
+    auto data_ptr = data.get_mutable_data();
+
+    std::atomic<bool> is_parsed{ true };
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        if (!is_parsed.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const bool chunk_parsed = parse_chunk(boundaries_ptr[i],
+                                              boundaries_ptr[i + 1],
+                                              delimiter,
+                                              column_count,
+                                              data_ptr + row_offsets_ptr[i] * column_count);
+        if (!chunk_parsed) {
+            is_parsed.store(false, std::memory_order_relaxed);
+        }
+    });
+
+    if (!is_parsed.load()) {
+        return table{};
+    }
+
+    return homogen_table::wrap(data, row_count, column_count);
+}
+
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    const table result = read_mapped(ds);
+    if (result.has_data()) {
+        return result;
+    }
+    return read_with_feature_manager(ds);
+}
+
 } // namespace oneapi::dal::csv::backend
@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/csv/detail/read_graph_service.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Helpers for parsing text files that are mapped into memory. The text is not
+/// null-terminated, so every routine accepts the end of the buffer explicitly.
+
+inline bool is_line_end(char c) {
+    return c == '\n' || c == '\r';
+}
+
+inline bool is_blank(char c, char delimiter) {
+    return (c == ' ' || c == '\t') && c != delimiter;
+}
+
+/// Returns a pointer to the first character of the next line. Lines may end
+/// with '\n', "\r\n" or a lone '\r'.
+inline const char* find_next_line(const char* p, const char* end) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+    const char* const search_end = line_end ? line_end : end;
+    const char* const carriage_return =
+        static_cast<const char*>(std::memchr(p, '\r', static_cast<std::size_t>(search_end - p)));
+    if (carriage_return && carriage_return + 1 != line_end) {
+        return carriage_return + 1;
+    }
+    return line_end ? line_end + 1 : end;
+}
+
+/// Returns true if `p` points to the beginning of a line within [begin, end)
+inline bool is_line_begin(const char* begin, const char* p, const char* end) {
+    return p == begin || p == end || p[-1] == '\n' || (p[-1] == '\r' && *p != '\n');
+}
+
+/// Returns true if the line starting from `p` consists of blank characters only
+inline bool is_empty_line(const char* p, const char* end, char delimiter) {
+    while (p < end && is_blank(*p, delimiter)) {
+        ++p;
+    }
+    return p == end || is_line_end(*p);
+}
+
+/// Splits [begin, end) into at most `max_chunk_count` chunks, each chunk starts at
+/// the beginning of a line. Returns the array of `chunk_count + 1` boundaries.
+inline array<const char*> split_by_lines(const char* begin,
+                                         const char* end,
+                                         std::int64_t min_chunk_size,
+                                         std::int64_t max_chunk_count) {
+    const std::int64_t size = end - begin;
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(1, std::min(max_chunk_count, size / min_chunk_size));
+
+    auto boundaries = array<const char*>::empty(chunk_count + 1);
+    auto boundaries_ptr = boundaries.get_mutable_data();
+
+    boundaries_ptr[0] = begin;
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        const char* nominal = begin + (size / chunk_count) * i;
+        // Nominal boundary may fall behind the previous one if the previous line is long
+        nominal = std::max(nominal, boundaries_ptr[i - 1]);
+        boundaries_ptr[i] =
+            is_line_begin(begin, nominal, end) ? nominal : find_next_line(nominal, end);
+    }
+    boundaries_ptr[chunk_count] = end;
+
+    return boundaries;
+}
+
+/// Splits the text into chunks that are well balanced between threads
+inline array<const char*> split_by_lines_for_threads(const char* begin, const char* end) {
+    constexpr std::int64_t min_chunk_size = 1 << 20;
+    constexpr std::int64_t chunks_per_thread = 16;
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    return split_by_lines(begin, end, min_chunk_size, thread_count * chunks_per_thread);
+}
+
+/// Parses decimal integer. Returns false if there are no digits or the value
+/// overflows the `Integer` type. Advances `p` after the parsed number.
+template <typename Integer>
+inline bool parse_integer(const char*& p, const char* end, Integer& value) {
+    static_assert(sizeof(Integer) < sizeof(std::int64_t));
+    const char* q = p;
+
+    bool negative = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+        negative = (*q == '-');
+        ++q;
+    }
+
+    const char* const digits_begin = q;
+    std::int64_t result = 0;
+    while (q < end && *q >= '0' && *q <= '9') {
+        result = result * 10 + (*q - '0');
+        if (result > dal::detail::limits<Integer>::max()) {
+            return false;
+        }
+        ++q;
+    }
+    if (q == digits_begin) {
+        return false;
+    }
+
+    value = static_cast<Integer>(negative ? -result : result);
+    p = q;
+    return true;
+}
+
+/// Parses the number token via the generic library routine. The token is copied
+/// to the null-terminated buffer as mapped text is not null-terminated.
+inline bool parse_number_slow(const char*& p, const char* end, char delimiter, double& value) {
+    constexpr std::int64_t max_token_size = 127;
+    char token[max_token_size + 1];
+
+    std::int64_t size = 0;
+    while (p + size < end && size < max_token_size && !is_line_end(p[size]) &&
+           p[size] != delimiter && p[size] != ' ' && p[size] != '\t') {
+        token[size] = p[size];
+        ++size;
+    }
+    token[size] = '\0';
+
+    char* token_end = token;
+    value = dal::preview::csv::detail::daal_string_to_double(token, &token_end);
+    if (token_end == token) {
+        return false;
+    }
+    p += token_end - token;
+    return true;
+}
+
+/// Parses decimal floating-point number. Values with mantissa that fits into 2^53
+/// and decimal exponent within [-22, 22] are computed exactly with single
+/// multiplication or division (Clinger's fast path). All other values are
+/// delegated to the generic routine. Advances `p` after the parsed number.
+inline bool parse_number(const char*& p, const char* end, char delimiter, double& value) {
+    static constexpr double exact_powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                                      1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                                      1e18, 1e19, 1e20, 1e21, 1e22 };
+    constexpr std::uint64_t max_exact_mantissa = std::uint64_t(1) << 53;
+    constexpr std::int32_t max_exact_exponent = 22;
+    constexpr std::int32_t max_mantissa_digits = 19;
+
+    const char* const start = p;
+    const char* q = p;
+
+    bool negative = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+        negative = (*q == '-');
+        ++q;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int32_t digit_count = 0;
+    std::int32_t exponent = 0;
+
+    const char* const digits_begin = q;
+    while (q < end && *q >= '0' && *q <= '9') {
+        if (digit_count < max_mantissa_digits) {
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*q - '0');
+            digit_count += (mantissa > 0);
+        }
+        else {
+            ++exponent;
+        }
+        ++q;
+    }
+    bool has_digits = (q != digits_begin);
+
+    if (q < end && *q == '.') {
+        ++q;
+        const char* const fraction_begin = q;
+        while (q < end && *q >= '0' && *q <= '9') {
+            if (digit_count < max_mantissa_digits) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(*q - '0');
+                digit_count += (mantissa > 0);
+                --exponent;
+            }
+            ++q;
+        }
+        has_digits = has_digits || (q != fraction_begin);
+    }
+
+    if (!has_digits) {
+        // Special values like 'nan' or 'inf'
+        p = start;
+        return parse_number_slow(p, end, delimiter, value);
+    }
+
+    if (q < end && (*q == 'e' || *q == 'E')) {
+        const char* r = q + 1;
+        bool negative_exponent = false;
+        if (r < end && (*r == '-' || *r == '+')) {
+            negative_exponent = (*r == '-');
+            ++r;
+        }
+        if (r < end && *r >= '0' && *r <= '9') {
+            std::int32_t explicit_exponent = 0;
+            while (r < end && *r >= '0' && *r <= '9') {
+                if (explicit_exponent < 100000) {
+                    explicit_exponent = explicit_exponent * 10 + (*r - '0');
+                }
+                ++r;
+            }
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+            q = r;
+        }
+    }
+
+    if (digit_count >= max_mantissa_digits || mantissa > max_exact_mantissa ||
+        exponent > max_exact_exponent || exponent < -max_exact_exponent) {
+        p = start;
+        return parse_number_slow(p, end, delimiter, value);
+    }
+
+    double result = static_cast<double>(mantissa);
+    result = (exponent < 0) ? result / exact_powers_of_ten[-exponent]
+                            : result * exact_powers_of_ten[exponent];
+    value = negative ? -result : result;
+    p = q;
+    return true;
+}
+
+} // namespace oneapi::dal::csv::backend
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/io/csv/backend/mapped_file.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oneapi::dal::csv::backend {
+
+#if defined(_WIN32) || defined(_WIN64)
+
+mapped_file::mapped_file(const std::string& file_name) {
+    HANDLE file = CreateFileA(file_name.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw internal_error(dal::detail::error_messages::file_cannot_be_mapped());
+    }
+    size_ = static_cast<std::int64_t>(size.QuadPart);
+
+    if (size_ == 0) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw internal_error(dal::detail::error_messages::file_cannot_be_mapped());
+    }
+    mapping_handle_ = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw internal_error(dal::detail::error_messages::file_cannot_be_mapped());
+    }
+    data_ = static_cast<const char*>(view);
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+}
+
+#else
+
+mapped_file::mapped_file(const std::string& file_name) {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+    file_descriptor_ = fd;
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw internal_error(dal::detail::error_messages::file_cannot_be_mapped());
+    }
+    size_ = static_cast<std::int64_t>(file_stat.st_size);
+
+    if (size_ == 0) {
+        return;
+    }
+
+    void* addr = mmap(nullptr, static_cast<std::size_t>(size_), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        close(fd);
+        throw internal_error(dal::detail::error_messages::file_cannot_be_mapped());
+    }
+
+    // Chunks of the file are parsed by different threads in a streaming manner,
+    // so let the kernel read ahead aggressively
+    madvise(addr, static_cast<std::size_t>(size_), MADV_WILLNEED);
+    data_ = static_cast<const char*>(addr);
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), static_cast<std::size_t>(size_));
+    }
+    if (file_descriptor_ >= 0) {
+        close(file_descriptor_);
+    }
+}
+
+#endif
+
+} // namespace oneapi::dal::csv::backend
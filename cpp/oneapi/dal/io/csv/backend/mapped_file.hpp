@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Read-only view of the whole file mapped into the address space of the process.
+/// The mapping is released when the object goes out of scope.
+class mapped_file : public base {
+public:
+    explicit mapped_file(const std::string& file_name);
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* get_data() const {
+        return data_;
+    }
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+    const char* begin() const {
+        return data_;
+    }
+
+    const char* end() const {
+        return data_ + size_;
+    }
+
+private:
+    const char* data_ = nullptr;
+    std::int64_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#else
+    int file_descriptor_ = -1;
+#endif
+};
+
+} // namespace oneapi::dal::csv::backend
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <fstream>
+
+#include "oneapi/dal/io/csv/detail/binary_graph_format.hpp"
+#include "oneapi/dal/io/csv/detail/parallel_scan.hpp"
+#include "oneapi/dal/io/csv/backend/mapped_file.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::preview::csv::detail {
+
+ONEDAL_EXPORT bool read_binary_graph_header(const std::string &file_name,
+                                            binary_graph_header &header) {
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.is_open()) {
+        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    }
+
+    file.read(reinterpret_cast<char *>(&header), sizeof(binary_graph_header));
+    if (file.gcount() != sizeof(binary_graph_header)) {
+        return false;
+    }
+    return std::memcmp(header.magic, binary_graph_magic, sizeof(binary_graph_magic)) == 0;
+}
+
+ONEDAL_EXPORT void read_binary_graph_section(const std::string &file_name,
+                                             std::int64_t offset,
+                                             std::int64_t size,
+                                             void *data) {
+    const dal::csv::backend::mapped_file file{ file_name };
+    if (offset < 0 || size < 0 || offset + size > file.get_size()) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_binary_graph_file());
+    }
+
+    const char *source = file.get_data() + offset;
+    char *destination = static_cast<char *>(data);
+    parallel_for_blocks(size, [&](std::int64_t begin, std::int64_t end) {
+        std::memcpy(destination + begin, source + begin, end - begin);
+    });
+}
+
+} // namespace oneapi::dal::preview::csv::detail
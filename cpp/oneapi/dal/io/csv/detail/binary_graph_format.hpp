@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::preview::csv::detail {
+
+/// Binary graph file layout. All sections are stored in the native byte order
+/// and start at offsets aligned to `binary_graph_alignment` bytes:
+///
+/// - edge list:  header | (source, destination) pairs of vertex type | weights
+/// - CSR:        header | offsets (vertex_count + 1 of edge type)
+///                      | neighbors (neighbor_count of vertex type) | weights
+///
+/// The arrays are copied to the graph as is, so loading does not require parsing.
+
+enum class binary_graph_kind : std::uint32_t { edge_list = 1, csr = 2 };
+
+enum class binary_graph_weight_type : std::uint32_t { none = 0, int32 = 1, float64 = 2 };
+
+constexpr char binary_graph_magic[8] = { 'O', 'N', 'E', 'D', 'A', 'L', 'G', 'R' };
+constexpr std::uint32_t binary_graph_version = 1;
+constexpr std::int64_t binary_graph_alignment = 64;
+
+/// Upper limit for `vertex_count` and `element_count` that keeps the offsets and
+/// sizes of all sections within std::int64_t
+constexpr std::int64_t max_binary_graph_element_count =
+    dal::detail::limits<std::int64_t>::max() / (4 * binary_graph_alignment);
+
+struct binary_graph_header {
+    char magic[8];
+    std::uint32_t version;
+    binary_graph_kind kind;
+    binary_graph_weight_type weight_type;
+    std::uint32_t is_directed;
+    std::uint32_t vertex_size;
+    std::uint32_t edge_size;
+    std::int64_t vertex_count;
+    /// Number of edges for the edge list and number of neighbors for CSR
+    std::int64_t element_count;
+};
+
+inline std::int64_t align_binary_graph_offset(std::int64_t offset) {
+    return (offset + binary_graph_alignment - 1) / binary_graph_alignment *
+           binary_graph_alignment;
+}
+
+template <typename Weight>
+constexpr binary_graph_weight_type get_binary_graph_weight_type() {
+    return binary_graph_weight_type::none;
+}
+
+template <>
+constexpr binary_graph_weight_type get_binary_graph_weight_type<std::int32_t>() {
+    return binary_graph_weight_type::int32;
+}
+
+template <>
+constexpr binary_graph_weight_type get_binary_graph_weight_type<double>() {
+    return binary_graph_weight_type::float64;
+}
+
+/// Reads the header of the file. Returns false if the file is not a binary graph file.
+ONEDAL_EXPORT bool read_binary_graph_header(const std::string &file_name,
+                                            binary_graph_header &header);
+
+/// Copies `size` bytes starting from the `offset` of the file to `data` in parallel
+ONEDAL_EXPORT void read_binary_graph_section(const std::string &file_name,
+                                             std::int64_t offset,
+                                             std::int64_t size,
+                                             void *data);
+
+} // namespace oneapi::dal::preview::csv::detail
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::preview::csv::detail {
+
+/// Number of elements processed by one task in the blocked parallel loops below
+constexpr std::int64_t parallel_scan_block_size = 1 << 16;
+
+inline std::int64_t get_parallel_scan_block_count(std::int64_t count) {
+    return std::max<std::int64_t>(1,
+                                  (count + parallel_scan_block_size - 1) /
+                                      parallel_scan_block_size);
+}
+
+/// Calls `body(begin, end)` for the consecutive blocks of [0, count) in parallel
+template <typename Body>
+inline void parallel_for_blocks(std::int64_t count, Body &&body) {
+    const std::int64_t block_count = get_parallel_scan_block_count(count);
+    ONEDAL_ASSERT(block_count <= dal::detail::limits<std::int32_t>::max());
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t b) {
+        const std::int64_t begin = b * parallel_scan_block_size;
+        const std::int64_t end = std::min(count, begin + parallel_scan_block_size);
+        body(begin, end);
+    });
+}
+
+/// Returns true if `pred(i)` holds for every i in [0, count). Checked in parallel,
+/// the remaining blocks are skipped once a violation is found.
+template <typename Pred>
+inline bool parallel_all_of(std::int64_t count, Pred &&pred) {
+    std::atomic<bool> result{ true };
+    parallel_for_blocks(count, [&](std::int64_t begin, std::int64_t end) {
+        if (!result.load(std::memory_order_relaxed)) {
+            return;
+        }
+        for (std::int64_t i = begin; i < end; ++i) {
+            if (!pred(i)) {
+                result.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    return result.load();
+}
+
+/// Computes the maximum of `get(i)` over [0, count) in parallel. `count` should be positive.
+template <typename Value, typename Get>
+inline Value parallel_max(std::int64_t count, Get &&get) {
+    const std::int64_t block_count = get_parallel_scan_block_count(count);
+    auto block_max = array<Value>::empty(block_count);
+    auto block_max_ptr = block_max.get_mutable_data();
+
+    parallel_for_blocks(count, [&](std::int64_t begin, std::int64_t end) {
+        Value local_max = get(begin);
+        for (std::int64_t i = begin + 1; i < end; ++i) {
+            local_max = std::max(local_max, get(i));
+        }
+        block_max_ptr[begin / parallel_scan_block_size] = local_max;
+    });
+
+    return *std::max_element(block_max_ptr, block_max_ptr + block_count);
+}
+
+/// Computes exclusive prefix sum of `get(i)` over [0, count) into `offsets`
+/// of size `count + 1` in parallel. Returns the total sum.
+template <typename Sum, typename Get, typename Offset>
+inline Sum parallel_prefix_sum(std::int64_t count, Get &&get, Offset *offsets) {
+    offsets[0] = 0;
+    if (count == 0) {
+        return 0;
+    }
+
+    const std::int64_t block_count = get_parallel_scan_block_count(count);
+    auto block_sums = array<Sum>::empty(block_count + 1);
+    auto block_sums_ptr = block_sums.get_mutable_data();
+
+    parallel_for_blocks(count, [&](std::int64_t begin, std::int64_t end) {
+        Sum local_sum = 0;
+        for (std::int64_t i = begin; i < end; ++i) {
+            local_sum += get(i);
+        }
+        block_sums_ptr[begin / parallel_scan_block_size + 1] = local_sum;
+    });
+
+    block_sums_ptr[0] = 0;
+    for (std::int64_t b = 0; b < block_count; ++b) {
+        block_sums_ptr[b + 1] += block_sums_ptr[b];
+    }
+
+    parallel_for_blocks(count, [&](std::int64_t begin, std::int64_t end) {
+        Sum running_sum = block_sums_ptr[begin / parallel_scan_block_size];
+        for (std::int64_t i = begin; i < end; ++i) {
+            running_sum += get(i);
+            offsets[i + 1] = running_sum;
+        }
+    });
+
+    return block_sums_ptr[block_count];
+}
+
+} // namespace oneapi::dal::preview::csv::detail
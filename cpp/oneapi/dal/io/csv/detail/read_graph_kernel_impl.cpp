@@ -20,6 +20,33 @@
 
 namespace oneapi::dal::preview::csv::detail {
 
+template <>
+ONEDAL_EXPORT void read_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
+    dal::backend::dispatch_by_cpu(
+        dal::backend::context_cpu{ dal::detail::host_policy::get_default() },
+        [&](auto cpu) {
+            return backend::read_edge_list<decltype(cpu)>(name, elist);
+        });
+}
+
+ONEDAL_EXPORT void read_edge_list(const std::string &name,
+                                  weighted_edge_list<std::int32_t, std::int32_t> &elist) {
+    dal::backend::dispatch_by_cpu(
+        dal::backend::context_cpu{ dal::detail::host_policy::get_default() },
+        [&](auto cpu) {
+            return backend::read_edge_list<decltype(cpu)>(name, elist);
+        });
+}
+
+ONEDAL_EXPORT void read_edge_list(const std::string &name,
+                                  weighted_edge_list<std::int32_t, double> &elist) {
+    dal::backend::dispatch_by_cpu(
+        dal::backend::context_cpu{ dal::detail::host_policy::get_default() },
+        [&](auto cpu) {
+            return backend::read_edge_list<decltype(cpu)>(name, elist);
+        });
+}
+
 template <>
 ONEDAL_EXPORT std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                               std::int64_t degrees_count,
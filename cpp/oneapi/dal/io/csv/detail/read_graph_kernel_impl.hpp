@@ -19,14 +19,17 @@
 #include <algorithm>
 #include <atomic>
 #include <fstream>
+#include <memory>
 
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/common.hpp"
 #include "oneapi/dal/graph/detail/undirected_adjacency_vector_graph_impl.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/csv/detail/binary_graph_format.hpp"
 #include "oneapi/dal/io/csv/detail/read_graph_service.hpp"
 #include "oneapi/dal/io/csv/detail/common.hpp"
+#include "oneapi/dal/io/csv/detail/parallel_scan.hpp"
 
 namespace oneapi::dal::preview::csv::detail {
 
@@ -34,22 +37,13 @@ template <typename EdgeList>
 inline void read_edge_list(const std::string &name, EdgeList &elist);
 
 template <>
-inline void read_edge_list(const std::string &name, edge_list<std::int32_t> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
-    }
+ONEDAL_EXPORT void read_edge_list(const std::string &name, edge_list<std::int32_t> &elist);
 
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
-    }
+ONEDAL_EXPORT void read_edge_list(const std::string &name,
+                                  weighted_edge_list<std::int32_t, std::int32_t> &elist);
 
-    file.close();
-}
+ONEDAL_EXPORT void read_edge_list(const std::string &name,
+                                  weighted_edge_list<std::int32_t, double> &elist);
 
 template <typename Vertex, typename Weight>
 inline void read_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
@@ -72,13 +66,12 @@ inline void read_edge_list(const std::string &name, weighted_edge_list<Vertex, W
 
 template <typename EdgeList>
 std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
-    auto max_id = std::get<0>(edges[0]);
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        auto edge_max = std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
-        max_id = std::max(max_id, edge_max);
-    }
+    using vertex_t = std::decay_t<decltype(std::get<0>(edges[0]))>;
+    const vertex_t max_id = parallel_max<vertex_t>(edges.size(), [&](std::int64_t i) {
+        return std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
+    });
 
-    const std::int64_t vertex_count = max_id + 1;
+    const std::int64_t vertex_count = std::int64_t(max_id) + 1;
     return vertex_count;
 }
 
@@ -129,26 +122,24 @@ template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
 EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
                                     std::int64_t degrees_count,
                                     AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return static_cast<EdgeIndex>(degrees[i].load());
+        },
+        edge_offsets_atomic);
 }
 
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
                              EdgeIndex *edge_offsets) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return static_cast<EdgeIndex>(degrees[i]);
+        },
+        edge_offsets);
 }
 
 template <>
@@ -308,6 +299,30 @@ ONEDAL_EXPORT void filter_neighbors_and_fill_new_degrees<std::int32_t, std::int6
     std::int32_t *new_degrees,
     std::int64_t vertex_count);
 
+/// Stores the copy of CSR offsets in the vertex index type if they fit into it
+template <typename GraphImpl, typename Edge>
+void set_rows_vertex(GraphImpl &graph_impl,
+                     std::int64_t vertex_count,
+                     const Edge *edge_offsets_data,
+                     std::int64_t total_sum_degrees) {
+    if (total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
+        using vertex_edge_t = typename GraphImpl::vertex_edge_type;
+        using vertex_edge_set = typename GraphImpl::vertex_edge_set;
+        using vertex_edge_allocator_type = typename GraphImpl::vertex_edge_allocator_type;
+
+        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
+        vertex_edge_t *rows_vertex =
+            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
+
+        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
+            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
+        });
+
+        graph_impl.get_topology()._rows_vertex =
+            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
+    }
+}
+
 template <typename Graph>
 void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_type> &edges,
                          Graph &g) {
@@ -408,23 +423,7 @@ void convert_to_csr_impl(const edge_list<typename graph_traits<Graph>::vertex_ty
                             filtered_total_sum_degrees,
                             degrees_data);
 
-    if (filtered_total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
-        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
-        using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
-        using vertex_edge_allocator_type =
-            typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
-
-        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
-        vertex_edge_t *rows_vertex =
-            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
-
-        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
-            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
-        });
-
-        graph_impl.get_topology()._rows_vertex =
-            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
-    }
+    set_rows_vertex(graph_impl, vertex_count, edge_offsets_data, filtered_total_sum_degrees);
 
     return;
 }
@@ -549,25 +548,210 @@ void convert_to_csr_impl(
                             degrees_data);
     graph_impl.set_edge_values(vals, get_edges_count<Graph>{}(filtered_total_sum_degrees));
 
-    if (filtered_total_sum_degrees < oneapi::dal::detail::limits<std::int32_t>::max()) {
-        using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
-        using vertex_edge_set = typename graph_traits<Graph>::impl_type::vertex_edge_set;
-        using vertex_edge_allocator_type =
-            typename graph_traits<Graph>::impl_type::vertex_edge_allocator_type;
+    set_rows_vertex(graph_impl, vertex_count, edge_offsets_data, filtered_total_sum_degrees);
 
-        vertex_edge_allocator_type vertex_edge_allocator = graph_impl._vertex_edge_allocator;
-        vertex_edge_t *rows_vertex =
-            oneapi::dal::preview::detail::allocate(vertex_edge_allocator, vertex_count + 1);
+    return;
+}
 
-        dal::detail::threader_for_int64(vertex_count + 1, [&](std::int64_t u) {
-            rows_vertex[u] = static_cast<vertex_edge_t>(edge_offsets_data[u]);
-        });
+inline void check_binary_graph_header(const binary_graph_header &header,
+                                      std::int64_t vertex_size,
+                                      std::int64_t edge_size) {
+    if (header.version != binary_graph_version || header.vertex_size != vertex_size ||
+        header.edge_size != edge_size) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_binary_graph_file());
+    }
+    if (header.vertex_count < 0 || header.vertex_count > max_binary_graph_element_count ||
+        header.element_count < 0 || header.element_count > max_binary_graph_element_count) {
+        throw invalid_argument(dal::detail::error_messages::corrupted_binary_graph_file());
+    }
+}
 
-        graph_impl.get_topology()._rows_vertex =
-            vertex_edge_set::wrap(rows_vertex, vertex_count + 1);
+/// Checks that all vertex IDs of the edge list stored as consecutive pairs are non-negative
+template <typename Vertex>
+inline void check_binary_edge_list_vertices(const Vertex *vertices, std::int64_t edge_count) {
+    const bool is_valid = parallel_all_of(2 * edge_count, [&](std::int64_t i) {
+        return vertices[i] >= 0;
+    });
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::corrupted_binary_graph_file());
+    }
+}
+
+/// Checks that CSR offsets start from zero, do not decrease, end at `neighbor_count`
+/// and produce degrees representable by the vertex type, and that every neighbor
+/// is a valid vertex ID
+template <typename Vertex, typename Edge>
+inline bool is_valid_binary_csr(const Edge *offsets,
+                                const Vertex *neighbors,
+                                std::int64_t vertex_count,
+                                std::int64_t neighbor_count) {
+    if (offsets[0] != 0 || std::int64_t(offsets[vertex_count]) != neighbor_count) {
+        return false;
     }
+    const std::int64_t max_degree = dal::detail::limits<Vertex>::max();
+    const bool are_offsets_valid = parallel_all_of(vertex_count, [&](std::int64_t u) {
+        return offsets[u] <= offsets[u + 1] &&
+               std::int64_t(offsets[u + 1] - offsets[u]) <= max_degree;
+    });
+    return are_offsets_valid && parallel_all_of(neighbor_count, [&](std::int64_t i) {
+               return neighbors[i] >= 0 && std::int64_t(neighbors[i]) < vertex_count;
+           });
+}
 
-    return;
+template <typename Vertex>
+void read_binary_edge_list(const std::string &name,
+                           const binary_graph_header &header,
+                           edge_list<Vertex> &elist) {
+    using edge_t = std::pair<Vertex, Vertex>;
+    static_assert(sizeof(edge_t) == 2 * sizeof(Vertex));
+
+    check_binary_graph_header(header, sizeof(Vertex), sizeof(std::int64_t));
+
+    const std::int64_t edge_count = header.element_count;
+    elist.resize(edge_count);
+    read_binary_graph_section(name,
+                              align_binary_graph_offset(sizeof(binary_graph_header)),
+                              edge_count * sizeof(edge_t),
+                              elist.get_mutable_data());
+    check_binary_edge_list_vertices(reinterpret_cast<const Vertex *>(elist.get_data()),
+                                    edge_count);
+}
+
+template <typename Vertex, typename Weight>
+void read_binary_edge_list(const std::string &name,
+                           const binary_graph_header &header,
+                           weighted_edge_list<Vertex, Weight> &elist) {
+    check_binary_graph_header(header, sizeof(Vertex), sizeof(std::int64_t));
+    if (header.weight_type != get_binary_graph_weight_type<Weight>()) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_binary_graph_file());
+    }
+
+    const std::int64_t edge_count = header.element_count;
+    const std::int64_t vertices_offset = align_binary_graph_offset(sizeof(binary_graph_header));
+    const std::int64_t weights_offset =
+        align_binary_graph_offset(vertices_offset + 2 * edge_count * sizeof(Vertex));
+
+    auto vertices = array<Vertex>::empty(2 * edge_count);
+    auto weights = array<Weight>::empty(edge_count);
+    read_binary_graph_section(name,
+                              vertices_offset,
+                              2 * edge_count * sizeof(Vertex),
+                              vertices.get_mutable_data());
+    read_binary_graph_section(name,
+                              weights_offset,
+                              edge_count * sizeof(Weight),
+                              weights.get_mutable_data());
+    check_binary_edge_list_vertices(vertices.get_data(), edge_count);
+
+    elist.resize(edge_count);
+    const Vertex *vertices_ptr = vertices.get_data();
+    const Weight *weights_ptr = weights.get_data();
+    dal::detail::threader_for_int64(edge_count, [&](std::int64_t i) {
+        elist[i] = std::make_tuple(vertices_ptr[2 * i], vertices_ptr[2 * i + 1], weights_ptr[i]);
+    });
+}
+
+/// Loads CSR topology and edge values stored in the binary file directly to the graph
+template <typename Graph>
+void read_binary_csr(const std::string &name, const binary_graph_header &header, Graph &g) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_type = typename graph_traits<Graph>::edge_user_value_type;
+    constexpr bool is_edge_weighted =
+        !oneapi::dal::detail::is_one_of_v<edge_value_type, oneapi::dal::preview::empty_value>;
+
+    check_binary_graph_header(header, sizeof(vertex_t), sizeof(edge_t));
+    if (bool(header.is_directed) != is_directed<Graph>) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_binary_graph_file());
+    }
+    if (is_edge_weighted &&
+        header.weight_type != get_binary_graph_weight_type<edge_value_type>()) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_binary_graph_file());
+    }
+
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.element_count;
+    if (vertex_count == 0) {
+        throw invalid_argument(dal::detail::error_messages::empty_edge_list());
+    }
+    if (vertex_count > dal::detail::limits<vertex_t>::max() ||
+        neighbor_count > dal::detail::limits<edge_t>::max()) {
+        throw invalid_argument(dal::detail::error_messages::corrupted_binary_graph_file());
+    }
+
+    const std::int64_t offsets_offset = align_binary_graph_offset(sizeof(binary_graph_header));
+    const std::int64_t neighbors_offset =
+        align_binary_graph_offset(offsets_offset + (vertex_count + 1) * sizeof(edge_t));
+    const std::int64_t weights_offset =
+        align_binary_graph_offset(neighbors_offset + neighbor_count * sizeof(vertex_t));
+
+    auto &graph_impl = oneapi::dal::detail::get_impl(g);
+    auto &vertex_allocator = graph_impl._vertex_allocator;
+    auto &edge_allocator = graph_impl._edge_allocator;
+
+    edge_t *edge_offsets_data =
+        oneapi::dal::preview::detail::allocate(edge_allocator, vertex_count + 1);
+    vertex_t *vertex_neighbors =
+        oneapi::dal::preview::detail::allocate(vertex_allocator, neighbor_count);
+    vertex_t *degrees_data = oneapi::dal::preview::detail::allocate(vertex_allocator, vertex_count);
+
+    auto release = [&]() {
+        oneapi::dal::preview::detail::deallocate(edge_allocator,
+                                                 edge_offsets_data,
+                                                 vertex_count + 1);
+        oneapi::dal::preview::detail::deallocate(vertex_allocator,
+                                                 vertex_neighbors,
+                                                 neighbor_count);
+        oneapi::dal::preview::detail::deallocate(vertex_allocator, degrees_data, vertex_count);
+    };
+
+    try {
+        read_binary_graph_section(name,
+                                  offsets_offset,
+                                  (vertex_count + 1) * sizeof(edge_t),
+                                  edge_offsets_data);
+        read_binary_graph_section(name,
+                                  neighbors_offset,
+                                  neighbor_count * sizeof(vertex_t),
+                                  vertex_neighbors);
+    }
+    catch (...) {
+        release();
+        throw;
+    }
+
+    if (!is_valid_binary_csr(edge_offsets_data, vertex_neighbors, vertex_count, neighbor_count)) {
+        release();
+        throw invalid_argument(dal::detail::error_messages::corrupted_binary_graph_file());
+    }
+
+    dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
+        degrees_data[u] = static_cast<vertex_t>(edge_offsets_data[u + 1] - edge_offsets_data[u]);
+    });
+
+    graph_impl.set_topology(vertex_count,
+                            get_edges_count<Graph>{}(neighbor_count),
+                            edge_offsets_data,
+                            vertex_neighbors,
+                            neighbor_count,
+                            degrees_data);
+
+    if constexpr (is_edge_weighted) {
+        auto &edge_value_allocator = graph_impl._edge_user_value_allocator;
+        auto deallocate_vals = [&](edge_value_type *vals) {
+            oneapi::dal::preview::detail::deallocate(edge_value_allocator, vals, neighbor_count);
+        };
+        std::unique_ptr<edge_value_type, decltype(deallocate_vals)> vals(
+            oneapi::dal::preview::detail::allocate(edge_value_allocator, neighbor_count),
+            deallocate_vals);
+        read_binary_graph_section(name,
+                                  weights_offset,
+                                  neighbor_count * sizeof(edge_value_type),
+                                  vals.get());
+        graph_impl.set_edge_values(vals.release(), get_edges_count<Graph>{}(neighbor_count));
+    }
+
+    set_rows_vertex(graph_impl, vertex_count, edge_offsets_data, neighbor_count);
 }
 
 template <typename EdgeListType, typename Descriptor, typename DataSource>
@@ -575,8 +759,20 @@ void read_from_edgelist(EdgeListType &elist,
                         const DataSource &ds,
                         const Descriptor &desc,
                         typename Descriptor::object_t &graph) {
-    auto alloc = desc.get_allocator();
-    read_edge_list(ds.get_file_name(), elist);
+    const std::string file_name = ds.get_file_name();
+
+    binary_graph_header header;
+    if (read_binary_graph_header(file_name, header)) {
+        if (header.kind == binary_graph_kind::csr) {
+            read_binary_csr(file_name, header, graph);
+            return;
+        }
+        read_binary_edge_list(file_name, header, elist);
+    }
+    else {
+        read_edge_list(file_name, elist);
+    }
+
     convert_to_csr_impl(elist, graph);
     return;
 }
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class temporary_file {
+public:
+    temporary_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temporary_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+void check_table(const table& t,
+                 std::int64_t row_count,
+                 std::int64_t column_count,
+                 const std::vector<float>& expected) {
+    REQUIRE(t.get_row_count() == row_count);
+    REQUIRE(t.get_column_count() == column_count);
+
+    const auto data = row_accessor<const float>(t).pull();
+    REQUIRE(data.get_count() == std::int64_t(expected.size()));
+    for (std::int64_t i = 0; i < data.get_count(); i++) {
+        REQUIRE(data[i] == Approx(expected[i]));
+    }
+}
+
+TEST("can read numeric csv file") {
+    const temporary_file file{ "csv_read_numeric.csv",
+                               "1.5,2,-3\n"
+                               "4e1, 5.25 ,6\n"
+                               "\n"
+                               "-7.125,8E-1,+9\r\n" };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() });
+
+    check_table(t, 3, 3, { 1.5f, 2.0f, -3.0f, 40.0f, 5.25f, 6.0f, -7.125f, 0.8f, 9.0f });
+}
+
+TEST("can read csv file without trailing newline") {
+    const temporary_file file{ "csv_read_no_newline.csv", "1,2\n3,4" };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() });
+
+    check_table(t, 2, 2, { 1.0f, 2.0f, 3.0f, 4.0f });
+}
+
+TEST("can read csv file with carriage return line endings") {
+    const temporary_file file{ "csv_read_carriage_return.csv", "a,b\r1,2\r\r3,4\r5,6" };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() }.set_parse_header(true));
+
+    check_table(t, 3, 2, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f });
+}
+
+TEST("can read large csv file with carriage return line endings") {
+    constexpr std::int64_t row_count = 200000;
+
+    std::string content;
+    std::vector<float> expected;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        content += std::to_string(i) + "," + std::to_string(-i) + "\r";
+        expected.push_back(float(i));
+        expected.push_back(float(-i));
+    }
+    const temporary_file file{ "csv_read_large_carriage_return.csv", content };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() });
+
+    check_table(t, row_count, 2, expected);
+}
+
+TEST("can read csv file with header and custom delimiter") {
+    const temporary_file file{ "csv_read_header.csv",
+                               "a;b\n"
+                               "0.5;1\n"
+                               "2;3.5\n" };
+
+    const auto t = dal::read<table>(
+        data_source{ file.get_name() }.set_delimiter(';').set_parse_header(true));
+
+    check_table(t, 2, 2, { 0.5f, 1.0f, 2.0f, 3.5f });
+}
+
+TEST("can read large csv file split into several chunks") {
+    constexpr std::int64_t row_count = 200000;
+    constexpr std::int64_t column_count = 4;
+
+    std::string content;
+    std::vector<float> expected;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        for (std::int64_t j = 0; j < column_count; j++) {
+            const float value = float(i * column_count + j) / 4;
+            content += std::to_string(value);
+            content += (j + 1 == column_count) ? "\n" : ",";
+            expected.push_back(value);
+        }
+    }
+    const temporary_file file{ "csv_read_large.csv", content };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() });
+
+    check_table(t, row_count, column_count, expected);
+}
+
+TEST("can read csv file with categorical column") {
+    // Non-numeric values are not handled by the native parser,
+    // the file is read by the DAAL feature manager instead
+    const temporary_file file{ "csv_read_categorical.csv",
+                               "1.5,red\n"
+                               "2,green\n"
+                               "-3,red\n" };
+
+    const auto t = dal::read<table>(data_source{ file.get_name() });
+
+    REQUIRE(t.get_row_count() == 3);
+    REQUIRE(t.get_column_count() == 2);
+
+    const auto data = row_accessor<const float>(t).pull();
+    REQUIRE(data[0] == Approx(1.5f));
+    REQUIRE(data[2] == Approx(2.0f));
+    REQUIRE(data[4] == Approx(-3.0f));
+
+    INFO("equal categories are encoded by equal values");
+    REQUIRE(data[1] == data[5]);
+    REQUIRE(data[1] != data[3]);
+}
+
+TEST("throws if file does not exist") {
+    REQUIRE_THROWS_AS(dal::read<table>(data_source{ "csv_read_missing_file.csv" }),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::csv::test
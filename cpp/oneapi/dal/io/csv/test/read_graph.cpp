@@ -0,0 +1,243 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class temporary_graph_file {
+public:
+    explicit temporary_graph_file(const std::string& name) : name_(name) {}
+
+    temporary_graph_file(const std::string& name, const std::string& content) : name_(name) {
+        std::ofstream file(name_, std::ios::binary);
+        file << content;
+    }
+
+    ~temporary_graph_file() {
+        std::remove(name_.c_str());
+    }
+
+    const std::string& get_name() const {
+        return name_;
+    }
+
+private:
+    std::string name_;
+};
+
+using undirected_graph_t = preview::undirected_adjacency_vector_graph<>;
+using directed_weighted_graph_t = preview::directed_adjacency_vector_graph<std::int32_t, double>;
+
+// Triangle 0-1-2 with the tail 2-3, the duplicated edge and the self-loop
+constexpr const char* undirected_graph_text = "# comment\n"
+                                              "0 1\n"
+                                              "1 2\n"
+                                              "\n"
+                                              "2 0\n"
+                                              "2\t3\r\n"
+                                              "1 0\n"
+                                              "3 3";
+
+void check_undirected_graph(const undirected_graph_t& graph) {
+    REQUIRE(preview::get_vertex_count(graph) == 4);
+    REQUIRE(preview::get_edge_count(graph) == 4);
+
+    const std::int64_t expected_degrees[] = { 2, 2, 3, 1 };
+    for (std::int32_t v = 0; v < 4; v++) {
+        REQUIRE(preview::get_vertex_degree(graph, v) == expected_degrees[v]);
+    }
+
+    const auto neighbors = preview::get_vertex_neighbors(graph, 2);
+    const std::int32_t expected_neighbors[] = { 0, 1, 3 };
+    std::int64_t i = 0;
+    for (auto it = neighbors.first; it != neighbors.second; ++it, ++i) {
+        REQUIRE(*it == expected_neighbors[i]);
+    }
+}
+
+TEST("can read text edge list in parallel") {
+    const temporary_graph_file file{ "graph_read_text.csv", undirected_graph_text };
+
+    const auto graph = dal::read<undirected_graph_t>(data_source{ file.get_name() });
+
+    check_undirected_graph(graph);
+}
+
+TEST("can read binary edge list") {
+    const temporary_graph_file text_file{ "graph_read_binary_source.csv", undirected_graph_text };
+    const temporary_graph_file binary_file{ "graph_read_binary_edge_list.bin" };
+
+    preview::edge_list<std::int32_t> edges;
+    preview::csv::detail::read_edge_list(text_file.get_name(), edges);
+    REQUIRE(edges.size() == 6);
+    preview::csv::write_binary_edge_list(binary_file.get_name(), edges);
+
+    const auto graph = dal::read<undirected_graph_t>(data_source{ binary_file.get_name() });
+
+    check_undirected_graph(graph);
+}
+
+TEST("can read binary CSR written from graph") {
+    const temporary_graph_file text_file{ "graph_read_csr_source.csv", undirected_graph_text };
+    const temporary_graph_file binary_file{ "graph_read_csr.bin" };
+
+    const auto source_graph = dal::read<undirected_graph_t>(data_source{ text_file.get_name() });
+    preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+
+    const auto graph = dal::read<undirected_graph_t>(data_source{ binary_file.get_name() });
+
+    check_undirected_graph(graph);
+}
+
+TEST("can read weighted binary CSR of directed graph") {
+    const temporary_graph_file text_file{ "graph_read_weighted_source.csv",
+                                          "0 1 0.5\n"
+                                          "1 2 1.5\n"
+                                          "2 0 2.5\n" };
+    const temporary_graph_file binary_file{ "graph_read_weighted_csr.bin" };
+
+    const auto source_graph =
+        dal::read<directed_weighted_graph_t>(data_source{ text_file.get_name() },
+                                             preview::read_mode::weighted_edge_list);
+    preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+
+    const auto graph =
+        dal::read<directed_weighted_graph_t>(data_source{ binary_file.get_name() },
+                                             preview::read_mode::weighted_edge_list);
+
+    REQUIRE(preview::get_vertex_count(graph) == 3);
+    REQUIRE(preview::get_edge_count(graph) == 3);
+    REQUIRE(preview::get_edge_value(graph, 0, 1) == 0.5);
+    REQUIRE(preview::get_edge_value(graph, 1, 2) == 1.5);
+    REQUIRE(preview::get_edge_value(graph, 2, 0) == 2.5);
+}
+
+TEST("can read negative integer edge weights") {
+    using graph_t = preview::directed_adjacency_vector_graph<std::int32_t, std::int32_t>;
+    const temporary_graph_file file{ "graph_read_negative_weights.csv", "0 1 -5\n1 2 3\n" };
+
+    const auto graph =
+        dal::read<graph_t>(data_source{ file.get_name() }, preview::read_mode::weighted_edge_list);
+
+    REQUIRE(preview::get_vertex_count(graph) == 3);
+    REQUIRE(preview::get_edge_count(graph) == 2);
+    REQUIRE(preview::get_edge_value(graph, 0, 1) == -5);
+    REQUIRE(preview::get_edge_value(graph, 1, 2) == 3);
+}
+
+TEST("throws if binary CSR does not match graph directness") {
+    const temporary_graph_file text_file{ "graph_read_mismatch_source.csv", undirected_graph_text };
+    const temporary_graph_file binary_file{ "graph_read_mismatch_csr.bin" };
+
+    const auto source_graph = dal::read<undirected_graph_t>(data_source{ text_file.get_name() });
+    preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+
+    using directed_graph_t = preview::directed_adjacency_vector_graph<>;
+    REQUIRE_THROWS_AS(dal::read<directed_graph_t>(data_source{ binary_file.get_name() }),
+                      invalid_argument);
+}
+
+/// Overwrites the value at the `offset` of the existing file
+template <typename Value>
+void patch_file(const std::string& name, std::int64_t offset, Value value) {
+    std::fstream file(name, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(offset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(Value));
+    REQUIRE(file.good());
+}
+
+TEST("throws if binary CSR is corrupted") {
+    using header_t = preview::csv::detail::binary_graph_header;
+    const std::int64_t offsets_offset =
+        preview::csv::detail::align_binary_graph_offset(sizeof(header_t));
+    const std::int64_t neighbors_offset = preview::csv::detail::align_binary_graph_offset(
+        offsets_offset + 5 * sizeof(std::int64_t));
+
+    const temporary_graph_file text_file{ "graph_read_corrupted_source.csv",
+                                          undirected_graph_text };
+    const temporary_graph_file binary_file{ "graph_read_corrupted_csr.bin" };
+    const auto source_graph = dal::read<undirected_graph_t>(data_source{ text_file.get_name() });
+
+    SECTION("neighbor is out of range") {
+        preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+        patch_file(binary_file.get_name(), neighbors_offset, std::int32_t(100));
+    }
+
+    SECTION("neighbor is negative") {
+        preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+        patch_file(binary_file.get_name(), neighbors_offset, std::int32_t(-1));
+    }
+
+    SECTION("offsets are not monotonic") {
+        preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+        patch_file(binary_file.get_name(),
+                   offsets_offset + 2 * sizeof(std::int64_t),
+                   std::int64_t(1));
+    }
+
+    SECTION("last offset does not match neighbor count") {
+        preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+        patch_file(binary_file.get_name(),
+                   offsets_offset + 4 * sizeof(std::int64_t),
+                   std::int64_t(7));
+    }
+
+    SECTION("section sizes overflow") {
+        preview::csv::write_binary_csr(binary_file.get_name(), source_graph);
+        patch_file(binary_file.get_name(),
+                   offsetof(header_t, element_count),
+                   std::numeric_limits<std::int64_t>::max() / 2);
+    }
+
+    REQUIRE_THROWS_AS(dal::read<undirected_graph_t>(data_source{ binary_file.get_name() }),
+                      invalid_argument);
+}
+
+TEST("throws if edge list has negative vertex ID") {
+    const temporary_graph_file file{ "graph_read_negative.csv", "0 1\n-1 2\n" };
+
+    REQUIRE_THROWS_AS(dal::read<undirected_graph_t>(data_source{ file.get_name() }),
+                      invalid_argument);
+}
+
+TEST("throws if binary graph file cannot be written") {
+    preview::edge_list<std::int32_t> edges;
+    edges.push_back({ 0, 1 });
+
+    REQUIRE_THROWS_AS(
+        preview::csv::write_binary_edge_list("graph_missing_directory/graph.bin", edges),
+        system_error);
+}
+
+TEST("throws if edge list has invalid format") {
+    const temporary_graph_file file{ "graph_read_invalid.csv", "0 1\n1 x\n" };
+
+    REQUIRE_THROWS_AS(dal::read<undirected_graph_t>(data_source{ file.get_name() }),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::csv::test
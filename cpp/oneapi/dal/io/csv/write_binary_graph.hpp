@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/common.hpp"
+#include "oneapi/dal/io/csv/detail/binary_graph_format.hpp"
+#include "oneapi/dal/io/csv/detail/common.hpp"
+
+namespace oneapi::dal::preview::csv {
+
+namespace detail {
+
+class binary_graph_writer {
+public:
+    explicit binary_graph_writer(const std::string &file_name)
+            : file_(file_name, std::ios::binary | std::ios::trunc) {
+        if (!file_.is_open()) {
+            throw system_error(std::error_code(),
+                               dal::detail::error_messages::file_cannot_be_opened_for_writing());
+        }
+    }
+
+    void write_header(binary_graph_header header) {
+        std::memcpy(header.magic, binary_graph_magic, sizeof(binary_graph_magic));
+        header.version = binary_graph_version;
+        write(&header, sizeof(binary_graph_header));
+    }
+
+    void write(const void *data, std::int64_t size) {
+        file_.write(static_cast<const char *>(data), size);
+        check_state();
+        position_ += size;
+    }
+
+    /// Flushes the buffered data and closes the file, so that failures of the
+    /// deferred writes are reported
+    void close() {
+        file_.flush();
+        check_state();
+        file_.close();
+        check_state();
+    }
+
+    /// Pads the file with zeros up to the beginning of the next section
+    void align() {
+        constexpr char zeros[binary_graph_alignment] = {};
+        write(zeros, align_binary_graph_offset(position_) - position_);
+    }
+
+private:
+    void check_state() const {
+        if (!file_.good()) {
+            throw system_error(std::error_code(), dal::detail::error_messages::file_write_failed());
+        }
+    }
+
+    std::ofstream file_;
+    std::int64_t position_ = 0;
+};
+
+} // namespace detail
+
+/// Writes the edge list to the binary file that can be read with
+/// :expr:`read<Graph>(csv::data_source{file_name})` without parsing
+///
+/// @param file_name The name of the file to write
+/// @param edges     The edge list
+template <typename Vertex>
+void write_binary_edge_list(const std::string &file_name, const edge_list<Vertex> &edges) {
+    using edge_t = std::pair<Vertex, Vertex>;
+    static_assert(sizeof(edge_t) == 2 * sizeof(Vertex));
+
+    detail::binary_graph_header header{};
+    header.kind = detail::binary_graph_kind::edge_list;
+    header.weight_type = detail::binary_graph_weight_type::none;
+    header.vertex_size = sizeof(Vertex);
+    header.edge_size = sizeof(std::int64_t);
+    header.element_count = edges.size();
+
+    detail::binary_graph_writer writer{ file_name };
+    writer.write_header(header);
+    writer.align();
+    writer.write(edges.get_data(), edges.size() * sizeof(edge_t));
+    writer.close();
+}
+
+/// Writes the weighted edge list to the binary file that can be read with
+/// :expr:`read<Graph>(csv::data_source{file_name})` without parsing
+///
+/// @param file_name The name of the file to write
+/// @param edges     The weighted edge list
+template <typename Vertex, typename Weight>
+void write_binary_edge_list(const std::string &file_name,
+                            const weighted_edge_list<Vertex, Weight> &edges) {
+    constexpr std::int64_t block_size = 1 << 12;
+
+    detail::binary_graph_header header{};
+    header.kind = detail::binary_graph_kind::edge_list;
+    header.weight_type = detail::get_binary_graph_weight_type<Weight>();
+    header.vertex_size = sizeof(Vertex);
+    header.edge_size = sizeof(std::int64_t);
+    header.element_count = edges.size();
+
+    detail::binary_graph_writer writer{ file_name };
+    writer.write_header(header);
+    writer.align();
+
+    Vertex vertices[2 * block_size];
+    for (std::int64_t begin = 0; begin < edges.size(); begin += block_size) {
+        const std::int64_t end = std::min(edges.size(), begin + block_size);
+        for (std::int64_t i = begin; i < end; ++i) {
+            vertices[2 * (i - begin)] = std::get<0>(edges[i]);
+            vertices[2 * (i - begin) + 1] = std::get<1>(edges[i]);
+        }
+        writer.write(vertices, 2 * (end - begin) * sizeof(Vertex));
+    }
+    writer.align();
+
+    Weight weights[block_size];
+    for (std::int64_t begin = 0; begin < edges.size(); begin += block_size) {
+        const std::int64_t end = std::min(edges.size(), begin + block_size);
+        for (std::int64_t i = begin; i < end; ++i) {
+            weights[i - begin] = std::get<2>(edges[i]);
+        }
+        writer.write(weights, (end - begin) * sizeof(Weight));
+    }
+    writer.close();
+}
+
+/// Writes CSR topology and edge values of the graph to the binary file that can be read with
+/// :expr:`read<Graph>(csv::data_source{file_name})` directly into the graph arrays
+///
+/// @tparam Graph    Type of the graph
+///
+/// @param file_name The name of the file to write
+/// @param graph     The graph
+template <typename Graph>
+void write_binary_csr(const std::string &file_name, const Graph &graph) {
+    using vertex_t = typename graph_traits<Graph>::vertex_type;
+    using edge_t = typename graph_traits<Graph>::edge_type;
+    using edge_value_type = typename graph_traits<Graph>::edge_user_value_type;
+    constexpr bool is_edge_weighted =
+        !oneapi::dal::detail::is_one_of_v<edge_value_type, oneapi::dal::preview::empty_value>;
+
+    const auto &graph_impl = oneapi::dal::detail::get_impl(graph);
+    const auto topology = graph_impl.get_topology();
+    const std::int64_t vertex_count = topology.get_vertex_count();
+    const std::int64_t neighbor_count = topology._cols.get_count();
+
+    detail::binary_graph_header header{};
+    header.kind = detail::binary_graph_kind::csr;
+    header.weight_type = is_edge_weighted ? detail::get_binary_graph_weight_type<edge_value_type>()
+                                          : detail::binary_graph_weight_type::none;
+    header.is_directed = is_directed<Graph>;
+    header.vertex_size = sizeof(vertex_t);
+    header.edge_size = sizeof(edge_t);
+    header.vertex_count = vertex_count;
+    header.element_count = neighbor_count;
+
+    detail::binary_graph_writer writer{ file_name };
+    writer.write_header(header);
+    writer.align();
+    writer.write(topology._rows.get_data(), (vertex_count + 1) * sizeof(edge_t));
+    writer.align();
+    writer.write(topology._cols.get_data(), neighbor_count * sizeof(vertex_t));
+
+    if constexpr (is_edge_weighted) {
+        writer.align();
+        writer.write(graph_impl.get_edge_values().get_data(),
+                     neighbor_count * sizeof(edge_value_type));
+    }
+    writer.close();
+}
+
+} // namespace oneapi::dal::preview::csv
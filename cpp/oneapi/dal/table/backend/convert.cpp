@@ -20,6 +20,7 @@
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/transfer.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
+#include "oneapi/dal/table/backend/transpose.hpp"
 
 namespace oneapi::dal::backend {
 
@@ -83,6 +84,54 @@ void convert_vector(const detail::default_host_policy& policy,
     }
 }
 
+void convert_transposed(const detail::default_host_policy& policy,
+                        const void* src,
+                        void* dst,
+                        data_type src_type,
+                        data_type dst_type,
+                        std::int64_t src_row_stride,
+                        std::int64_t dst_row_stride,
+                        std::int64_t row_count,
+                        std::int64_t column_count) {
+    ONEDAL_ASSERT(src);
+    ONEDAL_ASSERT(dst);
+    ONEDAL_ASSERT(row_count > 0);
+    ONEDAL_ASSERT(column_count > 0);
+
+    if (is_transpose_supported_type(src_type) && is_transpose_supported_type(dst_type)) {
+        dispatch_by_cpu(context_cpu{}, [&](auto cpu) {
+            convert_transposed_impl<decltype(cpu)>(src,
+                                                   dst,
+                                                   src_type,
+                                                   dst_type,
+                                                   src_row_stride,
+                                                   dst_row_stride,
+                                                   row_count,
+                                                   column_count);
+        });
+    }
+    else {
+        // Every row of `dst` is a strided column of `src`
+        const std::int64_t src_element_size = dal::detail::get_data_type_size(src_type);
+        const std::int64_t dst_element_size = dal::detail::get_data_type_size(dst_type);
+        ONEDAL_ASSERT_MUL_OVERFLOW(std::int64_t, column_count, dst_row_stride);
+        ONEDAL_ASSERT_MUL_OVERFLOW(std::int64_t, column_count * dst_row_stride, dst_element_size);
+
+        const auto src_bytes = static_cast<const byte_t*>(src);
+        const auto dst_bytes = static_cast<byte_t*>(dst);
+        for (std::int64_t j = 0; j < column_count; j++) {
+            convert_vector(policy,
+                           src_bytes + j * src_element_size,
+                           dst_bytes + j * dst_row_stride * dst_element_size,
+                           src_type,
+                           dst_type,
+                           src_row_stride,
+                           1,
+                           row_count);
+        }
+    }
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 template <typename Src, typename Dst>
@@ -37,6 +37,19 @@ void convert_vector(const detail::default_host_policy& policy,
                     std::int64_t dst_stride,
                     std::int64_t element_count);
 
+/// Converts `row_count` x `column_count` row-major matrix `src` of `src_type` to
+/// transposed matrix `dst` of `dst_type`. Rows of `src` and `dst` are `src_row_stride`
+/// and `dst_row_stride` elements apart.
+void convert_transposed(const detail::default_host_policy& policy,
+                        const void* src,
+                        void* dst,
+                        data_type src_type,
+                        data_type dst_type,
+                        std::int64_t src_row_stride,
+                        std::int64_t dst_row_stride,
+                        std::int64_t row_count,
+                        std::int64_t column_count);
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 void convert_vector(const detail::data_parallel_policy& policy,
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+
+namespace oneapi::dal::backend {
+
+/// Checks whether the data type is supported by `convert_transposed_impl`
+inline bool is_transpose_supported_type(data_type type) {
+    return type == data_type::float32 || type == data_type::float64 || type == data_type::int32;
+}
+
+/// Writes the transposed `row_count` x `column_count` row-major matrix `src` of `src_type`
+/// to `dst` of `dst_type`. Rows of `src` and `dst` are `src_row_stride` and `dst_row_stride`
+/// elements apart. The matrix is processed in cache-sized tiles in parallel.
+template <typename Cpu>
+void convert_transposed_impl(const void* src,
+                             void* dst,
+                             data_type src_type,
+                             data_type dst_type,
+                             std::int64_t src_row_stride,
+                             std::int64_t dst_row_stride,
+                             std::int64_t row_count,
+                             std::int64_t column_count);
+
+} // namespace oneapi::dal::backend
@@ -0,0 +1,344 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/table/backend/transpose.hpp"
+#include "oneapi/dal/backend/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace oneapi::dal::backend {
+
+/// Side of the square tile in elements. Source and destination tiles of doubles
+/// take 16 KB together, so both stay in L1 while the tile is transposed.
+constexpr std::int64_t transpose_tile_size = 32;
+
+/// Matrices smaller than this number of elements are transposed sequentially
+constexpr std::int64_t transpose_parallel_threshold = 1 << 16;
+
+/// Transposes `size` x `size` block in registers. Types with `size == 0`
+/// have no register kernel and are transposed element by element.
+template <typename Src, typename Dst>
+struct register_transpose {
+    static constexpr std::int64_t size = 0;
+
+    static void run(const Src* src, std::int64_t src_stride, Dst* dst, std::int64_t dst_stride) {}
+};
+
+#if defined(__AVX__)
+
+template <>
+struct register_transpose<float, float> {
+    static constexpr std::int64_t size = 8;
+
+    static ONEDAL_FORCEINLINE void run(const float* src,
+                                       std::int64_t src_stride,
+                                       float* dst,
+                                       std::int64_t dst_stride) {
+        const __m256 r0 = _mm256_loadu_ps(src + 0 * src_stride);
+        const __m256 r1 = _mm256_loadu_ps(src + 1 * src_stride);
+        const __m256 r2 = _mm256_loadu_ps(src + 2 * src_stride);
+        const __m256 r3 = _mm256_loadu_ps(src + 3 * src_stride);
+        const __m256 r4 = _mm256_loadu_ps(src + 4 * src_stride);
+        const __m256 r5 = _mm256_loadu_ps(src + 5 * src_stride);
+        const __m256 r6 = _mm256_loadu_ps(src + 6 * src_stride);
+        const __m256 r7 = _mm256_loadu_ps(src + 7 * src_stride);
+
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+        const __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm256_storeu_ps(dst + 0 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x20));
+        _mm256_storeu_ps(dst + 1 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x20));
+        _mm256_storeu_ps(dst + 2 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x20));
+        _mm256_storeu_ps(dst + 3 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x20));
+        _mm256_storeu_ps(dst + 4 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x31));
+        _mm256_storeu_ps(dst + 5 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x31));
+        _mm256_storeu_ps(dst + 6 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x31));
+        _mm256_storeu_ps(dst + 7 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x31));
+    }
+};
+
+template <>
+struct register_transpose<double, double> {
+    static constexpr std::int64_t size = 4;
+
+    static ONEDAL_FORCEINLINE void run(const double* src,
+                                       std::int64_t src_stride,
+                                       double* dst,
+                                       std::int64_t dst_stride) {
+        const __m256d r0 = _mm256_loadu_pd(src + 0 * src_stride);
+        const __m256d r1 = _mm256_loadu_pd(src + 1 * src_stride);
+        const __m256d r2 = _mm256_loadu_pd(src + 2 * src_stride);
+        const __m256d r3 = _mm256_loadu_pd(src + 3 * src_stride);
+
+        const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(dst + 0 * dst_stride, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(dst + 1 * dst_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(dst + 2 * dst_stride, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(dst + 3 * dst_stride, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+};
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+template <>
+struct register_transpose<float, float> {
+    static constexpr std::int64_t size = 4;
+
+    static ONEDAL_FORCEINLINE void run(const float* src,
+                                       std::int64_t src_stride,
+                                       float* dst,
+                                       std::int64_t dst_stride) {
+        __m128 r0 = _mm_loadu_ps(src + 0 * src_stride);
+        __m128 r1 = _mm_loadu_ps(src + 1 * src_stride);
+        __m128 r2 = _mm_loadu_ps(src + 2 * src_stride);
+        __m128 r3 = _mm_loadu_ps(src + 3 * src_stride);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(dst + 0 * dst_stride, r0);
+        _mm_storeu_ps(dst + 1 * dst_stride, r1);
+        _mm_storeu_ps(dst + 2 * dst_stride, r2);
+        _mm_storeu_ps(dst + 3 * dst_stride, r3);
+    }
+};
+
+template <>
+struct register_transpose<double, double> {
+    static constexpr std::int64_t size = 2;
+
+    static ONEDAL_FORCEINLINE void run(const double* src,
+                                       std::int64_t src_stride,
+                                       double* dst,
+                                       std::int64_t dst_stride) {
+        const __m128d r0 = _mm_loadu_pd(src + 0 * src_stride);
+        const __m128d r1 = _mm_loadu_pd(src + 1 * src_stride);
+
+        _mm_storeu_pd(dst + 0 * dst_stride, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(dst + 1 * dst_stride, _mm_unpackhi_pd(r0, r1));
+    }
+};
+
+#endif
+
+template <typename Src, typename Dst>
+ONEDAL_FORCEINLINE void transpose_elements(const Src* src,
+                                           Dst* dst,
+                                           std::int64_t src_stride,
+                                           std::int64_t dst_stride,
+                                           std::int64_t row_begin,
+                                           std::int64_t row_end,
+                                           std::int64_t column_begin,
+                                           std::int64_t column_end) {
+    for (std::int64_t i = row_begin; i < row_end; i++) {
+        PRAGMA_IVDEP
+        for (std::int64_t j = column_begin; j < column_end; j++) {
+            dst[j * dst_stride + i] = static_cast<Dst>(src[i * src_stride + j]);
+        }
+    }
+}
+
+template <typename Src, typename Dst>
+ONEDAL_FORCEINLINE void transpose_tile(const Src* src,
+                                       Dst* dst,
+                                       std::int64_t src_stride,
+                                       std::int64_t dst_stride,
+                                       std::int64_t row_count,
+                                       std::int64_t column_count) {
+    using kernel_t = register_transpose<Src, Dst>;
+    constexpr std::int64_t kernel_size = kernel_t::size;
+
+    std::int64_t row_done = 0;
+    std::int64_t column_done = 0;
+    if constexpr (kernel_size > 0) {
+        row_done = (row_count / kernel_size) * kernel_size;
+        column_done = (column_count / kernel_size) * kernel_size;
+        for (std::int64_t i = 0; i < row_done; i += kernel_size) {
+            for (std::int64_t j = 0; j < column_done; j += kernel_size) {
+                kernel_t::run(src + i * src_stride + j,
+                              src_stride,
+                              dst + j * dst_stride + i,
+                              dst_stride);
+            }
+        }
+    }
+
+    // Elements not covered by the register kernel
+    transpose_elements(src, dst, src_stride, dst_stride, 0, row_done, column_done, column_count);
+    transpose_elements(src, dst, src_stride, dst_stride, row_done, row_count, 0, column_count);
+}
+
+template <typename Src, typename Dst>
+static void convert_transposed_typed(const Src* src,
+                                     Dst* dst,
+                                     std::int64_t src_row_stride,
+                                     std::int64_t dst_row_stride,
+                                     std::int64_t row_count,
+                                     std::int64_t column_count) {
+    constexpr std::int64_t tile_element_count = transpose_tile_size * transpose_tile_size;
+
+    // Tiles of narrow or short matrices are stretched along the long side,
+    // so that every tile still holds about `tile_element_count` elements
+    std::int64_t tile_row_count = std::min(row_count, transpose_tile_size);
+    std::int64_t tile_column_count = std::min(column_count, transpose_tile_size);
+    if (tile_column_count < transpose_tile_size) {
+        tile_row_count = std::min(row_count, tile_element_count / tile_column_count);
+    }
+    else if (tile_row_count < transpose_tile_size) {
+        tile_column_count = std::min(column_count, tile_element_count / tile_row_count);
+    }
+
+    const std::int64_t row_tile_count = (row_count + tile_row_count - 1) / tile_row_count;
+    const std::int64_t column_tile_count =
+        (column_count + tile_column_count - 1) / tile_column_count;
+
+    const auto process_tile = [&](std::int64_t tile_idx) {
+        const std::int64_t i = (tile_idx / column_tile_count) * tile_row_count;
+        const std::int64_t j = (tile_idx % column_tile_count) * tile_column_count;
+        transpose_tile(src + i * src_row_stride + j,
+                       dst + j * dst_row_stride + i,
+                       src_row_stride,
+                       dst_row_stride,
+                       std::min(tile_row_count, row_count - i),
+                       std::min(tile_column_count, column_count - j));
+    };
+
+    const std::int64_t tile_count = row_tile_count * column_tile_count;
+    if (row_count * column_count < transpose_parallel_threshold) {
+        for (std::int64_t tile_idx = 0; tile_idx < tile_count; tile_idx++) {
+            process_tile(tile_idx);
+        }
+    }
+    else {
+        dal::detail::threader_for_int64(tile_count, process_tile);
+    }
+}
+
+template <typename Src>
+static void convert_transposed_dispatch_dst(const Src* src,
+                                            void* dst,
+                                            data_type dst_type,
+                                            std::int64_t src_row_stride,
+                                            std::int64_t dst_row_stride,
+                                            std::int64_t row_count,
+                                            std::int64_t column_count) {
+    switch (dst_type) {
+        case data_type::float32:
+            return convert_transposed_typed(src,
+                                            static_cast<float*>(dst),
+                                            src_row_stride,
+                                            dst_row_stride,
+                                            row_count,
+                                            column_count);
+        case data_type::float64:
+            return convert_transposed_typed(src,
+                                            static_cast<double*>(dst),
+                                            src_row_stride,
+                                            dst_row_stride,
+                                            row_count,
+                                            column_count);
+        case data_type::int32:
+            return convert_transposed_typed(src,
+                                            static_cast<std::int32_t*>(dst),
+                                            src_row_stride,
+                                            dst_row_stride,
+                                            row_count,
+                                            column_count);
+        default: ONEDAL_ASSERT(!"Unsupported data type");
+    }
+}
+
+template <typename Cpu>
+void convert_transposed_impl(const void* src,
+                             void* dst,
+                             data_type src_type,
+                             data_type dst_type,
+                             std::int64_t src_row_stride,
+                             std::int64_t dst_row_stride,
+                             std::int64_t row_count,
+                             std::int64_t column_count) {
+    ONEDAL_ASSERT(src);
+    ONEDAL_ASSERT(dst);
+    ONEDAL_ASSERT(row_count > 0);
+    ONEDAL_ASSERT(column_count > 0);
+    ONEDAL_ASSERT(src_row_stride >= column_count);
+    ONEDAL_ASSERT(dst_row_stride >= row_count);
+
+    switch (src_type) {
+        case data_type::float32:
+            return convert_transposed_dispatch_dst(static_cast<const float*>(src),
+                                                   dst,
+                                                   dst_type,
+                                                   src_row_stride,
+                                                   dst_row_stride,
+                                                   row_count,
+                                                   column_count);
+        case data_type::float64:
+            return convert_transposed_dispatch_dst(static_cast<const double*>(src),
+                                                   dst,
+                                                   dst_type,
+                                                   src_row_stride,
+                                                   dst_row_stride,
+                                                   row_count,
+                                                   column_count);
+        case data_type::int32:
+            return convert_transposed_dispatch_dst(static_cast<const std::int32_t*>(src),
+                                                   dst,
+                                                   dst_type,
+                                                   src_row_stride,
+                                                   dst_row_stride,
+                                                   row_count,
+                                                   column_count);
+        default: ONEDAL_ASSERT(!"Unsupported data type");
+    }
+}
+
+#define INSTANTIATE(Cpu)                                                    \
+    template void convert_transposed_impl<Cpu>(const void* src,             \
+                                               void* dst,                   \
+                                               data_type src_type,          \
+                                               data_type dst_type,          \
+                                               std::int64_t src_row_stride, \
+                                               std::int64_t dst_row_stride, \
+                                               std::int64_t row_count,      \
+                                               std::int64_t column_count);
+
+INSTANTIATE(__CPU_TAG__)
+
+} // namespace oneapi::dal::backend
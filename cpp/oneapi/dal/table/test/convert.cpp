@@ -18,6 +18,7 @@
 //       Test for conversion should be moved to dal/table/backend
 
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/linalg.hpp"
@@ -206,6 +207,60 @@ TEST_M(convert_test, "convert types of the different sizes host2host", "[host2ho
     }
 }
 
+class convert_transposed_test : public te::policy_fixture {
+public:
+    template <typename Src, typename Dst>
+    void test_host2host_conversion(std::int64_t row_count, std::int64_t column_count) {
+        const std::int64_t src_row_stride = column_count + 1;
+        const std::int64_t dst_row_stride = row_count + 3;
+
+        std::vector<Src> src(row_count * src_row_stride);
+        for (std::int64_t i = 0; i < std::int64_t(src.size()); i++) {
+            src[i] = Src(i % 1000) - Src(500);
+        }
+        std::vector<Dst> dst(column_count * dst_row_stride, Dst(-1));
+
+        convert_transposed(dal::detail::default_host_policy{},
+                           src.data(),
+                           dst.data(),
+                           dal::detail::make_data_type<Src>(),
+                           dal::detail::make_data_type<Dst>(),
+                           src_row_stride,
+                           dst_row_stride,
+                           row_count,
+                           column_count);
+
+        for (std::int64_t j = 0; j < column_count; j++) {
+            for (std::int64_t i = 0; i < dst_row_stride; i++) {
+                const Dst expected = (i < row_count) ? Dst(src[i * src_row_stride + j]) : Dst(-1);
+                REQUIRE(dst[j * dst_row_stride + i] == expected);
+            }
+        }
+    }
+};
+
+TEST_M(convert_transposed_test, "host2host transposed conversion", "[host2host]") {
+    const std::int64_t row_count = GENERATE(1, 37, 300);
+    const std::int64_t column_count = GENERATE(1, 45, 257);
+    SECTION(fmt::format("{} x {}", row_count, column_count)) {
+        SECTION("float -> float") {
+            test_host2host_conversion<float, float>(row_count, column_count);
+        }
+        SECTION("double -> double") {
+            test_host2host_conversion<double, double>(row_count, column_count);
+        }
+        SECTION("float -> double") {
+            test_host2host_conversion<float, double>(row_count, column_count);
+        }
+        SECTION("std::int32_t -> float") {
+            test_host2host_conversion<std::int32_t, float>(row_count, column_count);
+        }
+        SECTION("std::int64_t -> double") {
+            test_host2host_conversion<std::int64_t, double>(row_count, column_count);
+        }
+    }
+}
+
 // device -> device tests
 #ifdef ONEDAL_DATA_PARALLEL
 TEST_M(convert_test, "device2device convert identical types", "[device2device]") {
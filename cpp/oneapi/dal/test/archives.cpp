@@ -20,6 +20,11 @@
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/serialization.hpp"
 
+#ifndef _WIN32
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 namespace oneapi::dal::test {
 
 namespace te = dal::test::engine;
@@ -142,4 +147,141 @@ TEST("binary_input_archive throws if truncated data buffer is provided", "[binar
     REQUIRE(input_archive.is_valid() == false);
 }
 
+TEMPLATE_TEST("serialize/deserialize arrays to aligned binary archive",
+              "[aligned_binary_archive]",
+              float,
+              double,
+              std::int32_t) {
+    // The first array is too small to be aligned
+    const std::int64_t small_count = 3;
+    const std::int64_t large_count = 1000;
+    const auto small = array<TestType>::full(small_count, TestType(1));
+    const auto large = array<TestType>::empty(large_count);
+    for (std::int64_t i = 0; i < large_count; i++) {
+        large.get_mutable_data()[i] = TestType(i);
+    }
+
+    INFO("serialize");
+    detail::aligned_binary_output_archive output_archive;
+    detail::serialize(small, output_archive);
+    detail::serialize(large, output_archive);
+    REQUIRE(output_archive.is_valid() == true);
+    const auto content = output_archive.to_array();
+
+    INFO("deserialize");
+    array<TestType> small_deserialized;
+    array<TestType> large_deserialized;
+    detail::aligned_binary_input_archive input_archive{ content };
+    detail::deserialize(small_deserialized, input_archive);
+    detail::deserialize(large_deserialized, input_archive);
+    REQUIRE(input_archive.is_valid() == true);
+
+    REQUIRE(small_deserialized.get_count() == small_count);
+    for (std::int64_t i = 0; i < small_count; i++) {
+        REQUIRE(small_deserialized[i] == TestType(1));
+    }
+
+    REQUIRE(large_deserialized.get_count() == large_count);
+    for (std::int64_t i = 0; i < large_count; i++) {
+        REQUIRE(large_deserialized[i] == TestType(i));
+    }
+
+    SECTION("large array aliases archive content") {
+        const auto begin = reinterpret_cast<const byte_t*>(large_deserialized.get_data());
+        REQUIRE(begin >= content.get_data());
+        REQUIRE(begin < content.get_data() + content.get_count());
+        REQUIRE(reinterpret_cast<std::uintptr_t>(begin) % detail::aligned_archive_alignment == 0);
+    }
+}
+
+TEST("aligned_binary_input_archive copies data if content is immutable",
+     "[aligned_binary_archive]") {
+    const std::int64_t count = 1000;
+    const auto original = array<double>::full(count, 2.0);
+
+    detail::aligned_binary_output_archive output_archive;
+    detail::serialize(original, output_archive);
+    const auto content = output_archive.to_array();
+
+    array<double> deserialized;
+    detail::aligned_binary_input_archive input_archive{ content.get_data(), content.get_count() };
+    detail::deserialize(deserialized, input_archive);
+
+    const auto begin = reinterpret_cast<const byte_t*>(deserialized.get_data());
+    REQUIRE((begin < content.get_data() || begin >= content.get_data() + content.get_count()));
+    for (std::int64_t i = 0; i < count; i++) {
+        REQUIRE(deserialized[i] == 2.0);
+    }
+}
+
+TEST("binary archives of different formats are not compatible", "[aligned_binary_archive]") {
+    const auto original = array<float>::full(10, 1.0f);
+
+    detail::binary_output_archive output_archive;
+    detail::serialize(original, output_archive);
+
+    array<float> deserialized;
+    detail::aligned_binary_input_archive input_archive{ output_archive.to_array() };
+    REQUIRE_THROWS_AS(detail::deserialize(deserialized, input_archive), invalid_argument);
+}
+
+#ifndef _WIN32
+TEST("file_output_archive content is read from mapped file", "[file_output_archive]") {
+    char path[] = "/tmp/onedal_archive_XXXXXX";
+    const int file_descriptor = ::mkstemp(path);
+    REQUIRE(file_descriptor >= 0);
+
+    const std::int64_t count = 100000;
+    const auto original = array<float>::empty(count);
+    for (std::int64_t i = 0; i < count; i++) {
+        original.get_mutable_data()[i] = float(i);
+    }
+    const auto small = array<std::int32_t>::full(5, 7);
+
+    INFO("serialize");
+    {
+        // Buffer is smaller than the large array to check the direct writes
+        detail::file_output_archive output_archive{ file_descriptor, 4096 };
+        detail::serialize(small, output_archive);
+        detail::serialize(original, output_archive);
+        detail::serialize(small, output_archive);
+        REQUIRE(output_archive.is_valid() == true);
+
+        detail::aligned_binary_output_archive memory_archive;
+        detail::serialize(small, memory_archive);
+        detail::serialize(original, memory_archive);
+        detail::serialize(small, memory_archive);
+        REQUIRE(output_archive.get_size() == memory_archive.get_size());
+    }
+    ::close(file_descriptor);
+
+    INFO("deserialize");
+    array<std::int32_t> small_first;
+    array<float> deserialized;
+    array<std::int32_t> small_last;
+    {
+        detail::aligned_binary_input_archive input_archive{ detail::map_file(path) };
+        detail::deserialize(small_first, input_archive);
+        detail::deserialize(deserialized, input_archive);
+        detail::deserialize(small_last, input_archive);
+    }
+    ::unlink(path);
+
+    REQUIRE(deserialized.get_count() == count);
+    for (std::int64_t i = 0; i < count; i++) {
+        REQUIRE(deserialized[i] == float(i));
+    }
+    REQUIRE(small_first.get_count() == 5);
+    REQUIRE(small_last.get_count() == 5);
+    for (std::int64_t i = 0; i < 5; i++) {
+        REQUIRE(small_first[i] == 7);
+        REQUIRE(small_last[i] == 7);
+    }
+}
+
+TEST("map_file throws if file does not exist", "[file_output_archive]") {
+    REQUIRE_THROWS_AS(detail::map_file("/tmp/onedal_archive_does_not_exist"), invalid_argument);
+}
+#endif
+
 } // namespace oneapi::dal::test
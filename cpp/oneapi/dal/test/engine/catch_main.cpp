@@ -20,8 +20,13 @@
 #include <unordered_map>
 
 #define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
 #include "oneapi/dal/test/engine/catch.hpp"
 #include "oneapi/dal/test/engine/config.hpp"
+#include "oneapi/dal/test/engine/perf_reporter.hpp"
+
+using oneapi::dal::test::engine::perf_reporter;
+CATCH_REGISTER_REPORTER("perf", perf_reporter)
 
 inline constexpr int default_benchmark_run_count = 5;
 
@@ -33,7 +38,15 @@ int main(int argc, char** argv) {
     Catch::Session session;
 
     auto cli =
-        session.cli() | Opt(config.device_selector, "device")["--device"]("DPC++ device selector");
+        session.cli() | Opt(config.device_selector, "device")["--device"]("DPC++ device selector") |
+        Opt(config.perf_row_count, "rows")["--perf-row-count"](
+            "Number of rows in the datasets of performance tests") |
+        Opt(config.perf_column_count, "columns")["--perf-column-count"](
+            "Number of columns in the datasets of performance tests") |
+        Opt(config.perf_vertex_count, "vertices")["--perf-vertex-count"](
+            "Number of vertices in the graphs of performance tests") |
+        Opt(config.perf_average_degree, "degree")["--perf-average-degree"](
+            "Average vertex degree in the graphs of performance tests");
 
     session.cli(cli);
     session.configData().benchmarkSamples = default_benchmark_run_count;
@@ -26,6 +26,8 @@
 #include "oneapi/dal/train.hpp"
 #include "oneapi/dal/infer.hpp"
 #include "oneapi/dal/compute.hpp"
+#include "oneapi/dal/partial_compute.hpp"
+#include "oneapi/dal/finalize_compute.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/test/engine/catch.hpp"
 #include "oneapi/dal/test/engine/macro.hpp"
@@ -142,6 +144,16 @@ inline auto compute(host_test_policy& policy, Args&&... args) {
     return dal::compute(std::forward<Args>(args)...);
 }
 
+template <typename... Args>
+inline auto partial_compute(host_test_policy& policy, Args&&... args) {
+    return dal::partial_compute(std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+inline auto finalize_compute(host_test_policy& policy, Args&&... args) {
+    return dal::finalize_compute(std::forward<Args>(args)...);
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 class test_queue_provider {
 public:
@@ -211,6 +223,16 @@ inline auto compute(device_test_policy& policy, Args&&... args) {
     return dal::compute(policy.get_queue(), std::forward<Args>(args)...);
 }
 
+template <typename... Args>
+inline auto partial_compute(device_test_policy& policy, Args&&... args) {
+    return dal::partial_compute(policy.get_queue(), std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+inline auto finalize_compute(device_test_policy& policy, Args&&... args) {
+    return dal::finalize_compute(policy.get_queue(), std::forward<Args>(args)...);
+}
+
 template <typename T>
 struct type2str {
     static const char* name() {
@@ -21,6 +21,15 @@
 
 namespace oneapi::dal::test::engine {
 
+static global_config& get_mutable_global_config() {
+    static global_config config;
+    return config;
+}
+
+const global_config& get_global_config() {
+    return get_mutable_global_config();
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 
 static sycl::queue get_default_queue() {
@@ -53,6 +62,7 @@ static sycl::queue get_queue(const std::string& device_selector) {
 }
 
 void global_setup(const global_config& config) {
+    get_mutable_global_config() = config;
     test_queue_provider::get_instance().init(get_queue(config.device_selector));
 }
 
@@ -67,6 +77,7 @@ void global_setup(const global_config& config) {
             "Test is build in HOST mode, so only CPU device is available"
         };
     }
+    get_mutable_global_config() = config;
 }
 
 void global_cleanup() {}
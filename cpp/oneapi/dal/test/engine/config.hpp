@@ -16,16 +16,26 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace oneapi::dal::test::engine {
 
 struct global_config {
     std::string device_selector;
+
+    /// Size of the synthetic datasets used by the performance tests
+    std::int64_t perf_row_count = 10000;
+    std::int64_t perf_column_count = 20;
+    std::int64_t perf_vertex_count = 10000;
+    std::int64_t perf_average_degree = 16;
 };
 
 void global_setup(const global_config& config);
 
+/// Returns the configuration passed to :expr:`global_setup`
+const global_config& get_global_config();
+
 void global_cleanup();
 
 } //namespace oneapi::dal::test::engine
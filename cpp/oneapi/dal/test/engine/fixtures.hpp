@@ -55,6 +55,18 @@ public:
     auto compute(Args&&... args) {
         return oneapi::dal::test::engine::compute(get_policy(), std::forward<Args>(args)...);
     }
+
+    template <typename... Args>
+    auto partial_compute(Args&&... args) {
+        return oneapi::dal::test::engine::partial_compute(get_policy(),
+                                                          std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    auto finalize_compute(Args&&... args) {
+        return oneapi::dal::test::engine::finalize_compute(get_policy(),
+                                                           std::forward<Args>(args)...);
+    }
 };
 
 template <typename Float>
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+// Must be included from the translation unit that defines
+// CATCH_CONFIG_RUNNER and CATCH_CONFIG_EXTERNAL_INTERFACES
+
+#include <cstdio>
+#include <string>
+
+#include "oneapi/dal/test/engine/catch.hpp"
+
+namespace oneapi::dal::test::engine {
+
+/// Catch2 reporter that prints the results of the benchmarks in JSON Lines
+/// format: one JSON object per benchmark. All durations are in nanoseconds.
+/// The reporter is selected by the `--reporter perf` command line option.
+class perf_reporter : public Catch::StreamingReporterBase<perf_reporter> {
+public:
+    explicit perf_reporter(const Catch::ReporterConfig& config)
+            : Catch::StreamingReporterBase<perf_reporter>(config) {
+        m_reporterPrefs.shouldReportAllAssertions = false;
+    }
+
+    static std::string getDescription() {
+        return "Reports benchmark results in JSON Lines format";
+    }
+
+    void assertionStarting(const Catch::AssertionInfo&) override {}
+
+    bool assertionEnded(const Catch::AssertionStats&) override {
+        return true;
+    }
+
+    void testCaseEnded(const Catch::TestCaseStats& stats) override {
+        if (stats.totals.assertions.failed > 0) {
+            stream << "{\"test\":\"" << escape(stats.testInfo.name) << "\",\"status\":\"failed\"}"
+                   << std::endl;
+        }
+        Catch::StreamingReporterBase<perf_reporter>::testCaseEnded(stats);
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        stream << "{\"test\":\"" << escape(currentTestCaseInfo->name) << "\","
+               << "\"benchmark\":\"" << escape(stats.info.name) << "\","
+               << "\"samples\":" << stats.info.samples << ","
+               << "\"iterations\":" << stats.info.iterations << ","
+               << "\"mean_ns\":" << stats.mean.point.count() << ","
+               << "\"mean_lower_ns\":" << stats.mean.lower_bound.count() << ","
+               << "\"mean_upper_ns\":" << stats.mean.upper_bound.count() << ","
+               << "\"std_dev_ns\":" << stats.standardDeviation.point.count() << ","
+               << "\"outlier_variance\":" << stats.outlierVariance << "}" << std::endl;
+    }
+
+    void benchmarkFailed(const std::string& error) override {
+        stream << "{\"test\":\"" << escape(currentTestCaseInfo->name) << "\","
+               << "\"status\":\"failed\",\"error\":\"" << escape(error) << "\"}" << std::endl;
+    }
+
+private:
+    static std::string escape(const std::string& str) {
+        std::string result;
+        result.reserve(str.size());
+        for (const char c : str) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(c));
+                result += code;
+            }
+            else {
+                result += c;
+            }
+        }
+        return result;
+    }
+};
+
+} // namespace oneapi::dal::test::engine
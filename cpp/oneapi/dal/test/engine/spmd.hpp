@@ -78,4 +78,23 @@ inline auto spmd_compute(device_test_policy& policy,
 }
 #endif
 
+template <typename... Args>
+inline auto spmd_finalize_compute(host_test_policy& policy,
+                                  const dal::detail::spmd_communicator& comm,
+                                  Args&&... args) {
+    return dal::finalize_compute(dal::detail::spmd_policy{ dal::detail::host_policy{}, comm },
+                                 std::forward<Args>(args)...);
+}
+
+#ifdef ONEDAL_DATA_PARALLEL
+template <typename... Args>
+inline auto spmd_finalize_compute(device_test_policy& policy,
+                                  const dal::detail::spmd_communicator& comm,
+                                  Args&&... args) {
+    dal::detail::data_parallel_policy local_policy{ policy.get_queue() };
+    dal::detail::spmd_policy spmd_policy{ local_policy, comm };
+    return dal::finalize_compute(spmd_policy, std::forward<Args>(args)...);
+}
+#endif
+
 } // namespace oneapi::dal::test::engine
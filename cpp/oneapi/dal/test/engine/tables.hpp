@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <random>
+
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/table/common.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/detail/csr.hpp"
 
 namespace oneapi::dal::test::engine {
 
@@ -166,4 +169,67 @@ inline table stack_tables_by_rows(const std::vector<table>& tables) {
     return homogen_table::wrap(stacked_table_memory, total_row_count, total_column_count);
 }
 
+/// Generates a dense table in which approximately `nonzero_ratio` share of
+/// elements are non-zero values drawn uniformly from $[a, b)$
+template <typename Float>
+inline table generate_sparse_homogen_table(std::int64_t row_count,
+                                           std::int64_t column_count,
+                                           double nonzero_ratio,
+                                           double a,
+                                           double b,
+                                           std::int64_t seed) {
+    const std::int64_t element_count = dal::detail::check_mul_overflow(row_count, column_count);
+    auto data = dal::array<Float>::zeros(element_count);
+    Float* data_ptr = data.get_mutable_data();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> mask_distr(0.0, 1.0);
+    std::uniform_real_distribution<double> value_distr(a, b);
+    for (std::int64_t i = 0; i < element_count; i++) {
+        if (mask_distr(rng) < nonzero_ratio) {
+            data_ptr[i] = static_cast<Float>(value_distr(rng));
+        }
+    }
+
+    return homogen_table::wrap(data, row_count, column_count);
+}
+
+/// Converts a table to the CSR format with one-based indexing.
+/// Zero elements are not stored.
+template <typename Float>
+inline dal::detail::csr_table convert_to_csr_table(const table& t) {
+    const std::int64_t row_count = t.get_row_count();
+    const std::int64_t column_count = t.get_column_count();
+    const auto t_ary = row_accessor<const Float>{ t }.pull();
+    const Float* t_ptr = t_ary.get_data();
+
+    std::int64_t nonzero_count = 0;
+    for (std::int64_t i = 0; i < t_ary.get_count(); i++) {
+        nonzero_count += std::int64_t(t_ptr[i] != Float(0));
+    }
+
+    auto data = dal::array<Float>::empty(nonzero_count);
+    auto column_indices = dal::array<std::int64_t>::empty(nonzero_count);
+    auto row_indices = dal::array<std::int64_t>::empty(row_count + 1);
+    Float* data_ptr = data.get_mutable_data();
+    std::int64_t* column_indices_ptr = column_indices.get_mutable_data();
+    std::int64_t* row_indices_ptr = row_indices.get_mutable_data();
+
+    std::int64_t offset = 0;
+    row_indices_ptr[0] = 1;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        for (std::int64_t j = 0; j < column_count; j++) {
+            const Float value = t_ptr[i * column_count + j];
+            if (value != Float(0)) {
+                data_ptr[offset] = value;
+                column_indices_ptr[offset] = j + 1;
+                offset++;
+            }
+        }
+        row_indices_ptr[i + 1] = offset + 1;
+    }
+
+    return dal::detail::csr_table{ data, column_indices, row_indices, row_count, column_count };
+}
+
 } // namespace oneapi::dal::test::engine
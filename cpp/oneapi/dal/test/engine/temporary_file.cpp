@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/temporary_file.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::test::engine {
+
+std::string create_temporary_file(const std::string& prefix) {
+#ifdef _WIN32
+    char directory[MAX_PATH + 1];
+    const DWORD directory_length = ::GetTempPathA(MAX_PATH + 1, directory);
+    REQUIRE(directory_length > 0);
+    REQUIRE(directory_length <= MAX_PATH);
+
+    // Creates the file with the unique name, so no other run can obtain it
+    char path[MAX_PATH];
+    REQUIRE(::GetTempFileNameA(directory, prefix.c_str(), 0, path) != 0);
+    return path;
+#else
+    const std::string pattern = "/tmp/" + prefix + "_XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+
+    const int file_descriptor = ::mkstemp(path.data());
+    REQUIRE(file_descriptor >= 0);
+    ::close(file_descriptor);
+    return path.data();
+#endif
+}
+
+} // namespace oneapi::dal::test::engine
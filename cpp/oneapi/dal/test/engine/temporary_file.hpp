@@ -0,0 +1,27 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+namespace oneapi::dal::test::engine {
+
+/// Creates the empty file with the unique name in the temporary directory and returns its name,
+/// so concurrent runs of the tests do not share the file. The caller removes the file.
+std::string create_temporary_file(const std::string& prefix);
+
+} // namespace oneapi::dal::test::engine
@@ -0,0 +1,40 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using basic_statistics_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_M(perf_fixture,
+                     "basic statistics perf",
+                     "[basic_statistics][perf]",
+                     basic_statistics_types) {
+    using float_t = TestType;
+
+    const table x = this->get_data();
+
+    const auto desc = basic_statistics::descriptor<float_t>{};
+
+    BENCHMARK(this->get_name("basic statistics compute")) {
+        return this->compute(desc, x);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/config.hpp"
+#include "oneapi/dal/test/engine/fixtures.hpp"
+#include "oneapi/dal/test/engine/dataframe.hpp"
+#include "oneapi/dal/test/engine/temporary_file.hpp"
+
+// CPU performance tests of the algorithms on the synthetic data.
+// The size of the data is controlled by the command line options
+// `--perf-row-count`, `--perf-column-count`, `--perf-vertex-count` and
+// `--perf-average-degree`. Use `--reporter perf` to get the results
+// in JSON Lines format, for example:
+//
+//     cpu_perf_tests "[perf]" --reporter perf --out results.jsonl
+
+namespace oneapi::dal::test::perf {
+
+namespace te = dal::test::engine;
+
+template <typename TestType>
+struct perf_float {
+    using type = TestType;
+};
+
+/// The floating-point type is the first element of the type list for
+/// the tests parametrized by the method
+template <typename Float, typename... Rest>
+struct perf_float<std::tuple<Float, Rest...>> {
+    using type = Float;
+};
+
+template <typename TestType>
+class perf_fixture : public te::float_algo_fixture<typename perf_float<TestType>::type> {
+public:
+    using float_t = typename perf_float<TestType>::type;
+
+    std::int64_t get_row_count() const {
+        return te::get_global_config().perf_row_count;
+    }
+
+    std::int64_t get_column_count() const {
+        return te::get_global_config().perf_column_count;
+    }
+
+    std::int64_t get_vertex_count() const {
+        return te::get_global_config().perf_vertex_count;
+    }
+
+    std::int64_t get_average_degree() const {
+        return te::get_global_config().perf_average_degree;
+    }
+
+    table get_data(std::int64_t row_count, std::int64_t seed = 7777) {
+        const auto df = te::dataframe_builder{ row_count, get_column_count() }
+                            .fill_uniform(-1.0, 1.0, seed)
+                            .build();
+        return df.get_table(this->get_policy(), this->get_homogen_table_id());
+    }
+
+    table get_data() {
+        return get_data(get_row_count());
+    }
+
+    /// Generates the class labels in range [0, class_count) that depend on
+    /// the first feature, so the classes are separable
+    table get_responses(const table& data, std::int64_t class_count) {
+        const std::int64_t row_count = data.get_row_count();
+        const auto first_column = row_accessor<const float_t>(data).pull({ 0, -1 });
+        const std::int64_t column_count = data.get_column_count();
+
+        auto responses = array<float_t>::empty(row_count);
+        float_t* responses_ptr = responses.get_mutable_data();
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const float_t x = first_column[i * column_count];
+            const auto label = static_cast<std::int64_t>((x + 1) / 2 * class_count);
+            responses_ptr[i] =
+                static_cast<float_t>(std::min(std::max(label, std::int64_t(0)), class_count - 1));
+        }
+        return homogen_table::wrap(responses, row_count, 1);
+    }
+
+    std::string get_name(const std::string& stage) const {
+        return fmt::format("{}: type {}, rows {}, columns {}",
+                           stage,
+                           std::is_same_v<float_t, double> ? "float64" : "float32",
+                           get_row_count(),
+                           get_column_count());
+    }
+};
+
+/// Random graph with about `vertex_count * average_degree / 2` edges
+/// without self-loops, the weights are uniformly distributed in [1, 10)
+class perf_graph_fixture {
+public:
+    std::int64_t get_vertex_count() const {
+        return te::get_global_config().perf_vertex_count;
+    }
+
+    std::int64_t get_average_degree() const {
+        return te::get_global_config().perf_average_degree;
+    }
+
+    template <typename Graph>
+    Graph get_graph() {
+        return read_graph<Graph>(preview::read_mode::edge_list);
+    }
+
+    template <typename Graph>
+    Graph get_weighted_graph() {
+        return read_graph<Graph>(preview::read_mode::weighted_edge_list);
+    }
+
+    std::string get_name(const std::string& stage) const {
+        return fmt::format("{}: vertices {}, average degree {}",
+                           stage,
+                           get_vertex_count(),
+                           get_average_degree());
+    }
+
+private:
+    template <typename Graph>
+    Graph read_graph(preview::read_mode mode) {
+        const std::string file_name = te::create_temporary_file("onedal_perf_graph");
+        const std::int64_t vertex_count = get_vertex_count();
+        const std::int64_t edge_count =
+            (vertex_count > 1) ? vertex_count * get_average_degree() / 2 : 0;
+
+        std::mt19937 gen(7777);
+        std::uniform_int_distribution<std::int32_t> vertex_dist(0, vertex_count - 1);
+        std::uniform_real_distribution<double> weight_dist(1.0, 10.0);
+
+        if (mode == preview::read_mode::weighted_edge_list) {
+            preview::weighted_edge_list<std::int32_t, double> edges;
+            edges.reserve(edge_count);
+            while (static_cast<std::int64_t>(edges.size()) < edge_count) {
+                const std::int32_t u = vertex_dist(gen);
+                const std::int32_t v = vertex_dist(gen);
+                if (u != v) {
+                    edges.push_back(std::make_tuple(u, v, weight_dist(gen)));
+                }
+            }
+            preview::csv::write_binary_edge_list(file_name, edges);
+        }
+        else {
+            preview::edge_list<std::int32_t> edges;
+            edges.reserve(edge_count);
+            while (static_cast<std::int64_t>(edges.size()) < edge_count) {
+                const std::int32_t u = vertex_dist(gen);
+                const std::int32_t v = vertex_dist(gen);
+                if (u != v) {
+                    edges.push_back(std::make_pair(u, v));
+                }
+            }
+            preview::csv::write_binary_edge_list(file_name, edges);
+        }
+
+        auto graph = dal::read<Graph>(csv::data_source{ file_name }, mode);
+        std::remove(file_name.c_str());
+        return graph;
+    }
+};
+
+} // namespace oneapi::dal::test::perf
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/decision_forest.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+namespace df = decision_forest;
+
+using df_types = COMBINE_TYPES((float, double), (df::method::dense, df::method::hist));
+
+TEMPLATE_LIST_TEST_M(perf_fixture,
+                     "decision forest classification perf",
+                     "[df][classification][perf]",
+                     df_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    constexpr std::int64_t class_count = 4;
+
+    const table x = this->get_data();
+    const table y = this->get_responses(x, class_count);
+
+    const auto desc = df::descriptor<float_t, method_t, df::task::classification>{}
+                          .set_class_count(class_count)
+                          .set_tree_count(50)
+                          .set_max_tree_depth(16);
+
+    const auto train_result = this->train(desc, x, y);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("decision forest classification train")) {
+        return this->train(desc, x, y);
+    };
+
+    BENCHMARK(this->get_name("decision forest classification infer")) {
+        return this->infer(desc, model, x);
+    };
+}
+
+TEMPLATE_LIST_TEST_M(perf_fixture,
+                     "decision forest regression perf",
+                     "[df][regression][perf]",
+                     df_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+
+    const table x = this->get_data();
+    const table y = this->get_responses(x, 100);
+
+    const auto desc = df::descriptor<float_t, method_t, df::task::regression>{}
+                          .set_tree_count(50)
+                          .set_max_tree_depth(16);
+
+    const auto train_result = this->train(desc, x, y);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("decision forest regression train")) {
+        return this->train(desc, x, y);
+    };
+
+    BENCHMARK(this->get_name("decision forest regression infer")) {
+        return this->infer(desc, model, x);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
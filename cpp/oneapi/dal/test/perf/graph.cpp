@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/connected_components.hpp"
+#include "oneapi/dal/algo/jaccard.hpp"
+#include "oneapi/dal/algo/louvain.hpp"
+#include "oneapi/dal/algo/triangle_counting.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using graph_t = preview::undirected_adjacency_vector_graph<>;
+using weighted_graph_t = preview::undirected_adjacency_vector_graph<std::int32_t, double>;
+
+TEST_M(perf_graph_fixture, "connected components perf", "[connected_components][perf]") {
+    const auto graph = this->get_graph<graph_t>();
+
+    const auto desc = preview::connected_components::descriptor<>{};
+
+    BENCHMARK(this->get_name("connected components")) {
+        return preview::vertex_partitioning(desc, graph);
+    };
+}
+
+TEST_M(perf_graph_fixture, "louvain perf", "[louvain][perf]") {
+    const auto graph = this->get_weighted_graph<weighted_graph_t>();
+
+    const auto desc = preview::louvain::descriptor<>{};
+
+    BENCHMARK(this->get_name("louvain")) {
+        return preview::vertex_partitioning(desc, graph);
+    };
+}
+
+TEST_M(perf_graph_fixture, "jaccard perf", "[jaccard][perf]") {
+    const auto graph = this->get_graph<graph_t>();
+    const std::int64_t vertex_count = this->get_vertex_count();
+    const std::int64_t row_count = std::min(vertex_count, std::int64_t(1024));
+
+    const auto desc =
+        preview::jaccard::descriptor<>{}.set_block({ 0, row_count }, { 0, vertex_count });
+    preview::jaccard::caching_builder builder;
+
+    BENCHMARK(this->get_name("jaccard")) {
+        return preview::vertex_similarity(desc, graph, builder);
+    };
+}
+
+TEST_M(perf_graph_fixture, "triangle counting perf", "[triangle_counting][perf]") {
+    namespace tc = preview::triangle_counting;
+
+    const auto graph = this->get_graph<graph_t>();
+
+    const auto desc = tc::descriptor<float, tc::method::ordered_count, tc::task::local_and_global>{};
+
+    BENCHMARK(this->get_name("triangle counting")) {
+        return preview::vertex_ranking(desc, graph);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using kmeans_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_M(perf_fixture, "kmeans perf", "[kmeans][perf]", kmeans_types) {
+    using float_t = TestType;
+    constexpr std::int64_t cluster_count = 16;
+
+    const table x = this->get_data();
+    const table initial_centroids = this->get_data(cluster_count, 8888);
+
+    const auto desc = kmeans::descriptor<float_t>{}
+                          .set_cluster_count(cluster_count)
+                          .set_max_iteration_count(10)
+                          .set_accuracy_threshold(0.0);
+
+    const auto train_result = this->train(desc, x, initial_centroids);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("kmeans train")) {
+        return this->train(desc, x, initial_centroids);
+    };
+
+    BENCHMARK(this->get_name("kmeans infer")) {
+        return this->infer(desc, model, x);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/knn.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using knn_types = COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+
+TEMPLATE_LIST_TEST_M(perf_fixture, "knn perf", "[knn][perf]", knn_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    constexpr std::int64_t class_count = 4;
+    constexpr std::int64_t neighbor_count = 8;
+
+    const table x = this->get_data();
+    const table y = this->get_responses(x, class_count);
+
+    const auto desc = knn::descriptor<float_t, method_t>{ class_count, neighbor_count };
+
+    const auto train_result = this->train(desc, x, y);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("knn train")) {
+        return this->train(desc, x, y);
+    };
+
+    BENCHMARK(this->get_name("knn infer")) {
+        return this->infer(desc, x, model);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
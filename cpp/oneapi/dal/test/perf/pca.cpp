@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/pca.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using pca_types = COMBINE_TYPES((float, double), (pca::method::cov, pca::method::svd));
+
+TEMPLATE_LIST_TEST_M(perf_fixture, "pca perf", "[pca][perf]", pca_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+
+    const table x = this->get_data();
+    const std::int64_t component_count = std::max(x.get_column_count() / 2, std::int64_t(1));
+
+    const auto desc = pca::descriptor<float_t, method_t>{}.set_component_count(component_count);
+
+    const auto train_result = this->train(desc, x);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("pca train")) {
+        return this->train(desc, x);
+    };
+
+    BENCHMARK(this->get_name("pca infer")) {
+        return this->infer(desc, model, x);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
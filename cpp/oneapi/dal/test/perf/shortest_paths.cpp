@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/shortest_paths.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using directed_weighted_graph_t = preview::directed_adjacency_vector_graph<std::int32_t, double>;
+
+TEST_M(perf_graph_fixture, "shortest paths perf", "[shortest_paths][perf]") {
+    namespace sp = preview::shortest_paths;
+
+    const auto graph = this->get_weighted_graph<directed_weighted_graph_t>();
+
+    const auto desc = sp::descriptor<float, sp::method::delta_stepping, sp::task::one_to_all>{
+        0,
+        2.0,
+        sp::optional_results::distances
+    };
+
+    BENCHMARK(this->get_name("shortest paths")) {
+        return preview::traverse(desc, graph);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
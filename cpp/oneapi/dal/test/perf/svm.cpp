@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/svm.hpp"
+
+#include "oneapi/dal/test/perf/common.hpp"
+
+namespace oneapi::dal::test::perf {
+
+using svm_types = COMBINE_TYPES((float, double), (svm::method::smo, svm::method::thunder));
+
+TEMPLATE_LIST_TEST_M(perf_fixture, "svm perf", "[svm][perf]", svm_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using kernel_t = linear_kernel::descriptor<float_t>;
+
+    const table x = this->get_data();
+    const table y = this->get_responses(x, 2);
+
+    const auto kernel_desc = kernel_t{};
+    const auto desc =
+        svm::descriptor<float_t, method_t, svm::task::classification, kernel_t>{ kernel_desc }
+            .set_c(1.0)
+            .set_accuracy_threshold(0.01)
+            .set_max_iteration_count(1000);
+
+    const auto train_result = this->train(desc, x, y);
+    const auto model = train_result.get_model();
+
+    BENCHMARK(this->get_name("svm train")) {
+        return this->train(desc, x, y);
+    };
+
+    BENCHMARK(this->get_name("svm infer")) {
+        return this->infer(desc, model, x);
+    };
+}
+
+} // namespace oneapi::dal::test::perf
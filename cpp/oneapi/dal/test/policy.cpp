@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/detail/ops_dispatcher.hpp"
+
+namespace oneapi::dal::test {
+
+TEST("host_policy does not limit threads by default") {
+    const detail::host_policy policy;
+    REQUIRE(policy.get_thread_count() == 0);
+    REQUIRE(policy.get_numa_node() == -1);
+}
+
+TEST("host_policy throws if thread count is negative") {
+    detail::host_policy policy;
+    REQUIRE_THROWS_AS(policy.set_thread_count(-1), invalid_argument);
+}
+
+TEST("host_policy throws if NUMA node is lower than -1") {
+    detail::host_policy policy;
+    REQUIRE_THROWS_AS(policy.set_numa_node(-2), invalid_argument);
+}
+
+TEST("execute_with_policy limits number of threads") {
+    const std::int64_t thread_count = GENERATE(1, 2);
+    CAPTURE(thread_count);
+
+    const auto policy = detail::host_policy{}.set_thread_count(thread_count);
+    const std::int64_t max_threads = detail::execute_with_policy(policy, []() {
+        return std::int64_t(detail::threader_get_max_threads());
+    });
+
+    REQUIRE(max_threads <= thread_count);
+}
+
+TEST("execute_with_policy rethrows exceptions") {
+    const auto policy = detail::host_policy{}.set_thread_count(1);
+    REQUIRE_THROWS_AS(detail::execute_with_policy(policy,
+                                                  []() -> std::int64_t {
+                                                      throw invalid_argument{ "" };
+                                                  }),
+                      invalid_argument);
+}
+
+} // namespace oneapi::dal::test
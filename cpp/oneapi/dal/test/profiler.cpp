@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <daal/src/externals/service_profiler.h>
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "oneapi/dal/test/engine/temporary_file.hpp"
+
+namespace oneapi::dal::test {
+
+using daal::internal::Profiler;
+using daal::internal::ProfilerTask;
+namespace te = dal::test::engine;
+
+static std::string read_file(const std::string& file_name) {
+    std::ifstream file(file_name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+static std::int64_t count_occurrences(const std::string& text, const std::string& pattern) {
+    std::int64_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+
+TEST("profiler writes tasks recorded by several threads as a Chrome trace") {
+    const std::string file_name = te::create_temporary_file("onedal_profiler_trace");
+    constexpr std::int32_t task_count = 5000;
+
+    Profiler::enable(file_name.c_str());
+    REQUIRE(Profiler::isEnabled());
+
+    detail::threader_for(task_count, task_count, [](std::int32_t i) {
+        ProfilerTask task = Profiler::startTask("test.profiler.outer", 64);
+        ProfilerTask nested_task = Profiler::startTask("test.profiler.inner");
+    });
+
+    const bool is_written = Profiler::writeTrace();
+    Profiler::disable();
+    REQUIRE(is_written);
+    REQUIRE(!Profiler::isEnabled());
+
+    const std::string trace = read_file(file_name);
+    std::remove(file_name.c_str());
+
+    const std::string header = "{\"traceEvents\":[";
+    const std::string footer = "\n],\"displayTimeUnit\":\"ms\"}\n";
+    REQUIRE(trace.compare(0, header.size(), header) == 0);
+    REQUIRE(trace.size() >= header.size() + footer.size());
+    REQUIRE(trace.compare(trace.size() - footer.size(), footer.size(), footer) == 0);
+
+    INFO("every task is written exactly once as a complete event");
+    const std::string event_suffix = "\",\"cat\":\"daal\",\"ph\":\"X\"";
+    REQUIRE(count_occurrences(trace, "{\"name\":\"test.profiler.outer" + event_suffix) ==
+            task_count);
+    REQUIRE(count_occurrences(trace, "{\"name\":\"test.profiler.inner" + event_suffix) ==
+            task_count);
+    REQUIRE(count_occurrences(trace, "\"args\":{\"bytes\":64,") == task_count);
+
+    INFO("braces of the events are balanced");
+    REQUIRE(count_occurrences(trace, "{") == count_occurrences(trace, "}"));
+}
+
+TEST("profiler does not record tasks after it is disabled") {
+    const std::string file_name = te::create_temporary_file("onedal_profiler_trace");
+
+    Profiler::enable(file_name.c_str());
+    Profiler::disable();
+    {
+        ProfilerTask task = Profiler::startTask("test.profiler.disabled");
+    }
+
+    Profiler::enable(file_name.c_str());
+    const bool is_written = Profiler::writeTrace();
+    Profiler::disable();
+    REQUIRE(is_written);
+
+    const std::string trace = read_file(file_name);
+    std::remove(file_name.c_str());
+    REQUIRE(count_occurrences(trace, "test.profiler.disabled") == 0);
+}
+
+} // namespace oneapi::dal::test
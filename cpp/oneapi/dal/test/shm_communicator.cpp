@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef _WIN32
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "oneapi/dal/detail/shm_communicator.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::test {
+
+namespace de = dal::detail;
+
+class shm_communicator_test {
+public:
+    /// Runs the body in `rank_count` processes, the rank 0 is the calling
+    /// process. Returns the total number of mismatches found by all ranks.
+    template <typename Body>
+    std::int64_t run_in_processes(std::int64_t rank_count,
+                                  std::int64_t buffer_size,
+                                  const Body& body) {
+        CAPTURE(rank_count, buffer_size);
+        const std::string name = "/onedal_shm_test_" + std::to_string(::getpid());
+
+        std::vector<pid_t> children;
+        for (std::int64_t rank = 1; rank < rank_count; rank++) {
+            const pid_t pid = ::fork();
+            REQUIRE(pid >= 0);
+            if (pid == 0) {
+                // Catch assertions must not be used in the child processes,
+                // mismatches are reported through the exit code
+                std::int64_t mismatch_count = 0;
+                try {
+                    de::shm_communicator comm{ name, rank, rank_count, buffer_size };
+                    mismatch_count = body(comm, rank);
+                }
+                catch (...) {
+                    mismatch_count = 1;
+                }
+                ::_exit(mismatch_count > 0 ? 1 : 0);
+            }
+            children.push_back(pid);
+        }
+
+        de::shm_communicator comm{ name, 0, rank_count, buffer_size };
+        std::int64_t mismatch_count = body(comm, 0);
+
+        for (const pid_t pid : children) {
+            int status = 0;
+            ::waitpid(pid, &status, 0);
+            REQUIRE(WIFEXITED(status));
+            mismatch_count += WEXITSTATUS(status);
+        }
+        return mismatch_count;
+    }
+};
+
+TEST_M(shm_communicator_test, "shm communicator collectives", "[shm][spmd]") {
+    const std::int64_t rank_count = GENERATE(1, 2, 3);
+    // Small buffer forces the messages to be transferred in several rounds
+    const std::int64_t buffer_size = GENERATE(64, 1024 * 1024);
+    const std::int64_t count = GENERATE(0, 1, 1000);
+
+    const auto mismatch_count = run_in_processes(
+        rank_count,
+        buffer_size,
+        [&](const de::shm_communicator& comm, std::int64_t rank) -> std::int64_t {
+            std::int64_t mismatch_count = 0;
+
+            // allreduce
+            {
+                std::vector<double> send(count);
+                std::vector<double> recv(count);
+                for (std::int64_t i = 0; i < count; i++) {
+                    send[i] = double(rank * 1000 + i);
+                }
+                comm.allreduce(send.data(), recv.data(), count).wait();
+                for (std::int64_t i = 0; i < count; i++) {
+                    const double expected =
+                        500.0 * rank_count * (rank_count - 1) + double(rank_count * i);
+                    mismatch_count += (recv[i] != expected);
+                }
+            }
+
+            // bcast
+            {
+                const std::int64_t root = rank_count - 1;
+                std::vector<std::int32_t> buf(count, rank == root ? 42 : 0);
+                comm.bcast(buf.data(), count, root).wait();
+                for (const auto x : buf) {
+                    mismatch_count += (x != 42);
+                }
+            }
+
+            // allgather
+            {
+                std::vector<std::int32_t> send(count);
+                std::iota(send.begin(), send.end(), std::int32_t(rank * 7));
+                std::vector<std::int32_t> recv(count * rank_count, -1);
+                comm.allgather(send.data(), count, recv.data(), count).wait();
+                for (std::int64_t r = 0; r < rank_count; r++) {
+                    for (std::int64_t i = 0; i < count; i++) {
+                        mismatch_count += (recv[r * count + i] != r * 7 + i);
+                    }
+                }
+            }
+
+            // gatherv
+            {
+                // Rank r sends count * (r + 1) / rank_count elements
+                std::vector<std::int64_t> recv_counts(rank_count);
+                std::vector<std::int64_t> displs(rank_count);
+                std::int64_t total_count = 0;
+                for (std::int64_t r = 0; r < rank_count; r++) {
+                    recv_counts[r] = count * (r + 1) / rank_count;
+                    displs[r] = total_count;
+                    total_count += recv_counts[r];
+                }
+
+                std::vector<std::int64_t> send(recv_counts[rank]);
+                std::iota(send.begin(), send.end(), rank * 100000);
+                std::vector<std::int64_t> recv(total_count, -1);
+                comm.gatherv(send.data(),
+                             std::int64_t(send.size()),
+                             recv.data(),
+                             recv_counts.data(),
+                             displs.data(),
+                             0)
+                    .wait();
+
+                if (rank == 0) {
+                    for (std::int64_t r = 0; r < rank_count; r++) {
+                        for (std::int64_t i = 0; i < recv_counts[r]; i++) {
+                            mismatch_count += (recv[displs[r] + i] != r * 100000 + i);
+                        }
+                    }
+                }
+            }
+
+            comm.barrier();
+            return mismatch_count;
+        });
+
+    REQUIRE(mismatch_count == 0);
+}
+
+TEST("shm communicator throws on invalid arguments", "[shm][badarg]") {
+    REQUIRE_THROWS_AS(de::shm_communicator("/onedal_shm_badarg", 0, 0), invalid_argument);
+    REQUIRE_THROWS_AS(de::shm_communicator("/onedal_shm_badarg", 2, 2), invalid_argument);
+    REQUIRE_THROWS_AS(de::shm_communicator("/onedal_shm_badarg", 0, 1, 0), invalid_argument);
+}
+
+TEST("shm communicator does not reuse existing segment", "[shm]") {
+    const std::string name = "/onedal_shm_exists_" + std::to_string(::getpid());
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    REQUIRE(fd >= 0);
+    ::close(fd);
+
+    REQUIRE_THROWS_AS(de::shm_communicator(name, 0, 1), de::communication_error);
+
+    // The segment of another job must be left untouched
+    const int existing_fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    REQUIRE(existing_fd >= 0);
+    ::close(existing_fd);
+    ::shm_unlink(name.c_str());
+
+    // The name is removed after all ranks are attached, so it can be used again
+    { de::shm_communicator comm{ name, 0, 1 }; }
+    { de::shm_communicator comm{ name, 0, 1 }; }
+}
+
+TEST("shm communicator throws if collective timeout is set and rank does not arrive", "[shm]") {
+    const std::string name = "/onedal_shm_timeout_" + std::to_string(::getpid());
+    const std::int64_t buffer_size = de::shm_communicator::default_buffer_size;
+    const std::int64_t attach_timeout_ms = de::shm_communicator::default_attach_timeout_ms;
+
+    // The rank 1 attaches and exits without entering the barrier
+    const pid_t pid = ::fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+        try {
+            de::shm_communicator comm{ name, 1, 2, buffer_size, attach_timeout_ms, 100 };
+        }
+        catch (...) {
+            ::_exit(1);
+        }
+        ::_exit(0);
+    }
+
+    de::shm_communicator comm{ name, 0, 2, buffer_size, attach_timeout_ms, 100 };
+    REQUIRE_THROWS_AS(comm.barrier(), de::communication_error);
+
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+
+TEST("shm communicator throws on unsupported reduce operation", "[shm]") {
+    const std::string name = "/onedal_shm_reduce_op_" + std::to_string(::getpid());
+    de::shm_communicator comm{ name, 0, 1 };
+
+    std::vector<double> send(10, 1.0);
+    std::vector<double> recv(10);
+    const auto unsupported_op = static_cast<de::spmd_reduce_op>(-1);
+    REQUIRE_THROWS_AS(comm.allreduce(send.data(), recv.data(), 10, unsupported_op), unimplemented);
+}
+
+} // namespace oneapi::dal::test
+
+#endif
@@ -0,0 +1,177 @@
+/* file: dbscan_dense_grid_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense DBSCAN clustering in the batch processing mode
+!    with the uniform grid neighborhood engine
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DBSCAN_GRID_BATCH"></a>
+ * \example dbscan_dense_grid_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/dbscan_dense.csv";
+
+/* DBSCAN algorithm parameters */
+const float epsilon          = 0.04f;
+const size_t minObservations = 45;
+
+/* Parameters of the synthetic data sets with many features: Gaussian blobs and uniform noise */
+const size_t nSyntheticFeatures[]     = { 10, 40, 70 };
+const size_t nBlobObservations        = 2000;
+const size_t nNoiseObservations       = 200;
+const size_t nBlobs                   = 5;
+const double blobSpread               = 0.1;
+const size_t syntheticMinObservations = 10;
+
+dbscan::ResultPtr runDBSCAN(const NumericTablePtr & data, dbscan::NeighborhoodEngineId engine, float eps = epsilon,
+                            size_t minObs = minObservations)
+{
+    /* Create an algorithm object for the DBSCAN algorithm */
+    dbscan::Batch<> algorithm(eps, minObs);
+    algorithm.parameter().neighborhoodEngine = engine;
+
+    algorithm.input.set(dbscan::data, data);
+
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+bool isEqual(const NumericTablePtr & table1, const NumericTablePtr & table2)
+{
+    const size_t nRows = table1->getNumberOfRows();
+    if (nRows != table2->getNumberOfRows()) return false;
+
+    BlockDescriptor<int> block1;
+    BlockDescriptor<int> block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+
+    const int * data1 = block1.getBlockPtr();
+    const int * data2 = block2.getBlockPtr();
+
+    bool result = true;
+    for (size_t i = 0; i < nRows && result; i++)
+    {
+        result = (data1[i] == data2[i]);
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return result;
+}
+
+/* Returns true if the grid and the brute force engines produce the same clusterings */
+bool compareEngines(const NumericTablePtr & data, float eps, size_t minObs)
+{
+    dbscan::ResultPtr gridResult       = runDBSCAN(data, dbscan::gridEngine, eps, minObs);
+    dbscan::ResultPtr bruteForceResult = runDBSCAN(data, dbscan::bruteForceEngine, eps, minObs);
+
+    return isEqual(gridResult->get(dbscan::nClusters), bruteForceResult->get(dbscan::nClusters))
+           && isEqual(gridResult->get(dbscan::assignments), bruteForceResult->get(dbscan::assignments));
+}
+
+vector<float> generateData(size_t nFeatures)
+{
+    mt19937 engine(777);
+    uniform_real_distribution<float> uniformDistribution(0.0f, 10.0f);
+    normal_distribution<float> noiseDistribution(0.0f, blobSpread);
+    uniform_int_distribution<size_t> blobDistribution(0, nBlobs - 1);
+
+    vector<float> centers(nBlobs * nFeatures);
+    for (size_t i = 0; i < centers.size(); i++)
+    {
+        centers[i] = uniformDistribution(engine);
+    }
+
+    vector<float> data((nBlobObservations + nNoiseObservations) * nFeatures);
+    for (size_t i = 0; i < nBlobObservations; i++)
+    {
+        const size_t blob = blobDistribution(engine);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            data[i * nFeatures + j] = centers[blob * nFeatures + j] + noiseDistribution(engine);
+        }
+    }
+    for (size_t i = nBlobObservations * nFeatures; i < data.size(); i++)
+    {
+        data[i] = uniformDistribution(engine);
+    }
+    return data;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Cluster the data with the uniform grid and with the default brute force engine */
+    dbscan::ResultPtr gridResult       = runDBSCAN(dataSource.getNumericTable(), dbscan::gridEngine);
+    dbscan::ResultPtr bruteForceResult = runDBSCAN(dataSource.getNumericTable(), dbscan::bruteForceEngine);
+
+    /* Print the clusterization results */
+    printNumericTable(gridResult->get(dbscan::nClusters), "Number of clusters:");
+    printNumericTable(gridResult->get(dbscan::assignments), "Assignments of first 20 observations:", 20);
+
+    if (!isEqual(gridResult->get(dbscan::nClusters), bruteForceResult->get(dbscan::nClusters))
+        || !isEqual(gridResult->get(dbscan::assignments), bruteForceResult->get(dbscan::assignments)))
+    {
+        std::cout << "Grid and brute force engines produced different clusterings" << std::endl;
+        return 1;
+    }
+
+    /* The number of the adjacent cells grows exponentially with the number of features,
+       so the grid engine scans the non-empty cells instead of the adjacent ones */
+    for (size_t nFeatures : nSyntheticFeatures)
+    {
+        vector<float> data = generateData(nFeatures);
+        NumericTablePtr dataTable =
+            HomogenNumericTable<float>::create(data.data(), nFeatures, nBlobObservations + nNoiseObservations);
+
+        /* Epsilon is about twice the expected distance between the observations of the same blob */
+        const float syntheticEpsilon = float(3.0 * blobSpread * sqrt(double(nFeatures)));
+
+        if (!compareEngines(dataTable, syntheticEpsilon, syntheticMinObservations))
+        {
+            std::cout << "Grid and brute force engines produced different clusterings on " << nFeatures << " features" << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
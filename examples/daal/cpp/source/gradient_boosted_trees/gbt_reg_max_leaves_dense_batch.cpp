@@ -0,0 +1,201 @@
+/* file: gbt_reg_max_leaves_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode
+!    with the limited number of leaves in a tree.
+!
+!    The program trains the gradient boosted trees regression models grown
+!    best-first and depth-wise, checks the number of leaves in the trees and
+!    compares the predictions of the models on the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_MAX_LEAVES_DENSE_BATCH"></a>
+ * \example gbt_reg_max_leaves_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const size_t maxTreeDepth  = 6;
+const size_t maxLeaves     = 8;
+
+/* Maximal difference between the predictions of the equivalent models */
+const double accuracyThreshold = 1e-5;
+
+/** Visitor class implementing TreeNodeVisitor interface, counts leaf nodes of the tree */
+class LeafCounter : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    LeafCounter() : nLeaves(0) {}
+
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor & desc)
+    {
+        ++nLeaves;
+        return true;
+    }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::regression::SplitNodeDescriptor & desc) { return true; }
+
+    size_t nLeaves;
+};
+
+ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainDependentVariable, size_t maxLeavesInTree);
+NumericTablePtr testModel(const ModelPtr & model, const NumericTablePtr & testData);
+size_t getMaxNumberOfLeaves(const ModelPtr & model);
+double getMaxDifference(const NumericTablePtr & table1, const NumericTablePtr & table2);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainDependentVariable, testData, testGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Grow the trees best-first up to maxLeaves leaves */
+    ModelPtr limitedModel = trainModel(trainData, trainDependentVariable, maxLeaves);
+    const size_t nLeaves  = getMaxNumberOfLeaves(limitedModel);
+    std::cout << "Maximal number of leaves in a tree: " << nLeaves << std::endl;
+    if (nLeaves > maxLeaves)
+    {
+        std::cout << "The number of leaves exceeds maxLeaves = " << maxLeaves << std::endl;
+        return 1;
+    }
+
+    /* The limit that the tree of depth maxTreeDepth cannot reach must give the same trees as the depth-wise growth */
+    ModelPtr depthWiseModel = trainModel(trainData, trainDependentVariable, 0);
+    ModelPtr bestFirstModel = trainModel(trainData, trainDependentVariable, size_t(1) << maxTreeDepth);
+
+    NumericTablePtr depthWisePrediction = testModel(depthWiseModel, testData);
+    NumericTablePtr bestFirstPrediction = testModel(bestFirstModel, testData);
+    printNumericTable(bestFirstPrediction, "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    if (getMaxDifference(depthWisePrediction, bestFirstPrediction) > accuracyThreshold)
+    {
+        std::cout << "Best-first and depth-wise models produced different predictions" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainDependentVariable, size_t maxLeavesInTree)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().maxTreeDepth  = maxTreeDepth;
+    algorithm.parameter().maxLeaves     = maxLeavesInTree;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr testModel(const ModelPtr & model, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, model);
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+size_t getMaxNumberOfLeaves(const ModelPtr & model)
+{
+    size_t maxNumberOfLeaves = 0;
+    for (size_t i = 0; i < model->numberOfTrees(); ++i)
+    {
+        LeafCounter visitor;
+        model->traverseDFS(i, visitor);
+        maxNumberOfLeaves = std::max(maxNumberOfLeaves, visitor.nLeaves);
+    }
+    return maxNumberOfLeaves;
+}
+
+double getMaxDifference(const NumericTablePtr & table1, const NumericTablePtr & table2)
+{
+    const size_t nRows = table1->getNumberOfRows();
+
+    BlockDescriptor<double> block1;
+    BlockDescriptor<double> block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+
+    const double * data1 = block1.getBlockPtr();
+    const double * data2 = block2.getBlockPtr();
+
+    double maxDifference = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        maxDifference = std::max(maxDifference, std::abs(data1[i] - data2[i]));
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return maxDifference;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
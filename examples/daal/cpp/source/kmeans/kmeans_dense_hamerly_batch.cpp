@@ -0,0 +1,190 @@
+/* file: kmeans_dense_hamerly_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense K-Means clustering in the batch processing mode
+!    with Hamerly's bounds
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_HAMERLY_BATCH"></a>
+ * \example kmeans_dense_hamerly_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters: overlapping Gaussian blobs */
+const size_t nObservations = 20000;
+const size_t nFeatures     = 8;
+const size_t nBlobs        = 100;
+const double blobSpread    = 2.0;
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 100;
+const size_t nIterations = 30;
+
+/* Ties and rounding may assign a few observations differently */
+const double maxMismatchedAssignmentsRatio = 1e-3;
+const double centroidsTolerance            = 1e-4;
+const double objectiveFunctionTolerance    = 1e-6;
+
+vector<double> generateData()
+{
+    mt19937 engine(777);
+    uniform_real_distribution<double> centerDistribution(0.0, 10.0);
+    normal_distribution<double> noiseDistribution(0.0, blobSpread);
+    uniform_int_distribution<size_t> blobDistribution(0, nBlobs - 1);
+
+    vector<double> centers(nBlobs * nFeatures);
+    for (size_t i = 0; i < centers.size(); i++)
+    {
+        centers[i] = centerDistribution(engine);
+    }
+
+    vector<double> data(nObservations * nFeatures);
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        const size_t blob = blobDistribution(engine);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            data[i * nFeatures + j] = centers[blob * nFeatures + j] + noiseDistribution(engine);
+        }
+    }
+    return data;
+}
+
+template <kmeans::Method method>
+kmeans::ResultPtr runKMeans(const NumericTablePtr & data, const NumericTablePtr & initialCentroids)
+{
+    /* Create an algorithm object for the K-Means algorithm */
+    kmeans::Batch<double, method> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, data);
+    algorithm.input.set(kmeans::inputCentroids, initialCentroids);
+
+    algorithm.parameter().accuracyThreshold = 0.0;
+    algorithm.parameter().resultsToEvaluate = kmeans::computeCentroids | kmeans::computeAssignments | kmeans::computeExactObjectiveFunction;
+
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+size_t countMismatchedAssignments(const NumericTablePtr & table1, const NumericTablePtr & table2)
+{
+    const size_t nRows = table1->getNumberOfRows();
+
+    BlockDescriptor<int> block1;
+    BlockDescriptor<int> block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+
+    const int * data1 = block1.getBlockPtr();
+    const int * data2 = block2.getBlockPtr();
+
+    size_t nMismatched = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        nMismatched += (data1[i] != data2[i]);
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return nMismatched;
+}
+
+double maxAbsDifference(const NumericTablePtr & table1, const NumericTablePtr & table2)
+{
+    const size_t nRows = table1->getNumberOfRows();
+    const size_t nCols = table1->getNumberOfColumns();
+
+    BlockDescriptor<double> block1;
+    BlockDescriptor<double> block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+
+    const double * data1 = block1.getBlockPtr();
+    const double * data2 = block2.getBlockPtr();
+
+    double maxDifference = 0.0;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        const double difference = fabs(data1[i] - data2[i]);
+        if (difference > maxDifference) maxDifference = difference;
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return maxDifference;
+}
+
+double getValue(const NumericTablePtr & table)
+{
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, 1, readOnly, block);
+    const double value = block.getBlockPtr()[0];
+    table->releaseBlockOfRows(block);
+    return value;
+}
+
+int main(int argc, char * argv[])
+{
+    vector<double> data = generateData();
+
+    NumericTablePtr dataTable = HomogenNumericTable<double>::create(data.data(), nFeatures, nObservations);
+
+    /* Use the first observations as initial centroids for both methods */
+    NumericTablePtr initialCentroids = HomogenNumericTable<double>::create(data.data(), nFeatures, nClusters);
+
+    kmeans::ResultPtr hamerlyResult = runKMeans<kmeans::hamerlyDense>(dataTable, initialCentroids);
+    kmeans::ResultPtr lloydResult   = runKMeans<kmeans::lloydDense>(dataTable, initialCentroids);
+
+    /* Print the clusterization results */
+    printNumericTable(hamerlyResult->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(hamerlyResult->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(hamerlyResult->get(kmeans::objectiveFunction), "Objective function value:");
+
+    const size_t nMismatched =
+        countMismatchedAssignments(hamerlyResult->get(kmeans::assignments), lloydResult->get(kmeans::assignments));
+    const double centroidsDifference = maxAbsDifference(hamerlyResult->get(kmeans::centroids), lloydResult->get(kmeans::centroids));
+
+    const double hamerlyObjective    = getValue(hamerlyResult->get(kmeans::objectiveFunction));
+    const double lloydObjective      = getValue(lloydResult->get(kmeans::objectiveFunction));
+    const double objectiveDifference = fabs(hamerlyObjective - lloydObjective) / lloydObjective;
+
+    if (nMismatched > maxMismatchedAssignmentsRatio * nObservations || centroidsDifference > centroidsTolerance
+        || objectiveDifference > objectiveFunctionTolerance)
+    {
+        std::cout << "Hamerly and Lloyd methods produced different clusterings: " << nMismatched << " mismatched assignments, "
+                  << "centroids difference " << centroidsDifference << ", objective function difference " << objectiveDifference
+                  << std::endl;
+        return 1;
+    }
+
+    return 0;
+}